@@ -0,0 +1,155 @@
+#include "Benchmark.h"
+#include "../Parser/Parser.h"
+#include "../Parser/ASTSerializer.h"
+#include "../Core/MessagePrinter.h"
+#include "../Core/OutputFiles.h"
+
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <chrono>
+
+// returns the average time in microseconds of a call to func
+template<typename Func>
+double TimeIterations(size_t numIterations, Func func)
+{
+	auto start = std::chrono::steady_clock::now();
+	for (size_t i = 0; i < numIterations; i++)
+	{
+		func();
+	}
+	auto end = std::chrono::steady_clock::now();
+
+	std::chrono::duration<double, std::micro> totalTime = end - start;
+	return totalTime.count() / (double)numIterations;
+}
+
+// outputs of the parser read back once the file is parsed
+struct ParserOutputs
+{
+	std::string m_ast;
+	std::string m_derivation;
+	std::string m_syntaxErrors;
+};
+
+std::string ReadOutputFile(const std::string& filepath, Artifact artifact)
+{
+	std::ifstream file(OutputFiles::GetFilepath(filepath, artifact));
+	std::stringstream ss;
+	ss << file.rdbuf();
+	return ss.str();
+}
+
+ParserOutputs ParseWithBackend(const std::string& filepath, ParserBackend backend)
+{
+	Parser::SetBackend(backend);
+	delete Parser::Parse(filepath);
+	MessagePrinter::ClearMessages();
+
+	ParserOutputs outputs;
+	outputs.m_ast = ReadOutputFile(filepath, Artifact::AST);
+	outputs.m_derivation = ReadOutputFile(filepath, Artifact::Derivation);
+	outputs.m_syntaxErrors = ReadOutputFile(filepath, Artifact::SyntaxErrors);
+	return outputs;
+}
+
+void BenchmarkASTCache(const std::string& filepath, size_t numIterations)
+{
+	ProgramNode* program = Parser::Parse(filepath);
+	MessagePrinter::ClearMessages();
+	if (program == nullptr)
+	{
+		std::cout << "\"" << filepath << "\" could not be parsed, skipping benchmark\n";
+		return;
+	}
+	ASTCache::Store(filepath, program);
+	delete program;
+
+	double reparseTime = TimeIterations(numIterations, [&filepath]() 
+	{
+		delete Parser::Parse(filepath);
+	});
+
+	double loadTime = TimeIterations(numIterations, [&filepath]() 
+	{
+		delete ASTCache::Load(filepath);
+	});
+
+	std::cout << "reparse: " << reparseTime << "us, load from cache: " << loadTime 
+		<< "us (" << reparseTime / loadTime << "x) over " << numIterations << " iterations\n";
+}
+
+void BenchmarkIncrementalParse(const std::string& filepath, size_t numIterations)
+{
+	bool prevIncremental = Parser::IsIncremental();
+
+	Parser::SetIncremental(false);
+	double fullParseTime = TimeIterations(numIterations, [&filepath]() 
+	{
+		delete Parser::Parse(filepath);
+		MessagePrinter::ClearMessages();
+	});
+
+	// the first incremental parse fills the cache of definitions
+	Parser::SetIncremental(true);
+	delete Parser::Parse(filepath);
+	MessagePrinter::ClearMessages();
+	double incrementalParseTime = TimeIterations(numIterations, [&filepath]() 
+	{
+		delete Parser::Parse(filepath);
+		MessagePrinter::ClearMessages();
+	});
+
+	Parser::SetIncremental(prevIncremental);
+	std::cout << "full parse: " << fullParseTime << "us, incremental parse: " 
+		<< incrementalParseTime << "us (" << fullParseTime / incrementalParseTime 
+		<< "x) over " << numIterations << " iterations\n";
+}
+
+void BenchmarkParserBackends(const std::string& filepath, size_t numIterations)
+{
+	ParserBackend prevBackend = Parser::GetBackend();
+
+	Parser::SetBackend(ParserBackend::TableDriven);
+	double tableDrivenTime = TimeIterations(numIterations, [&filepath]() 
+	{
+		delete Parser::Parse(filepath);
+		MessagePrinter::ClearMessages();
+	});
+
+	Parser::SetBackend(ParserBackend::RecursiveDescent);
+	double recursiveDescentTime = TimeIterations(numIterations, [&filepath]() 
+	{
+		delete Parser::Parse(filepath);
+		MessagePrinter::ClearMessages();
+	});
+
+	Parser::SetBackend(prevBackend);
+	std::cout << "table driven parse: " << tableDrivenTime << "us, recursive descent parse: " 
+		<< recursiveDescentTime << "us (" << tableDrivenTime / recursiveDescentTime 
+		<< "x) over " << numIterations << " iterations\n";
+}
+
+bool CompareParserBackends(const std::string& filepath)
+{
+	ParserBackend prevBackend = Parser::GetBackend();
+	ParserOutputs tableDriven = ParseWithBackend(filepath, ParserBackend::TableDriven);
+	ParserOutputs recursiveDescent = ParseWithBackend(filepath, ParserBackend::RecursiveDescent);
+	Parser::SetBackend(prevBackend);
+
+	bool isSame = true;
+	auto compare = [&filepath, &isSame](const std::string& tableDrivenOutput, 
+		const std::string& recursiveDescentOutput, const char* outputName)
+	{
+		if (tableDrivenOutput != recursiveDescentOutput)
+		{
+			std::cout << "the parsers wrote different " << outputName << " for \"" 
+				<< filepath << "\"\n";
+			isSame = false;
+		}
+	};
+	compare(tableDriven.m_ast, recursiveDescent.m_ast, "ASTs");
+	compare(tableDriven.m_derivation, recursiveDescent.m_derivation, "derivations");
+	compare(tableDriven.m_syntaxErrors, recursiveDescent.m_syntaxErrors, "syntax errors");
+	return isSame;
+}
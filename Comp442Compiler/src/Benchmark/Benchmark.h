@@ -0,0 +1,21 @@
+#pragma once
+#include <string>
+
+constexpr size_t DefaultBenchmarkIterations = 100;
+
+// compares the time taken to lex and parse the file against loading its cached AST
+void BenchmarkASTCache(const std::string& filepath, size_t numIterations = DefaultBenchmarkIterations);
+
+// compares the time taken to parse the file against parsing it again incrementally 
+// without any modification
+void BenchmarkIncrementalParse(const std::string& filepath, 
+	size_t numIterations = DefaultBenchmarkIterations);
+
+// compares the time taken to parse the file with the table driven and the recursive descent 
+// parsers
+void BenchmarkParserBackends(const std::string& filepath, 
+	size_t numIterations = DefaultBenchmarkIterations);
+
+// parses the file with both parsers and reports every output file which differs, 
+// returns true if they wrote the same AST, derivation and syntax errors
+bool CompareParserBackends(const std::string& filepath);
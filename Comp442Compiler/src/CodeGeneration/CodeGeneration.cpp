@@ -3,6 +3,7 @@
 #include "../Parser/ASTUtil.h"
 #include "../Core/Core.h"
 #include "../Core/Util.h"
+#include "../Core/OutputFiles.h"
 
 #include <fstream>
 
@@ -11,7 +12,7 @@ SizeGenerator::SizeGenerator(SymbolTable* globalTable) : m_globalTable(globalTab
 
 void SizeGenerator::Visit(LiteralNode* element)
 {
-	if (element->GetEvaluatedType() == "float")
+	if (element->GetCachedEvaluatedTypeID() == TypeTable::GetFloatType())
 	{
 		CreateTempVar(element);
 	}
@@ -52,7 +53,7 @@ void SizeGenerator::Visit(FParamNode* element)
 
 void SizeGenerator::Visit(FuncCallNode* element)
 {
-	if (element->GetEvaluatedType() != "void")
+	if (element->GetCachedEvaluatedTypeID() != TypeTable::GetVoidType())
 	{
 		CreateTempVar(element);
 	}
@@ -145,7 +146,7 @@ void SizeGenerator::TryAddTempVar(VarDeclNode* element)
 	if (size != InvalidSize)
 	{
 		SymbolTable* table = element->GetSymbolTable();
-		SymbolTableEntry* entry = table->FindEntryInTable(element->GetID()->GetID().GetLexeme());
+		SymbolTableEntry* entry = table->FindEntryInTable(element->GetID()->GetID().GetLexemeID());
 		ASSERT(entry != nullptr);
 		entry->SetSize(size);
 	}
@@ -157,21 +158,21 @@ void SizeGenerator::TryAddTempVar(VarDeclNode* element)
 
 void SizeGenerator::TryAddTempVar(FParamNode* element)
 {
-	std::string typeStr = element->GetEvaluatedType();
+	TypeID type = element->GetCachedEvaluatedTypeID();
 	size_t size;
-	if (IsRefWhenParameter(typeStr))
+	if (IsRefWhenParameter(type))
 	{
 		size = PlatformSpecifications::GetAddressSize();
 	}
 	else
 	{
-		size = ComputeSize(typeStr);
+		size = ComputeSize(type);
 	}
 
 	if (size != InvalidSize)
 	{
 		SymbolTable* table = element->GetSymbolTable();
-		SymbolTableEntry* entry = table->FindEntryInTable(element->GetID()->GetID().GetLexeme());
+		SymbolTableEntry* entry = table->FindEntryInTable(element->GetID()->GetID().GetLexemeID());
 		ASSERT(entry != nullptr);
 		entry->SetSize(size);
 	}
@@ -183,11 +184,11 @@ void SizeGenerator::TryAddTempVar(FParamNode* element)
 
 void SizeGenerator::TryAddTempVar(TempVarNodeBase* element)
 {
-	auto t = element->GetEvaluatedType();
-	size_t size = ComputeSize(element->GetEvaluatedType());
+	TypeID type = element->GetCachedEvaluatedTypeID();
+	size_t size = ComputeSize(type);
 	if (size == InvalidSize)
 	{
-		size = FindSize(GetGlobalTable(element->GetSymbolTable()), element->GetEvaluatedType());
+		size = FindSize(GetGlobalTable(element->GetSymbolTable()), TypeTable::GetTypeStr(type));
 	}
 
 	if (size != InvalidSize)
@@ -202,12 +203,13 @@ void SizeGenerator::TryAddTempVar(TempVarNodeBase* element)
 
 void SizeGenerator::TryAddTempVar(ConstructorDeclNode* element)
 {
-	const std::string& className = ((ClassDefNode*)element->GetParent())->GetID()->GetID().GetLexeme();
-	size_t size = FindSize(GetGlobalTable(element->GetSymbolTable()), className);
+	const Token& className = ((ClassDefNode*)element->GetParent())->GetID()->GetID();
+	size_t size = FindSize(GetGlobalTable(element->GetSymbolTable()), className.GetLexeme());
 	SymbolTable* funcTable = element->GetSymbolTable();
 	if (size != InvalidSize)
 	{
-		TempVarEntry* selfEntry = new TempVarEntry(className, size);
+		TempVarEntry* selfEntry = new TempVarEntry(TypeTable::GetNamedType(className.GetLexemeID()), 
+			size);
 		funcTable->AddEntry(selfEntry);
 		selfEntry->SetName("self");
 	}
@@ -220,13 +222,13 @@ void SizeGenerator::TryAddTempVar(ConstructorDeclNode* element)
 size_t SizeGenerator::ComputeSizeOfFunc(SymbolTable* funcTable)
 {
 	{
-		std::string typeStr = funcTable->GetParentEntry()->GetEvaluatedType();
-		if (typeStr != "void")
+		TypeID type = funcTable->GetParentEntry()->GetEvaluatedTypeID();
+		if (type != TypeTable::GetVoidType())
 		{
-			size_t returnValueSize = ComputeSize(typeStr);
+			size_t returnValueSize = ComputeSize(type);
 			if (returnValueSize == InvalidSize)
 			{
-				returnValueSize = FindSize(GetGlobalTable(funcTable), typeStr);
+				returnValueSize = FindSize(GetGlobalTable(funcTable), TypeTable::GetTypeStr(type));
 			}
 
 			if (returnValueSize == InvalidSize)
@@ -256,15 +258,25 @@ void SizeGenerator::ProcessFunc(ASTNode* func, SymbolTableEntryKind expectedKind
 	SymbolTable* funcTable = funcEntry->GetSubTable();
 	ASSERT(funcEntry != nullptr && funcEntry->GetKind() == expectedKind);
 	
+	// functions are processed again when their size could not be computed, the entries 
+	// added the first time are kept
 	if (funcEntry->GetName() != "main")
 	{
-		funcTable->AddEntry(new ReturnAddressEntry());
+		ReturnAddressEntry* returnAddress = new ReturnAddressEntry();
+		if (funcTable->AddEntry(returnAddress) != nullptr)
+		{
+			delete returnAddress;
+		}
 		funcEntry->SetTag(m_funcTagGen.GetNextTag());
 	}
 
-	if (funcEntry->GetEvaluatedType() != "void")
+	if (funcEntry->GetEvaluatedTypeID() != TypeTable::GetVoidType())
 	{
-		funcTable->AddEntry(new ReturnValueEntry(funcEntry));
+		ReturnValueEntry* returnValue = new ReturnValueEntry(funcEntry);
+		if (funcTable->AddEntry(returnValue) != nullptr)
+		{
+			delete returnValue;
+		}
 	}
 
 	if (funcEntry->GetKind() == SymbolTableEntryKind::MemFuncDecl)
@@ -328,7 +340,7 @@ void SizeGenerator::ComputeClassOffsets(ClassTableEntry* classEntry)
 		for (ASTNode* baseNode : classNode->GetInheritanceList()->GetChildren())
 		{
 			IDNode* id = (IDNode*)baseNode;
-			SymbolTableEntry* parentClassEntry = m_globalTable->FindEntryInTable(id->GetID().GetLexeme());
+			SymbolTableEntry* parentClassEntry = m_globalTable->FindEntryInTable(id->GetID().GetLexemeID());
 			ASSERT(parentClassEntry->GetKind() == SymbolTableEntryKind::Class);
 			ComputeClassOffsets((ClassTableEntry*)parentClassEntry);
 			offset -= (int)parentClassEntry->GetSize();
@@ -371,14 +383,14 @@ bool SizeGenerator::ClassHasOffsets(ClassTableEntry* classEntry)
 
 void SizeGenerator::CreateTempVar(TempVarNodeBase* node)
 {
-	std::string typeStr = node->GetEvaluatedType();
-	size_t size = ComputeSize(typeStr);
+	TypeID type = node->GetCachedEvaluatedTypeID();
+	size_t size = ComputeSize(type);
 	if (size == InvalidSize)
 	{
-		size = FindSize(GetGlobalTable(node->GetSymbolTable()), typeStr);
+		size = FindSize(GetGlobalTable(node->GetSymbolTable()), TypeTable::GetTypeStr(type));
 	}
 	ASSERT(size != InvalidSize);
-	TempVarEntry* entry = new TempVarEntry(typeStr, size);
+	TempVarEntry* entry = new TempVarEntry(type, size);
 	node->GetSymbolTable()->AddEntry(entry);
 	node->SetTempVarName(entry->GetName());
 }
@@ -417,7 +429,7 @@ void CodeGenerator::Visit(ExprNode* element)
 {
 	std::stringstream ss;
 	ss << "\n% storing temporary value of expression\n";
-	if (ComputeSize(element->GetEvaluatedType()) <= PlatformSpecifications::GetAddressSize())
+	if (ComputeSize(element->GetCachedEvaluatedTypeID()) <= PlatformSpecifications::GetAddressSize())
 	{
 		RegisterID exprRoot;
 		ss << "\n" << ComputeVal(element->GetRootOfExpr(), exprRoot);
@@ -442,7 +454,7 @@ void CodeGenerator::Visit(ExprNode* element)
 		VariableNode* var = (VariableNode*)element->GetRootOfExpr();
 		SymbolTable* table = element->GetSymbolTable();
 		SymbolTableEntry* dest = table->FindEntryInTable(element->GetTempVarName());
-		SymbolTableEntry* data = table->FindEntryInScope(var->GetVariable()->GetID().GetLexeme());
+		SymbolTableEntry* data = table->FindEntryInScope(var->GetVariable()->GetID().GetLexemeID());
 		ss << CopyData(data, dest);
 	}
 	else
@@ -495,7 +507,7 @@ void CodeGenerator::Visit(FunctionDefNode* element)
 		std::string fparamsStr = FunctionParamTypeToStr(element->GetParameters());
 		for(SymbolTableEntry* entry : *parentTable)
 		{
-			if (entry->GetName() == element->GetID()->GetID().GetLexeme() 
+			if (entry->GetNameID() == element->GetID()->GetID().GetLexemeID() 
 				&& entry->GetKind() == SymbolTableEntryKind::FreeFunction)
 			{
 				FreeFuncTableEntry* freeFuncEntry = (FreeFuncTableEntry*)entry;
@@ -523,7 +535,7 @@ void CodeGenerator::Visit(MemFuncDefNode* element)
 		if (entry->GetKind() == SymbolTableEntryKind::MemFuncDecl)
 		{
 			FunctionDefNode* funcNode = (FunctionDefNode*)entry->GetNode();
-			if (entry->GetName() == element->GetID()->GetID().GetLexeme() 
+			if (entry->GetNameID() == element->GetID()->GetID().GetLexemeID() 
 				&& fparamStr == FunctionParamTypeToStr(funcNode->GetParameters()))
 			{
 				funcEntry = (TagTableEntry*)entry;
@@ -608,7 +620,7 @@ void CodeGenerator::Visit(WhileStatNode* element)
 void CodeGenerator::Visit(AssignStatNode* element)
 {
 	std::stringstream ss;
-	size_t exprSize = ComputeSize(element->GetRight()->GetEvaluatedType());
+	size_t exprSize = ComputeSize(element->GetRight()->GetCachedEvaluatedTypeID());
 
 	ss << "\n%assignment\n";
 	if (exprSize <= PlatformSpecifications::GetAddressSize())
@@ -662,10 +674,11 @@ void CodeGenerator::Visit(AssignStatNode* element)
 	else if (dynamic_cast<FuncCallNode*>(element->GetRight()->GetRootOfExpr()) != nullptr)
 	{
 		FuncCallNode* function = (FuncCallNode*)element->GetRight()->GetRootOfExpr();
-		size_t size = ComputeSize(function->GetEvaluatedType());
+		TypeID returnType = function->GetCachedEvaluatedTypeID();
+		size_t size = ComputeSize(returnType);
 		if (size == InvalidSize)
 		{
-			size = FindSize(GetGlobalTable(element->GetSymbolTable()), function->GetEvaluatedType());
+			size = FindSize(GetGlobalTable(element->GetSymbolTable()), TypeTable::GetTypeStr(returnType));
 		}
 		ASSERT(size != InvalidSize);
 
@@ -697,7 +710,8 @@ void CodeGenerator::Visit(WriteStatNode* element)
 	std::stringstream ss;
 	size_t currFrameSize = GetCurrFrameSize(element);
 	ss << "\n%write stat\n";
-	if (element->GetExpr()->GetEvaluatedType() == "integer")
+	TypeID exprType = element->GetExpr()->GetCachedEvaluatedTypeID();
+	if (exprType == TypeTable::GetIntegerType())
 	{
 		RegisterID exprValRegister;
 		ss << ComputeVal(element->GetExpr(), exprValRegister);
@@ -705,7 +719,7 @@ void CodeGenerator::Visit(WriteStatNode* element)
 		ss << WriteNum(exprValRegister, currFrameSize);
 		m_registerStack.push_front(exprValRegister);
 	}
-	else if (element->GetExpr()->GetEvaluatedType() == "float")
+	else if (exprType == TypeTable::GetFloatType())
 	{
 		RegisterID exprValRegister = m_registerStack.front();
 		int offset = GetOffset(element->GetExpr());
@@ -826,8 +840,7 @@ void CodeGenerator::Visit(ProgramNode* element)
 
 void CodeGenerator::OutputCode() const
 {
-	std::string moonFilepath = SimplifyFilename(m_filepath) + ".moon";
-	std::ofstream outFile = std::ofstream(moonFilepath);
+	std::ofstream outFile = OutputFiles::Open(m_filepath, Artifact::Moon);
 
 	outFile << m_executableCode;
 	outFile << m_dataCode;
@@ -869,7 +882,7 @@ std::string CodeGenerator::GenerateModifiedExpr(ModifiedExpr* modExpr)
 	}
 	else if (dynamic_cast<NotNode*>(modifier) != nullptr)
 	{
-		ASSERT(modExpr->GetEvaluatedType() == "integer"); // the not operator is only defined for integers
+		ASSERT(modExpr->GetCachedEvaluatedTypeID() == TypeTable::GetIntegerType()); // the not operator is only defined for integers
 		return GenerateNotInt(modExpr);
 	}
 	else
@@ -884,7 +897,8 @@ std::string CodeGenerator::GenerateMinusExpr(ModifiedExpr* modExpr)
 {
 	std::stringstream ss;
 	ss << "\n% minus expr\n";
-	if (modExpr->GetExpr()->GetEvaluatedType() == "integer")
+	TypeID exprType = modExpr->GetExpr()->GetCachedEvaluatedTypeID();
+	if (exprType == TypeTable::GetIntegerType())
 	{
 		RegisterID exprReg;
 		ss << ComputeVal(modExpr->GetExpr(), exprReg);
@@ -893,7 +907,7 @@ std::string CodeGenerator::GenerateMinusExpr(ModifiedExpr* modExpr)
 		ss << "sw " << GetOffset(modExpr) << "(r" << m_topOfStackRegister << "), r" << tempVarReg << "\n";
 		m_registerStack.push_front(exprReg);
 	}
-	else if (modExpr->GetExpr()->GetEvaluatedType() == "float")
+	else if (exprType == TypeTable::GetFloatType())
 	{
 		RegisterID reg = m_registerStack.front();
 		m_registerStack.pop_front();
@@ -913,14 +927,14 @@ std::string CodeGenerator::GenerateMinusExpr(ModifiedExpr* modExpr)
 
 std::string CodeGenerator::GenerateBinaryOp(BaseBinaryOperator* opNode)
 {
-	std::string type = opNode->GetEvaluatedType();
-	if (type == "integer")
+	TypeID type = opNode->GetCachedEvaluatedTypeID();
+	if (type == TypeTable::GetIntegerType())
 	{
 		return GenerateBinaryOpInt(opNode);
 	}
 	else
 	{
-		ASSERT(type == "float");
+		ASSERT(type == TypeTable::GetFloatType());
 		return GenerateBinaryOpFloat(opNode);
 	}
 }
@@ -1545,7 +1559,7 @@ std::string CodeGenerator::LoadVarInRegister(ASTNode* n, RegisterID& outRegister
 std::string CodeGenerator::LoadVarInRegister(LiteralNode* node, RegisterID& outRegister)
 {
 	std::stringstream ss;
-	if (node->GetEvaluatedType() == "integer")
+	if (node->GetCachedEvaluatedTypeID() == TypeTable::GetIntegerType())
 	{
 		outRegister = m_registerStack.front();
 		m_registerStack.pop_front();
@@ -1701,17 +1715,17 @@ std::string CodeGenerator::LoadFloatToAddr(int offset, ExprNode* expr)
 
 std::string CodeGenerator::LoadFloatToAddr(int offset, VariableNode* var)
 {
-	ASSERT(var->GetEvaluatedType() == "float");
+	ASSERT(var->GetCachedEvaluatedTypeID() == TypeTable::GetFloatType());
 	std::stringstream ss;
 	RegisterID reg = m_registerStack.front();
-	SymbolTableEntry* varEntry = var->GetSymbolTable()->FindEntryInScope(var->GetVariable()->GetID().GetLexeme());
+	SymbolTableEntry* varEntry = var->GetSymbolTable()->FindEntryInScope(var->GetVariable()->GetID().GetLexemeID());
 	ss << CopyData(varEntry->GetOffset(), varEntry->GetSize(), offset);
 	return ss.str();
 }
 
 std::string CodeGenerator::LoadFloatToAddr(int offset, LiteralNode* floatLiteral)
 {
-	ASSERT(floatLiteral->GetEvaluatedType() == "float");
+	ASSERT(floatLiteral->GetCachedEvaluatedTypeID() == TypeTable::GetFloatType());
 	std::stringstream ss;
 	RegisterID reg = m_registerStack.front();
 	std::string mantissa;
@@ -1741,7 +1755,7 @@ std::string CodeGenerator::GenerateFunc(TagTableEntry* funcEntry, const std::str
 
 	ss << statBlock;
 
-	if (funcEntry->GetEvaluatedType() != "void")
+	if (funcEntry->GetEvaluatedTypeID() != TypeTable::GetVoidType())
 	{
 		SymbolTableEntry* returnValEntry = funcTable->FindEntryInTable("returnValue");
 		ss << "addi r" << m_returnValRegister << ", r" << m_topOfStackRegister 
@@ -1793,7 +1807,7 @@ std::string CodeGenerator::CopyData(int dataOffset, size_t dataSize, int destOff
 
 std::string CodeGenerator::CopyData(SymbolTableEntry* data, SymbolTableEntry* dest)
 {
-	if (data->GetEvaluatedType() == "reference")
+	if (data->GetEvaluatedTypeID() == TypeTable::GetReferenceType())
 	{
 		std::stringstream ss;
 		RegisterID addr = m_registerStack.front();
@@ -1874,7 +1888,7 @@ std::string CodeGenerator::ComputeOffsetAtRuntime(VariableNode* var, RegisterID&
 		context = var->GetSymbolTable();
 	}
 	SymbolTableEntry* varEntry = context->FindEntryInScope(var->
-		GetVariable()->GetID().GetLexeme());
+		GetVariable()->GetID().GetLexemeID());
 
 	VarDeclNode* declNode = (VarDeclNode*)varEntry->GetNode();
 	int varOffset = GetOffset(context, var->GetVariable()->GetID().GetLexeme());
@@ -2102,9 +2116,9 @@ std::string CodeGenerator::HandleParametersForFuncCall(AParamListNode* aparams,
 		{
 			FParamNode* currParam = (FParamNode*)baseNode;
 			ASTNode* baseAParam = *aparamIt;
-			SymbolTableEntry* fparamEntry = funcTable->FindEntryInTable(currParam->GetID()->GetID().GetLexeme());
+			SymbolTableEntry* fparamEntry = funcTable->FindEntryInTable(currParam->GetID()->GetID().GetLexemeID());
 			RegisterID currReg;
-			if (IsRefWhenParameter(fparamEntry->GetEvaluatedType()))
+			if (IsRefWhenParameter(fparamEntry->GetEvaluatedTypeID()))
 			{
 				currReg = m_registerStack.front();
 				m_registerStack.pop_front();
@@ -2150,7 +2164,7 @@ std::string CodeGenerator::CallFunc(FuncCallNode* funcCall)
 	ss << DecrementStackFrame(currFrameSize);
 
 	// handle return value
-	if (funcEntry->GetEvaluatedType() != "void")
+	if (funcEntry->GetEvaluatedTypeID() != TypeTable::GetVoidType())
 	{
 		ss << HandleFuncReturnVal(funcCall, funcEntry);
 	}
@@ -2195,7 +2209,7 @@ std::string CodeGenerator::CallMemFunc(FuncCallNode* funcCall, SymbolTable* cont
 	ss << DecrementStackFrame(currFrameSize);
 
 	// handle return value
-	if (funcEntry->GetEvaluatedType() != "void")
+	if (funcEntry->GetEvaluatedTypeID() != TypeTable::GetVoidType())
 	{
 		ss << HandleFuncReturnVal(funcCall, funcEntry);
 	}
@@ -2302,7 +2316,7 @@ std::string CodeGenerator::CallConstructor(VarDeclNode* decl)
 	ss << DecrementStackFrame(currFrameSize);
 
 	// handle return value
-	SymbolTableEntry* varEntry = decl->GetSymbolTable()->FindEntryInTable(decl->GetID()->GetID().GetLexeme());
+	SymbolTableEntry* varEntry = decl->GetSymbolTable()->FindEntryInTable(decl->GetID()->GetID().GetLexemeID());
 	ss << CopyDataAtRef(m_returnValRegister, selfEntry->GetSize(), varEntry->GetOffset());
 
 	ss << "% finished calling constructor \"" << funcEntry->GetName() << "(" << fparamsStr << ")\"\n\n";
@@ -2315,14 +2329,14 @@ std::string CodeGenerator::HandleFuncReturnVal(FuncCallNode* funcCall, SymbolTab
 {
 	if (funcEntry == nullptr)
 	{
-		funcEntry = funcCall->GetSymbolTable()->FindEntryInScope(funcCall->GetID()->GetID().GetLexeme());
+		funcEntry = funcCall->GetSymbolTable()->FindEntryInScope(funcCall->GetID()->GetID().GetLexemeID());
 	}
 
 	std::stringstream ss;
-	size_t dataSize = ComputeSize(funcCall->GetEvaluatedType());
+	size_t dataSize = ComputeSize(funcCall->GetCachedEvaluatedTypeID());
 	if (dataSize == InvalidSize)
 	{
-		dataSize = FindSize(GetGlobalTable(funcCall->GetSymbolTable()), funcCall->GetEvaluatedType());
+		dataSize = FindSize(GetGlobalTable(funcCall->GetSymbolTable()), funcCall->GetCachedEvaluatedType());
 	}
 	ASSERT(dataSize != InvalidSize);
 
@@ -0,0 +1,40 @@
+#include "DiagnosticsContext.h"
+#include "../SemanticChecking/SemanticErrors.h"
+
+#include <iostream>
+
+thread_local DiagnosticsContext* DiagnosticsContext::s_current = nullptr;
+
+DiagnosticsContext::DiagnosticsContext() : m_numErrors(0), m_console(&std::cout) { }
+
+DiagnosticsContext::~DiagnosticsContext()
+{
+	for (SemanticError* error : m_semanticErrors)
+	{
+		delete error;
+	}
+
+	for (SemanticWarning* warning : m_semanticWarnings)
+	{
+		delete warning;
+	}
+}
+
+DiagnosticsContext& DiagnosticsContext::GetCurrent()
+{
+	if (s_current != nullptr)
+	{
+		return *s_current;
+	}
+
+	static DiagnosticsContext defaultContext;
+	return defaultContext;
+}
+
+void DiagnosticsContext::SetCurrent(DiagnosticsContext* context) { s_current = context; }
+
+void DiagnosticsContext::SetConsole(std::ostream* console) { m_console = console; }
+std::ostream& DiagnosticsContext::GetConsole() const { return *m_console; }
+
+size_t DiagnosticsContext::GetNumErrors() const { return m_numErrors; }
+size_t DiagnosticsContext::GetNumWarnings() const { return m_semanticWarnings.size(); }
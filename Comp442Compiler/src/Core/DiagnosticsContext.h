@@ -0,0 +1,67 @@
+#pragma once
+#include <list>
+#include <vector>
+#include <string>
+#include <fstream>
+#include <ostream>
+#include <utility>
+#include <cstddef>
+
+class SemanticError;
+class SemanticWarning;
+class LazyMessage;
+
+// holds the messages, the error count, the semantic errors and warnings and the JSON Lines 
+// output of the diagnostics reported while compiling a file so independent compilations 
+// do not share any diagnostics. MessagePrinter, ErrorLimit, SemanticErrorManager and 
+// JsonLinesSink work on the current context of the calling thread
+class DiagnosticsContext
+{
+	friend class MessagePrinter;
+	friend class ErrorLimit;
+	friend class SemanticErrorManager;
+	friend class JsonLinesSink;
+
+public:
+	DiagnosticsContext();
+	DiagnosticsContext(const DiagnosticsContext&) = delete;
+	~DiagnosticsContext();
+
+	// threads without a context of their own use a default context
+	static DiagnosticsContext& GetCurrent();
+
+	// the context must outlive its use by the calling thread, nullptr restores the default context
+	static void SetCurrent(DiagnosticsContext* context);
+
+	// stream the messages are echoed to, std::cout unless another stream is set
+	void SetConsole(std::ostream* console);
+	std::ostream& GetConsole() const;
+
+	// errors counted against the error limit
+	size_t GetNumErrors() const;
+	size_t GetNumWarnings() const;
+
+private:
+	struct Message
+	{
+		size_t m_line;
+		std::string m_text;
+
+		// set instead of the text for messages formatted when they are printed
+		const LazyMessage* m_lazyMessage;
+	};
+
+	// kept in the order they were added and only sorted by line when printed
+	std::vector<Message> m_messages;
+	size_t m_numErrors;
+
+	std::list<SemanticError*> m_semanticErrors;
+	std::list<SemanticWarning*> m_semanticWarnings;
+	std::string m_semanticErrorFilepath;
+
+	// only open while diagnostics are streamed as JSON Lines
+	std::ofstream m_jsonLinesFile;
+	std::ostream* m_console;
+
+	static thread_local DiagnosticsContext* s_current;
+};
@@ -0,0 +1,46 @@
+#include "ErrorLimit.h"
+#include "DiagnosticsContext.h"
+
+void ErrorLimit::SetLimit(size_t limit) 
+{ 
+	GetInstance().m_limit = limit == 0 ? NoLimit : limit; 
+}
+
+size_t ErrorLimit::GetLimit() { return GetInstance().m_limit; }
+
+bool ErrorLimit::AddError()
+{
+	DiagnosticsContext& diagnostics = DiagnosticsContext::GetCurrent();
+	if (diagnostics.m_numErrors >= GetInstance().m_limit)
+	{
+		return false;
+	}
+	diagnostics.m_numErrors++;
+	return true;
+}
+
+bool ErrorLimit::IsReached() 
+{ 
+	return DiagnosticsContext::GetCurrent().m_numErrors >= GetInstance().m_limit; 
+}
+
+size_t ErrorLimit::GetNumRemainingErrors()
+{
+	size_t limit = GetInstance().m_limit;
+	size_t numErrors = DiagnosticsContext::GetCurrent().m_numErrors;
+	if (limit == NoLimit)
+	{
+		return NoLimit;
+	}
+	return numErrors < limit ? limit - numErrors : 0;
+}
+
+void ErrorLimit::Reset() { DiagnosticsContext::GetCurrent().m_numErrors = 0; }
+
+ErrorLimit::ErrorLimit() : m_limit(NoLimit) { }
+
+ErrorLimit& ErrorLimit::GetInstance()
+{
+	static ErrorLimit errorLimit;
+	return errorLimit;
+}
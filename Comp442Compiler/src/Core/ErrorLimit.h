@@ -0,0 +1,32 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+
+// counts the errors reported by every phase in the current DiagnosticsContext so the 
+// compilation can stop as soon as the configured limit is reached
+class ErrorLimit
+{
+public:
+	static constexpr size_t NoLimit = SIZE_MAX;
+
+	// a limit of 0 is the same as NoLimit
+	static void SetLimit(size_t limit);
+	static size_t GetLimit();
+
+	// counts a new error, returns false if the limit was already reached in which case 
+	// the error should be dropped without being formatted
+	static bool AddError();
+	static bool IsReached();
+
+	// returns NoLimit if there is no limit
+	static size_t GetNumRemainingErrors();
+
+	// only needed when a context is reused to compile a new file
+	static void Reset();
+
+private:
+	ErrorLimit();
+	static ErrorLimit& GetInstance();
+
+	size_t m_limit;
+};
@@ -0,0 +1,57 @@
+#include "JsonLinesSink.h"
+#include "DiagnosticsContext.h"
+#include "MessagePrinter.h"
+#include "Util.h"
+
+#include <cstdint>
+
+void JsonLinesSink::SetEnabled(bool enabled) { GetInstance().m_isEnabled = enabled; }
+bool JsonLinesSink::IsEnabled() { return GetInstance().m_isEnabled; }
+
+void JsonLinesSink::Open(const std::string& filepath)
+{
+	if (IsEnabled())
+	{
+		DiagnosticsContext::GetCurrent().m_jsonLinesFile.open(filepath, std::ios_base::trunc);
+	}
+}
+
+void JsonLinesSink::Write(const char* kind, const std::string& code, size_t line, 
+	const std::string& message)
+{
+	std::ofstream& file = DiagnosticsContext::GetCurrent().m_jsonLinesFile;
+	if (!file.is_open())
+	{
+		return;
+	}
+
+	file << "{\"kind\":\"" << kind << "\",\"code\":\"" << EscapeJsonStr(code) << "\",\"line\":";
+	if (line == SIZE_MAX)
+	{
+		file << "null";
+	}
+	else
+	{
+		file << line;
+	}
+
+	// flushed so the records can be read while the file is still being compiled
+	file << ",\"message\":\"" << EscapeJsonStr(message) << "\"}\n" << std::flush;
+}
+
+void JsonLinesSink::Write(const char* kind, const std::string& code, size_t line, 
+	const LazyMessage* message)
+{
+	if (DiagnosticsContext::GetCurrent().m_jsonLinesFile.is_open())
+	{
+		Write(kind, code, line, message->GetText());
+	}
+}
+
+JsonLinesSink::JsonLinesSink() : m_isEnabled(false) { }
+
+JsonLinesSink& JsonLinesSink::GetInstance()
+{
+	static JsonLinesSink sink;
+	return sink;
+}
@@ -0,0 +1,33 @@
+#pragma once
+#include <string>
+#include <cstddef>
+
+class LazyMessage;
+
+// streams the diagnostics reported to the current DiagnosticsContext as JSON Lines, 
+// one record with the kind, code, line and message of a lexical, syntax or semantic 
+// diagnostic written as soon as it is reported
+class JsonLinesSink
+{
+public:
+	static void SetEnabled(bool enabled);
+	static bool IsEnabled();
+
+	// opens the output file of the current context if the sink is enabled, 
+	// the file is closed with the context
+	static void Open(const std::string& filepath);
+
+	// a line of SIZE_MAX is written as null
+	static void Write(const char* kind, const std::string& code, size_t line, 
+		const std::string& message);
+
+	// the message is only formatted if the current context has an open output file
+	static void Write(const char* kind, const std::string& code, size_t line, 
+		const LazyMessage* message);
+
+private:
+	JsonLinesSink();
+	static JsonLinesSink& GetInstance();
+
+	bool m_isEnabled;
+};
@@ -1,49 +1,76 @@
 #include "MessagePrinter.h"
-#include "Util.h"
-#include <iostream>
+#include "DiagnosticsContext.h"
+#include "OutputFiles.h"
 #include <fstream>
+#include <algorithm>
 
 
-void MessagePrinter::AddMessage(size_t line, const std::string& message)
+// LazyMessage ///////////////////////////////////////////////////////////////
+LazyMessage::LazyMessage() : m_isFormatted(false) { }
+LazyMessage::~LazyMessage() { }
+
+const std::string& LazyMessage::GetText() const
 {
-	MessagePrinter& printer = GetInstance();
-	auto it = printer.m_sortedMessageList.begin();
-	for (; it != printer.m_sortedMessageList.end(); it++)
+	if (!m_isFormatted)
 	{
-		if ((*it).first > line)
-		{
-			break;
-		}
+		m_text = Format();
+		m_isFormatted = true;
 	}
-	printer.m_sortedMessageList.insert(it, std::make_pair(line, message));
+	return m_text;
+}
+
+// MessagePrinter ////////////////////////////////////////////////////////////
+void MessagePrinter::AddMessage(size_t line, const std::string& message)
+{
+	DiagnosticsContext::GetCurrent().m_messages.push_back({line, message, nullptr});
+}
+
+void MessagePrinter::AddMessage(size_t line, const LazyMessage* message)
+{
+	DiagnosticsContext::GetCurrent().m_messages.push_back({line, std::string(), message});
 }
 
 void MessagePrinter::PrintToConsole(const std::string& filepathOfOutput)
 {
-	MessagePrinter& printer = GetInstance();
-	std::ofstream outFile = std::ofstream(SimplifyFilename(filepathOfOutput) + ".log");
+	std::vector<DiagnosticsContext::Message>& messages = 
+		DiagnosticsContext::GetCurrent().m_messages;
+
+	// messages on the same line stay in the order they were added
+	std::stable_sort(messages.begin(), messages.end(), 
+		[](const DiagnosticsContext::Message& lhs, const DiagnosticsContext::Message& rhs)
+	{
+		return lhs.m_line < rhs.m_line;
+	});
 
-	for (auto& pair : printer.m_sortedMessageList)
+	std::string output;
+	for (DiagnosticsContext::Message& message : messages)
 	{
-		outFile << pair.second << "\n";
-		std::cout << pair.second << "\n";
+		output += message.m_lazyMessage == nullptr ? message.m_text 
+			: message.m_lazyMessage->GetText();
+		output += '\n';
 	}
 
-	if (printer.m_sortedMessageList.size() > 0)
+	std::ofstream outFile = OutputFiles::Open(filepathOfOutput, Artifact::Log);
+	outFile << output;
+
+	if (GetInstance().m_isConsoleEchoed && messages.size() > 0)
 	{
-		std::cout << "\n\n";
+		DiagnosticsContext::GetCurrent().GetConsole() << output << "\n\n";
 	}
 }
 
 void MessagePrinter::ClearMessages()
 {
-	GetInstance().m_sortedMessageList.clear();
+	DiagnosticsContext::GetCurrent().m_messages.clear();
 }
 
-MessagePrinter::MessagePrinter() { }
+void MessagePrinter::SetConsoleEcho(bool echo) { GetInstance().m_isConsoleEchoed = echo; }
+bool MessagePrinter::IsConsoleEchoed() { return GetInstance().m_isConsoleEchoed; }
+
+MessagePrinter::MessagePrinter() : m_isConsoleEchoed(true) { }
 
 MessagePrinter& MessagePrinter::GetInstance()
 {
 	static MessagePrinter printer;
 	return printer;
-}
\ No newline at end of file
+}
@@ -1,21 +1,44 @@
 #pragma once
 #include "Core.h"
-#include <list>
 #include <string>
-#include <utility>
 
+// a message which is only formatted the first time its text is needed
+class LazyMessage
+{
+public:
+	LazyMessage();
+	virtual ~LazyMessage();
+
+	const std::string& GetText() const;
+
+protected:
+	virtual std::string Format() const = 0;
+
+private:
+	mutable std::string m_text;
+	mutable bool m_isFormatted;
+};
+
+// prints the messages of the current DiagnosticsContext sorted by line
 class MessagePrinter
 {
 public:
 	static void AddMessage(size_t line, const std::string& message);
 
+	// the message is formatted when printed so it must outlive the messages of the context
+	static void AddMessage(size_t line, const LazyMessage* message);
+
+	// writes the messages to the .log file of the output and echoes them to the console 
+	// unless the echo is disabled
 	static void PrintToConsole(const std::string& filepathOfOutput);
 	static void ClearMessages();
 
+	static void SetConsoleEcho(bool echo);
+	static bool IsConsoleEchoed();
+
 private:
 	MessagePrinter();
-
 	static MessagePrinter& GetInstance();
 
-	std::list<std::pair<size_t, std::string>> m_sortedMessageList;
-};
\ No newline at end of file
+	bool m_isConsoleEchoed;
+};
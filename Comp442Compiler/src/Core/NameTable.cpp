@@ -0,0 +1,91 @@
+#include "NameTable.h"
+#include "Core.h"
+
+#include <mutex>
+
+NameID NameTable::GetID(const std::string& str)
+{
+	NameTable& table = GetInstance();
+	{
+		std::shared_lock<std::shared_mutex> readLock(table.m_mutex);
+		auto it = table.m_ids.find(str);
+		if (it != table.m_ids.end())
+		{
+			return it->second;
+		}
+	}
+
+	// the string may have been added by another thread since the lookup
+	std::unique_lock<std::shared_mutex> writeLock(table.m_mutex);
+	auto it = table.m_ids.find(str);
+	if (it != table.m_ids.end())
+	{
+		return it->second;
+	}
+
+	NameID id = table.m_strings.size();
+	table.m_strings.push_back(str);
+	table.m_ids[table.m_strings.back()] = id;
+	return id;
+}
+
+NameID NameTable::FindID(const std::string& str)
+{
+	NameTable& table = GetInstance();
+	std::shared_lock<std::shared_mutex> readLock(table.m_mutex);
+	auto it = table.m_ids.find(str);
+	if (it == table.m_ids.end())
+	{
+		return InvalidNameID;
+	}
+	return it->second;
+}
+
+const std::string& NameTable::GetStr(NameID id)
+{
+	NameTable& table = GetInstance();
+	std::shared_lock<std::shared_mutex> readLock(table.m_mutex);
+	ASSERT(id < table.m_strings.size());
+	return table.m_strings[id];
+}
+
+size_t NameTable::GetNumNames()
+{
+	NameTable& table = GetInstance();
+	std::shared_lock<std::shared_mutex> readLock(table.m_mutex);
+	return table.m_strings.size();
+}
+
+size_t NameTable::GetGeneration()
+{
+	NameTable& table = GetInstance();
+	std::shared_lock<std::shared_mutex> readLock(table.m_mutex);
+	return table.m_generation;
+}
+
+void NameTable::Reset()
+{
+	NameTable& table = GetInstance();
+	std::unique_lock<std::shared_mutex> writeLock(table.m_mutex);
+	table.m_ids.clear();
+	table.m_strings.clear();
+	table.AddEmptyName();
+	table.m_generation++;
+}
+
+NameTable::NameTable() : m_generation(0)
+{
+	AddEmptyName();
+}
+
+NameTable& NameTable::GetInstance()
+{
+	static NameTable table;
+	return table;
+}
+
+void NameTable::AddEmptyName()
+{
+	m_strings.push_back("");
+	m_ids[m_strings.back()] = EmptyNameID;
+}
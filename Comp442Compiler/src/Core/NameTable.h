@@ -0,0 +1,48 @@
+#pragma once
+#include <string>
+#include <string_view>
+#include <deque>
+#include <unordered_map>
+#include <shared_mutex>
+
+typedef size_t NameID;
+
+// interns identifiers and lexemes for the whole compilation so names can be stored 
+// and compared as small integer handles, safe to use from multiple threads
+class NameTable
+{
+public:
+	// returns the handle of the provided string, interning it if needed
+	static NameID GetID(const std::string& str);
+
+	// returns the handle of the provided string or InvalidNameID if it was never interned
+	static NameID FindID(const std::string& str);
+
+	static const std::string& GetStr(NameID id);
+	static size_t GetNumNames();
+
+	// incremented by every reset so the handles kept across compilations can be discarded
+	static size_t GetGeneration();
+
+	// forgets every interned string so a long running process does not keep the names of 
+	// the files it compiled, the handles returned before are invalidated so no compilation 
+	// can be running
+	static void Reset();
+
+	static constexpr NameID EmptyNameID = 0;
+	static constexpr NameID InvalidNameID = SIZE_MAX;
+
+private:
+	NameTable();
+
+	static NameTable& GetInstance();
+
+	// the write lock must be held
+	void AddEmptyName();
+
+	// deque so the string_view keys of the map stay valid when new strings are added
+	std::deque<std::string> m_strings;
+	std::unordered_map<std::string_view, NameID> m_ids;
+	std::shared_mutex m_mutex;
+	size_t m_generation;
+};
@@ -0,0 +1,166 @@
+#include "OutputFiles.h"
+#include "Util.h"
+#include "Core.h"
+
+void OutputFiles::SetDirectory(const std::string& directory) 
+{ 
+	GetInstance().m_directory = directory; 
+}
+
+const std::string& OutputFiles::GetDirectory() { return GetInstance().m_directory; }
+
+void OutputFiles::SetEnabled(Artifact artifact, bool enabled)
+{
+	GetInstance().m_enabledArtifacts.set((size_t)artifact, enabled);
+}
+
+void OutputFiles::SetAllEnabled(bool enabled)
+{
+	if (enabled)
+	{
+		GetInstance().m_enabledArtifacts.set();
+	}
+	else
+	{
+		GetInstance().m_enabledArtifacts.reset();
+	}
+}
+
+bool OutputFiles::IsEnabled(Artifact artifact) 
+{ 
+	return GetInstance().m_enabledArtifacts.test((size_t)artifact); 
+}
+
+bool OutputFiles::FindArtifact(const std::string& name, Artifact& outArtifact)
+{
+	for (size_t i = 0; i < NumArtifacts; i++)
+	{
+		if (name == GetArtifactName((Artifact)i))
+		{
+			outArtifact = (Artifact)i;
+			return true;
+		}
+	}
+	return false;
+}
+
+const char* OutputFiles::GetArtifactName(Artifact artifact)
+{
+	switch (artifact)
+	{
+	case Artifact::LexTokens:
+		return "lextokens";
+
+	case Artifact::LexErrors:
+		return "lexerrors";
+
+	case Artifact::Derivation:
+		return "derivation";
+
+	case Artifact::SyntaxErrors:
+		return "syntaxerrors";
+
+	case Artifact::AST:
+		return "ast";
+
+	case Artifact::SymbolTables:
+		return "symboltables";
+
+	case Artifact::SemanticErrors:
+		return "semanticerrors";
+
+	case Artifact::Log:
+		return "log";
+
+	case Artifact::Moon:
+		return "moon";
+
+	case Artifact::ASTCache:
+		return "astcache";
+
+	default:
+		DEBUG_BREAK();
+		return "";
+	}
+}
+
+std::string OutputFiles::GetFilepath(const std::string& sourceFilepath, 
+	const std::string& extension)
+{
+	std::string simplifiedFilepath = SimplifyFilename(sourceFilepath);
+	const std::string& directory = GetDirectory();
+	if (directory.empty())
+	{
+		return simplifiedFilepath + extension;
+	}
+
+	std::string filename = simplifiedFilepath.substr(
+		simplifiedFilepath.find_last_of("/\\") + 1);
+	return directory + "/" + filename + extension;
+}
+
+std::string OutputFiles::GetFilepath(const std::string& sourceFilepath, Artifact artifact)
+{
+	return GetFilepath(sourceFilepath, GetExtension(artifact));
+}
+
+std::ofstream OutputFiles::Open(const std::string& sourceFilepath, Artifact artifact)
+{
+	if (!IsEnabled(artifact))
+	{
+		return std::ofstream();
+	}
+	return std::ofstream(GetFilepath(sourceFilepath, artifact));
+}
+
+OutputFiles::OutputFiles() 
+{ 
+	m_enabledArtifacts.set(); 
+	m_enabledArtifacts.reset((size_t)Artifact::ASTCache);
+}
+
+OutputFiles& OutputFiles::GetInstance()
+{
+	static OutputFiles outputFiles;
+	return outputFiles;
+}
+
+const char* OutputFiles::GetExtension(Artifact artifact)
+{
+	switch (artifact)
+	{
+	case Artifact::LexTokens:
+		return ".outlextokens";
+
+	case Artifact::LexErrors:
+		return ".outlexerrors";
+
+	case Artifact::Derivation:
+		return ".outderivation";
+
+	case Artifact::SyntaxErrors:
+		return ".outsyntaxerrors";
+
+	case Artifact::AST:
+		return ".astout";
+
+	case Artifact::SymbolTables:
+		return ".outsymboltables";
+
+	case Artifact::SemanticErrors:
+		return ".outsemanticerrors";
+
+	case Artifact::Log:
+		return ".log";
+
+	case Artifact::Moon:
+		return ".moon";
+
+	case Artifact::ASTCache:
+		return ".astcache";
+
+	default:
+		DEBUG_BREAK();
+		return "";
+	}
+}
@@ -0,0 +1,58 @@
+#pragma once
+#include <string>
+#include <fstream>
+#include <bitset>
+
+// files written for every compiled source file
+enum class Artifact
+{
+	LexTokens,
+	LexErrors,
+	Derivation,
+	SyntaxErrors,
+	AST,
+	SymbolTables,
+	SemanticErrors,
+	Log,
+	Moon,
+
+	// binary AST reused by the next compilations of an unchanged source file
+	ASTCache
+};
+
+// decides where the output files of a source file are written and which of them are written
+class OutputFiles
+{
+public:
+	// an empty directory writes the outputs next to their source file
+	static void SetDirectory(const std::string& directory);
+	static const std::string& GetDirectory();
+
+	// every artifact except the AST cache is enabled by default
+	static void SetEnabled(Artifact artifact, bool enabled);
+	static void SetAllEnabled(bool enabled);
+	static bool IsEnabled(Artifact artifact);
+
+	// returns false if the name does not match the name of an artifact
+	static bool FindArtifact(const std::string& name, Artifact& outArtifact);
+	static const char* GetArtifactName(Artifact artifact);
+
+	// the extension of the source file is replaced by the provided extension
+	static std::string GetFilepath(const std::string& sourceFilepath, 
+		const std::string& extension);
+	static std::string GetFilepath(const std::string& sourceFilepath, Artifact artifact);
+
+	// the returned stream is left closed if the artifact is disabled so nothing is written to it
+	static std::ofstream Open(const std::string& sourceFilepath, Artifact artifact);
+
+	static constexpr size_t NumArtifacts = (size_t)Artifact::ASTCache + 1;
+
+private:
+	OutputFiles();
+	static OutputFiles& GetInstance();
+
+	static const char* GetExtension(Artifact artifact);
+
+	std::string m_directory;
+	std::bitset<NumArtifacts> m_enabledArtifacts;
+};
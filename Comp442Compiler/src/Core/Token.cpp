@@ -410,12 +410,31 @@ std::string TokenTypeToStr(TokenType t)
 
 // Token ////////////////////////////////////////////////////////////////
 
-Token::Token() : m_type(TokenType::None), m_line(0) { }
+Token::Token() : m_type(TokenType::None), m_lexemeID(NameTable::InvalidNameID), m_lexeme(), 
+	m_line(0) { }
 
 Token::Token(const std::string& lexeme, TokenType type, size_t line) 
-	: m_lexeme(lexeme), m_type(type), m_line(line) { }
+	: m_type(type), m_lexemeID(NameTable::InvalidNameID), m_lexeme(), m_line(line) 
+{ 
+	if (IsInterned(type))
+	{
+		m_lexemeID = NameTable::GetID(lexeme);
+	}
+	else
+	{
+		m_lexeme = lexeme;
+	}
+}
+
+Token::Token(const Token& token, size_t line) : m_type(token.m_type), 
+	m_lexemeID(token.m_lexemeID), m_lexeme(token.m_lexeme), m_line(line) { }
 
-const std::string& Token::GetLexeme() const { return m_lexeme; }
+const std::string& Token::GetLexeme() const 
+{ 
+	return m_lexemeID == NameTable::InvalidNameID ? m_lexeme : NameTable::GetStr(m_lexemeID); 
+}
+
+NameID Token::GetLexemeID() const { return m_lexemeID; }
 TokenType Token::GetTokenType() const { return m_type; }
 size_t Token::GetLine() const { return m_line; }
 
@@ -429,6 +448,11 @@ std::string Token::GetStrOfLine() const
 	return TrimStr(l.m_lineBuffer.str());
 }
 
+bool Token::IsInterned(TokenType type)
+{
+	return type == TokenType::ID || (type >= TokenType::Or && type <= TokenType::Private);
+}
+
 bool Token::IsError() const
 {
 	return m_type == TokenType::InvalidCharacter || m_type == TokenType::InvalidNumber 
@@ -1,6 +1,7 @@
 #pragma once
 #include <iostream>
 #include <string>
+#include "NameTable.h"
 
 enum class TokenType
 {
@@ -82,7 +83,13 @@ public:
 	Token();
 	Token(const std::string& lexeme, TokenType type, size_t line);
 
+	// copies the token without interning its lexeme again
+	Token(const Token& token, size_t line);
+
 	const std::string& GetLexeme() const;
+
+	// returns InvalidNameID for the tokens which are not identifiers or keywords
+	NameID GetLexemeID() const;
 	TokenType GetTokenType() const;
 	size_t GetLine() const;
 	std::string GetStrOfLine() const;
@@ -90,7 +97,12 @@ public:
 	bool IsError() const;
 
 private:
+	// only identifiers and keywords are interned, the other lexemes (literals, comments, ...)
+	// are kept by their token so they do not stay in the name table for the whole program
+	static bool IsInterned(TokenType type);
+
 	TokenType m_type;
+	NameID m_lexemeID;
 	std::string m_lexeme;
 	size_t m_line;
 };
@@ -5,6 +5,7 @@
 
 #include <sstream>
 #include <bitset>
+#include <cstdio>
 
 std::string SimplifyFilename(const std::string& filepath)
 {
@@ -41,6 +42,51 @@ std::string TrimStr(const std::string& str)
 	return RightTrimStr(LeftTrimStr(str));
 }
 
+std::string EscapeJsonStr(const std::string& str)
+{
+	std::string escaped;
+	escaped.reserve(str.length());
+	for (char c : str)
+	{
+		switch (c)
+		{
+		case '"':
+			escaped += "\\\"";
+			break;
+
+		case '\\':
+			escaped += "\\\\";
+			break;
+
+		case '\n':
+			escaped += "\\n";
+			break;
+
+		case '\r':
+			escaped += "\\r";
+			break;
+
+		case '\t':
+			escaped += "\\t";
+			break;
+
+		default:
+			if ((unsigned char)c < 0x20)
+			{
+				char buffer[8];
+				std::snprintf(buffer, sizeof(buffer), "\\u%04x", (unsigned int)c);
+				escaped += buffer;
+			}
+			else
+			{
+				escaped += c;
+			}
+			break;
+		}
+	}
+	return escaped;
+}
+
 void FloatToRepresentationStr(const std::string& floatStr, std::string& outMantissa, std::string& outExponent)
 {
 	size_t dotPos = floatStr.find(".");
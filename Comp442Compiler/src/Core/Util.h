@@ -8,6 +8,10 @@ std::string LeftTrimStr(const std::string& str);
 std::string RightTrimStr(const std::string& str);
 std::string TrimStr(const std::string& str);
 
+// escapes the quotes, backslashes and control characters so the string can be 
+// written between quotes in a JSON document
+std::string EscapeJsonStr(const std::string& str);
+
 void FloatToRepresentationStr(const std::string& floatStr, std::string& outMantissa, std::string& outExponent);
 
 // generates tags for memory addresses or temporary variables
@@ -0,0 +1,24 @@
+#include "WorkerThreads.h"
+
+#include <thread>
+#include <algorithm>
+
+void WorkerThreads::SetNumConcurrentFiles(size_t numFiles)
+{
+	GetInstance().m_numConcurrentFiles = std::max(numFiles, (size_t)1);
+}
+
+size_t WorkerThreads::GetNumThreads(size_t numTasks)
+{
+	size_t numHardwareThreads = std::max((size_t)std::thread::hardware_concurrency(), (size_t)1);
+	size_t numThreads = numHardwareThreads / GetInstance().m_numConcurrentFiles;
+	return std::max(std::min(numTasks, numThreads), (size_t)1);
+}
+
+WorkerThreads::WorkerThreads() : m_numConcurrentFiles(1) { }
+
+WorkerThreads& WorkerThreads::GetInstance()
+{
+	static WorkerThreads workerThreads;
+	return workerThreads;
+}
@@ -0,0 +1,22 @@
+#pragma once
+#include <cstddef>
+
+// shares the hardware threads between the files compiled at the same time so the files 
+// parsing or checking their definitions concurrently do not start more threads than the 
+// hardware can run
+class WorkerThreads
+{
+public:
+	// the files are compiled one at a time unless a number of jobs is provided
+	static void SetNumConcurrentFiles(size_t numFiles);
+
+	// returns the number of threads a file can use to run the provided number of tasks, 
+	// at least one thread is always returned
+	static size_t GetNumThreads(size_t numTasks);
+
+private:
+	WorkerThreads();
+	static WorkerThreads& GetInstance();
+
+	size_t m_numConcurrentFiles;
+};
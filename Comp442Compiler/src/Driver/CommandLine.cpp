@@ -0,0 +1,501 @@
+#include "CommandLine.h"
+#include "../Parser/Parser.h"
+#include "../SemanticChecking/Visitor.h"
+#include "../Core/MessagePrinter.h"
+#include "../Core/ErrorLimit.h"
+#include "../Core/JsonLinesSink.h"
+#include "../Core/OutputFiles.h"
+#include "../Core/WorkerThreads.h"
+
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <filesystem>
+#include <algorithm>
+#include <thread>
+#include <cctype>
+#include <cstdlib>
+
+// response files can include other response files up to this depth so a file
+// including itself is reported instead of expanded forever
+constexpr size_t MaxResponseFileDepth = 8;
+
+CommandLineOptions::CommandLineOptions() : m_mode(CompileMode::Full), m_inputs(),
+	m_numJobs(0), m_isInteractive(true), m_showHelp(false), m_isServer(false), 
+	m_serverSocketPath(), m_generatedParserPath() { }
+
+// Arguments ////////////////////////////////////////////////////////////////
+
+bool ReadResponseFile(const std::string& filepath, size_t depth, 
+	std::vector<std::string>& outArgs, std::ostream& errors);
+
+bool ExpandArg(const std::string& arg, size_t depth, std::vector<std::string>& outArgs, 
+	std::ostream& errors)
+{
+	if (arg.size() < 2 || arg[0] != '@')
+	{
+		outArgs.push_back(arg);
+		return true;
+	}
+
+	if (depth >= MaxResponseFileDepth)
+	{
+		errors << "Response file \"" << arg.substr(1) << "\" is nested more than "
+			<< MaxResponseFileDepth << " levels deep\n";
+		return false;
+	}
+	return ReadResponseFile(arg.substr(1), depth + 1, outArgs, errors);
+}
+
+// arguments are separated by whitespaces, can be quoted with double quotes and
+// everything following a # up to the end of the line is ignored
+bool SplitArgs(const std::string& content, const std::string& source, size_t depth, 
+	std::vector<std::string>& outArgs, std::ostream& errors)
+{
+	size_t i = 0;
+	while (i < content.size())
+	{
+		char c = content[i];
+		if (std::isspace((unsigned char)c))
+		{
+			i++;
+		}
+		else if (c == '#')
+		{
+			while (i < content.size() && content[i] != '\n')
+			{
+				i++;
+			}
+		}
+		else
+		{
+			std::string arg;
+			bool isQuoted = false;
+			while (i < content.size() && (isQuoted || !std::isspace((unsigned char)content[i])))
+			{
+				if (content[i] == '"')
+				{
+					isQuoted = !isQuoted;
+				}
+				else
+				{
+					arg += content[i];
+				}
+				i++;
+			}
+
+			if (isQuoted)
+			{
+				errors << source << " has an unterminated quote\n";
+				return false;
+			}
+
+			if (!ExpandArg(arg, depth, outArgs, errors))
+			{
+				return false;
+			}
+		}
+	}
+	return true;
+}
+
+bool ReadResponseFile(const std::string& filepath, size_t depth, 
+	std::vector<std::string>& outArgs, std::ostream& errors)
+{
+	std::ifstream file(filepath);
+	if (!file.is_open())
+	{
+		errors << "Response file \"" << filepath << "\" could not be opened\n";
+		return false;
+	}
+
+	std::stringstream ss;
+	ss << file.rdbuf();
+	return SplitArgs(ss.str(), "Response file \"" + filepath + "\"", depth, outArgs, errors);
+}
+
+bool ParseCount(const std::string& option, const std::string& value, size_t& outCount)
+{
+	if (value.empty() || !std::all_of(value.begin(), value.end(),
+		[](char c) { return std::isdigit((unsigned char)c) != 0; }))
+	{
+		std::cerr << "Option \"" << option << "\" expects a number instead of \""
+			<< value << "\"\n";
+		return false;
+	}
+	outCount = (size_t)std::strtoull(value.c_str(), nullptr, 10);
+	return true;
+}
+
+// Inputs ///////////////////////////////////////////////////////////////////
+
+// * matches any sequence of characters and ? matches a single character
+bool MatchesWildcard(const std::string& pattern, const std::string& name)
+{
+	size_t p = 0;
+	size_t n = 0;
+	size_t starPos = std::string::npos;
+	size_t starMatch = 0;
+	while (n < name.size())
+	{
+		if (p < pattern.size() && (pattern[p] == '?' || pattern[p] == name[n]))
+		{
+			p++;
+			n++;
+		}
+		else if (p < pattern.size() && pattern[p] == '*')
+		{
+			starPos = p++;
+			starMatch = n;
+		}
+		else if (starPos != std::string::npos)
+		{
+			p = starPos + 1;
+			n = ++starMatch;
+		}
+		else
+		{
+			return false;
+		}
+	}
+
+	while (p < pattern.size() && pattern[p] == '*')
+	{
+		p++;
+	}
+	return p == pattern.size();
+}
+
+// the files of a directory or matching a pattern are added in alphabetical order
+// so the outputs do not depend on the order of the file system
+bool AddInput(const std::string& input, std::vector<std::string>& outInputs, 
+	std::ostream& errors)
+{
+	std::error_code error;
+	if (std::filesystem::is_directory(input, error))
+	{
+		std::vector<std::string> filepaths;
+		for (auto& file : std::filesystem::directory_iterator(input, error))
+		{
+			if (file.is_regular_file(error) && file.path().extension() == ".src")
+			{
+				filepaths.push_back(file.path().generic_string());
+			}
+		}
+		std::sort(filepaths.begin(), filepaths.end());
+		outInputs.insert(outInputs.end(), filepaths.begin(), filepaths.end());
+		return true;
+	}
+
+	size_t filenameStart = input.find_last_of("/\\") + 1;
+	if (input.find_first_of("*?", filenameStart) == std::string::npos)
+	{
+		if (!std::filesystem::is_regular_file(input, error))
+		{
+			errors << "Input file \"" << input << "\" could not be found\n";
+			return false;
+		}
+		outInputs.push_back(input);
+		return true;
+	}
+
+	// only the filename can hold wildcards
+	std::string directory = filenameStart == 0 ? "." : input.substr(0, filenameStart - 1);
+	std::string pattern = input.substr(filenameStart);
+	if (directory.find_first_of("*?") != std::string::npos)
+	{
+		errors << "Input \"" << input << "\" can only have wildcards in its filename\n";
+		return false;
+	}
+
+	std::vector<std::string> filepaths;
+	for (auto& file : std::filesystem::directory_iterator(directory, error))
+	{
+		std::string filename = file.path().filename().generic_string();
+		if (file.is_regular_file(error) && MatchesWildcard(pattern, filename))
+		{
+			filepaths.push_back(input.substr(0, filenameStart) + filename);
+		}
+	}
+
+	if (filepaths.empty())
+	{
+		errors << "Input \"" << input << "\" does not match any file\n";
+		return false;
+	}
+	std::sort(filepaths.begin(), filepaths.end());
+	outInputs.insert(outInputs.end(), filepaths.begin(), filepaths.end());
+	return true;
+}
+
+// a comma separated list of artifacts, "all" or "none"
+bool ParseArtifacts(const std::string& list)
+{
+	OutputFiles::SetAllEnabled(false);
+	std::stringstream ss(list);
+	std::string name;
+	while (std::getline(ss, name, ','))
+	{
+		Artifact artifact;
+		if (name == "all")
+		{
+			OutputFiles::SetAllEnabled(true);
+		}
+		else if (name == "none")
+		{
+			OutputFiles::SetAllEnabled(false);
+		}
+		else if (OutputFiles::FindArtifact(name, artifact))
+		{
+			OutputFiles::SetEnabled(artifact, true);
+		}
+		else
+		{
+			std::cerr << "Unknown artifact \"" << name << "\"\n";
+			return false;
+		}
+	}
+	return true;
+}
+
+// Command line /////////////////////////////////////////////////////////////
+
+bool ParseCommandLine(int argc, char* argv[], CommandLineOptions& outOptions)
+{
+	std::vector<std::string> args;
+	for (int i = 1; i < argc; i++)
+	{
+		if (!ExpandArg(argv[i], 0, args, std::cerr))
+		{
+			return false;
+		}
+	}
+
+	// applied once every option is parsed so --emit does not disable it
+	bool isASTCacheEnabled = false;
+	for (size_t i = 0; i < args.size(); i++)
+	{
+		const std::string& arg = args[i];
+
+		// options followed by a value
+		if (arg == "-j" || arg == "--error-limit" || arg == "-o" || arg == "--output-dir"
+			|| arg == "--emit" || arg == "--server-socket" || arg == "--parser" 
+			|| arg == "--generate-parser")
+		{
+			if (i + 1 >= args.size())
+			{
+				std::cerr << "Option \"" << arg << "\" expects a value\n";
+				return false;
+			}
+			const std::string& value = args[++i];
+
+			if (arg == "-j")
+			{
+				if (!ParseCount(arg, value, outOptions.m_numJobs))
+				{
+					return false;
+				}
+
+				// 0 jobs uses one job per hardware thread
+				if (outOptions.m_numJobs == 0)
+				{
+					outOptions.m_numJobs = std::max((size_t)std::thread::hardware_concurrency(),
+						(size_t)1);
+				}
+				WorkerThreads::SetNumConcurrentFiles(outOptions.m_numJobs);
+			}
+			else if (arg == "--error-limit")
+			{
+				size_t limit;
+				if (!ParseCount(arg, value, limit))
+				{
+					return false;
+				}
+				ErrorLimit::SetLimit(limit);
+			}
+			else if (arg == "--server-socket")
+			{
+				outOptions.m_isServer = true;
+				outOptions.m_serverSocketPath = value;
+			}
+			else if (arg == "--parser")
+			{
+				if (value == "table")
+				{
+					Parser::SetBackend(ParserBackend::TableDriven);
+				}
+				else if (value == "recursive-descent")
+				{
+					Parser::SetBackend(ParserBackend::RecursiveDescent);
+				}
+				else
+				{
+					std::cerr << "Unknown parser \"" << value << "\"\n";
+					return false;
+				}
+			}
+			else if (arg == "--generate-parser")
+			{
+				outOptions.m_generatedParserPath = value;
+			}
+			else if (arg == "--emit")
+			{
+				if (!ParseArtifacts(value))
+				{
+					return false;
+				}
+			}
+			else
+			{
+				std::error_code error;
+				std::filesystem::create_directories(value, error);
+				if (error)
+				{
+					std::cerr << "Output directory \"" << value << "\" could not be created: "
+						<< error.message() << "\n";
+					return false;
+				}
+				OutputFiles::SetDirectory(value);
+			}
+		}
+		else if (arg == "--parse-only")
+		{
+			outOptions.m_mode = CompileMode::ParseOnly;
+		}
+		else if (arg == "--check-only")
+		{
+			outOptions.m_mode = CompileMode::CheckOnly;
+		}
+		else if (arg == "--parallel-parse")
+		{
+			Parser::SetParallel(true);
+		}
+		else if (arg == "--incremental")
+		{
+			Parser::SetIncremental(true);
+		}
+		else if (arg == "--parallel-check")
+		{
+			SemanticChecker::SetParallel(true);
+		}
+		else if (arg == "--quiet")
+		{
+			// the messages are still written to the .log files
+			MessagePrinter::SetConsoleEcho(false);
+		}
+		else if (arg == "--json-diagnostics")
+		{
+			JsonLinesSink::SetEnabled(true);
+		}
+		else if (arg == "--server")
+		{
+			outOptions.m_isServer = true;
+		}
+		else if (arg == "--ast-cache")
+		{
+			isASTCacheEnabled = true;
+		}
+		else if (arg == "--non-interactive")
+		{
+			outOptions.m_isInteractive = false;
+		}
+		else if (arg == "-h" || arg == "--help")
+		{
+			outOptions.m_showHelp = true;
+		}
+		else if (arg.size() > 1 && arg[0] == '-')
+		{
+			std::cerr << "Unknown option \"" << arg << "\"\n";
+			return false;
+		}
+		else if (!AddInput(arg, outOptions.m_inputs, std::cerr))
+		{
+			return false;
+		}
+	}
+
+	if (isASTCacheEnabled)
+	{
+		OutputFiles::SetEnabled(Artifact::ASTCache, true);
+	}
+
+	if (outOptions.m_isServer && !outOptions.m_inputs.empty())
+	{
+		std::cerr << "Inputs are sent to the server after it is started instead of being "
+			<< "provided on its command line\n";
+		return false;
+	}
+	return true;
+}
+
+bool ParseRequestInputs(const std::string& request, std::vector<std::string>& outInputs, 
+	std::ostream& errors)
+{
+	std::vector<std::string> args;
+	if (!SplitArgs(request, "Request", 0, args, errors))
+	{
+		return false;
+	}
+
+	for (const std::string& arg : args)
+	{
+		if (arg.size() > 1 && arg[0] == '-')
+		{
+			errors << "Option \"" << arg << "\" can only be provided when the server is started\n";
+			return false;
+		}
+
+		if (!AddInput(arg, outInputs, errors))
+		{
+			return false;
+		}
+	}
+	return true;
+}
+
+void PrintUsage(const std::string& programName)
+{
+	std::cout << "Usage: " << programName << " [options] [inputs...] [@responsefile]\n"
+		<< "\n"
+		<< "Inputs are .src files, directories of .src files or patterns using * and ? in\n"
+		<< "their filename. The TestFiles directory is compiled if no input is provided.\n"
+		<< "\n"
+		<< "Options:\n"
+		<< "  -o, --output-dir DIR   write the output files to DIR instead of next to the sources\n"
+		<< "  --emit LIST            comma separated output files to write, \"all\" or \"none\":\n"
+		<< "                         ";
+	for (size_t i = 0; i < OutputFiles::NumArtifacts; i++)
+	{
+		std::cout << (i == 0 ? "" : ",") << OutputFiles::GetArtifactName((Artifact)i);
+	}
+	std::cout << "\n"
+		<< "  --ast-cache            reuse the AST of unchanged files, only used when no output\n"
+		<< "                         file of the lexer or the parser is emitted\n"
+		<< "  --parse-only           stop after parsing\n"
+		<< "  --check-only           stop after semantic checking\n"
+		<< "  --parallel-parse       parse the classes and the functions concurrently, files\n"
+		<< "                         with syntax errors are parsed again sequentially to\n"
+		<< "                         report the errors\n"
+		<< "  --incremental          keep the AST and the derivation of the classes and the\n"
+		<< "                         functions of a file and only parse again the ones which\n"
+		<< "                         changed the next time the file is compiled, the file is\n"
+		<< "                         still lexed, always enabled by the server\n"
+		<< "  --parser NAME          parse with the \"table\" driven parser (default) or the\n"
+		<< "                         \"recursive-descent\" parser generated from the grammar\n"
+		<< "  --generate-parser FILE write the recursive descent parser generated from the\n"
+		<< "                         grammar to FILE and exit\n"
+		<< "  --parallel-check       check the functions concurrently\n"
+		<< "  -j N                   compile N files concurrently, 0 uses every hardware thread\n"
+		<< "  --error-limit N        stop compiling a file after N errors\n"
+		<< "  --quiet                only write the messages to the .log files\n"
+		<< "  --json-diagnostics     also write the diagnostics as JSON Lines\n"
+		<< "  --non-interactive      do not wait for enter before exiting\n"
+		<< "  --server               compile the inputs of every line read from stdin with\n"
+		<< "                         the tables kept in memory until --shutdown is read\n"
+		<< "  --server-socket PATH   same as --server but reads the lines from the\n"
+		<< "                         connections made to a local socket\n"
+		<< "  -h, --help             print this message\n"
+		<< "\n"
+		<< "The exit code is 0 on success, 1 if a file had errors and 2 if the command line\n"
+		<< "is invalid.\n";
+}
@@ -0,0 +1,54 @@
+#pragma once
+#include <string>
+#include <vector>
+#include <ostream>
+#include <cstddef>
+
+// the phase after which the compilation of a file stops
+enum class CompileMode
+{
+	Full,
+	ParseOnly,
+	CheckOnly
+};
+
+// options of the compiler that are not stored by the module they configure
+struct CommandLineOptions
+{
+	CommandLineOptions();
+
+	CompileMode m_mode;
+
+	// source files in the order they were provided, the TestFiles directory is compiled
+	// if no input is provided
+	std::vector<std::string> m_inputs;
+
+	// the files are compiled one after the other without a summary unless a number of
+	// jobs is provided
+	size_t m_numJobs;
+
+	// waits for enter before exiting when the TestFiles directory is compiled
+	bool m_isInteractive;
+	bool m_showHelp;
+
+	// compiles the inputs of the requests sent to the server instead, the requests are
+	// read from stdin unless a socket path is provided
+	bool m_isServer;
+	std::string m_serverSocketPath;
+
+	// writes the recursive descent parser generated from the grammar to this file instead 
+	// of compiling the inputs if it is not empty
+	std::string m_generatedParserPath;
+};
+
+// the options configuring another module (parser, semantic checker, output files, ...)
+// are applied while parsing, returns false and prints the reason to std::cerr if
+// the command line is invalid
+bool ParseCommandLine(int argc, char* argv[], CommandLineOptions& outOptions);
+
+// expands the inputs of a request sent to the compile server like the inputs of the command 
+// line, returns false and writes the reason to the stream if the request is invalid
+bool ParseRequestInputs(const std::string& request, std::vector<std::string>& outInputs, 
+	std::ostream& errors);
+
+void PrintUsage(const std::string& programName);
@@ -0,0 +1,255 @@
+#include "CompileServer.h"
+#include "CommandLine.h"
+#include "../Lexer/Lexer.h"
+#include "../Parser/Parser.h"
+
+#include <iostream>
+#include <sstream>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <unordered_set>
+
+// unix domain sockets are not available to every windows build
+#ifndef _WIN32
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+#include <unistd.h>
+#include <csignal>
+#include <cstring>
+#include <cerrno>
+#endif
+
+// starts the line ending the response of every request so clients know when to stop reading
+constexpr const char* ResponseEndPrefix = "@end";
+constexpr const char* ShutdownRequest = "--shutdown";
+
+// Requests /////////////////////////////////////////////////////////////////
+
+bool CompileServer::HandleRequest(const std::string& request,
+	const CompileRequestHandler& handler, std::ostream& out)
+{
+	// blank lines and comments do not get a response
+	size_t requestStart = request.find_first_not_of(" \t\r");
+	if (requestStart == std::string::npos || request[requestStart] == '#')
+	{
+		return true;
+	}
+	size_t requestEnd = request.find_last_not_of(" \t\r") + 1;
+	std::string trimmedRequest = request.substr(requestStart, requestEnd - requestStart);
+
+	if (trimmedRequest == ShutdownRequest)
+	{
+		out << ResponseEndPrefix << " shutdown\n";
+		return false;
+	}
+
+	std::vector<std::string> filepaths;
+	if (!ParseRequestInputs(trimmedRequest, filepaths, out))
+	{
+		out << ResponseEndPrefix << " error\n";
+		return true;
+	}
+
+	size_t numFailedFiles = handler(filepaths, out);
+	out << ResponseEndPrefix << " files=" << filepaths.size() << " failed=" << numFailedFiles
+		<< "\n";
+	return true;
+}
+
+// Stdin ////////////////////////////////////////////////////////////////////
+
+int CompileServer::ServeStdin(const CompileRequestHandler& handler)
+{
+	Lexer::InitializeTables();
+	Parser::InitializeTables();
+
+	std::string request;
+	while (std::getline(std::cin, request))
+	{
+		bool isRunning = HandleRequest(request, handler, std::cout);
+		std::cout.flush();
+		if (!isRunning)
+		{
+			break;
+		}
+	}
+	return 0;
+}
+
+// Socket ///////////////////////////////////////////////////////////////////
+
+#ifndef _WIN32
+
+// returns false if the connection was closed by the client
+bool SendAll(int connection, const std::string& data)
+{
+	size_t numSent = 0;
+	while (numSent < data.size())
+	{
+		ssize_t result = send(connection, data.data() + numSent, data.size() - numSent, 0);
+		if (result <= 0)
+		{
+			return false;
+		}
+		numSent += (size_t)result;
+	}
+	return true;
+}
+
+int CompileServer::ServeSocket(const std::string& socketPath,
+	const CompileRequestHandler& handler)
+{
+	sockaddr_un address;
+	std::memset(&address, 0, sizeof(address));
+	address.sun_family = AF_UNIX;
+	if (socketPath.size() >= sizeof(address.sun_path))
+	{
+		std::cerr << "Socket path \"" << socketPath << "\" is too long\n";
+		return 2;
+	}
+	std::memcpy(address.sun_path, socketPath.c_str(), socketPath.size());
+
+	// a socket file left by a server which did not stop properly is replaced, any other 
+	// file is kept since the path may have been provided by mistake
+	struct stat pathStatus;
+	if (lstat(socketPath.c_str(), &pathStatus) == 0)
+	{
+		if (!S_ISSOCK(pathStatus.st_mode))
+		{
+			std::cerr << "\"" << socketPath << "\" already exists and is not a socket\n";
+			return 1;
+		}
+		unlink(socketPath.c_str());
+	}
+
+	int server = socket(AF_UNIX, SOCK_STREAM, 0);
+	if (server < 0)
+	{
+		std::cerr << "Socket could not be created: " << std::strerror(errno) << "\n";
+		return 1;
+	}
+
+	if (bind(server, (sockaddr*)&address, sizeof(address)) < 0 || listen(server, 8) < 0)
+	{
+		std::cerr << "Socket \"" << socketPath << "\" could not be bound: "
+			<< std::strerror(errno) << "\n";
+		close(server);
+		return 1;
+	}
+
+	// a client closing its connection before reading its response must not stop the server
+	std::signal(SIGPIPE, SIG_IGN);
+
+	Lexer::InitializeTables();
+	Parser::InitializeTables();
+	std::cout << "Listening on \"" << socketPath << "\"" << std::endl;
+
+	// every connection is served on its own thread so a client keeping its connection 
+	// open does not block the others, a shutdown closes the connections still open
+	std::mutex mutex;
+	std::condition_variable connectionClosed;
+	std::unordered_set<int> openConnections;
+	bool isRunning = true;
+
+	auto stopServing = [&]()
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+		isRunning = false;
+		for (int connection : openConnections)
+		{
+			shutdown(connection, SHUT_RDWR);
+		}
+		// wakes up the accept of the server thread
+		shutdown(server, SHUT_RDWR);
+	};
+
+	auto serveConnection = [&](int connection)
+	{
+		// requests can be split across reads so only complete lines are handled
+		std::string pendingData;
+		char buffer[4096];
+		ssize_t numRead;
+		bool isConnectionOpen = true;
+		while (isConnectionOpen && (numRead = recv(connection, buffer, sizeof(buffer), 0)) > 0)
+		{
+			pendingData.append(buffer, (size_t)numRead);
+
+			size_t lineEnd;
+			while (isConnectionOpen && (lineEnd = pendingData.find('\n')) != std::string::npos)
+			{
+				std::string request = pendingData.substr(0, lineEnd);
+				pendingData.erase(0, lineEnd + 1);
+
+				std::stringstream response;
+				bool isShutdown = !HandleRequest(request, handler, response);
+				isConnectionOpen = SendAll(connection, response.str()) && !isShutdown;
+				if (isShutdown)
+				{
+					stopServing();
+				}
+			}
+		}
+
+		std::lock_guard<std::mutex> lock(mutex);
+		openConnections.erase(connection);
+		close(connection);
+		connectionClosed.notify_one();
+	};
+
+	while (true)
+	{
+		int connection = accept(server, nullptr, nullptr);
+		int acceptError = errno;
+		std::lock_guard<std::mutex> lock(mutex);
+		if (!isRunning)
+		{
+			if (connection >= 0)
+			{
+				close(connection);
+			}
+			break;
+		}
+
+		if (connection < 0)
+		{
+			if (acceptError == EINTR)
+			{
+				continue;
+			}
+			std::cerr << "Connection could not be accepted: " << std::strerror(acceptError) 
+				<< "\n";
+			isRunning = false;
+			for (int openConnection : openConnections)
+			{
+				shutdown(openConnection, SHUT_RDWR);
+			}
+			break;
+		}
+
+		openConnections.insert(connection);
+		std::thread(serveConnection, connection).detach();
+	}
+
+	// the threads serving the connections use the state of this function
+	std::unique_lock<std::mutex> lock(mutex);
+	connectionClosed.wait(lock, [&openConnections]() { return openConnections.empty(); });
+	lock.unlock();
+
+	close(server);
+	unlink(socketPath.c_str());
+	return 0;
+}
+
+#else
+
+int CompileServer::ServeSocket(const std::string& socketPath,
+	const CompileRequestHandler& handler)
+{
+	std::cerr << "Socket \"" << socketPath << "\" cannot be served by this build, use --server "
+		<< "to read the requests from stdin instead\n";
+	return 2;
+}
+
+#endif
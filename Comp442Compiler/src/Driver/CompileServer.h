@@ -0,0 +1,34 @@
+#pragma once
+#include <string>
+#include <vector>
+#include <ostream>
+#include <functional>
+#include <cstddef>
+
+// compiles the files of a request and writes their console output to the stream,
+// returns the number of files with errors
+using CompileRequestHandler =
+	std::function<size_t(const std::vector<std::string>& filepaths, std::ostream& out)>;
+
+// compiles the files requested one line at a time so the lexical table, the parsing table, 
+// the rules and the sets are only built once for every request.
+// a request holds the inputs to compile separated by whitespaces and its response is
+// the console output of every file followed by an end line. "--shutdown" stops the server
+class CompileServer
+{
+public:
+	// serves the lines read from stdin on the calling thread until the end of the input or 
+	// a shutdown, returns the exit code of the program
+	static int ServeStdin(const CompileRequestHandler& handler);
+
+	// serves every connection made to a unix domain socket on its own thread until a 
+	// shutdown, so the handler can be called from several threads at the same time. the 
+	// socket file is removed when the server stops and the server fails if the path is 
+	// already used by a file which is not a socket
+	static int ServeSocket(const std::string& socketPath, const CompileRequestHandler& handler);
+
+private:
+	// returns false if the request is a shutdown
+	static bool HandleRequest(const std::string& request, const CompileRequestHandler& handler,
+		std::ostream& out);
+};
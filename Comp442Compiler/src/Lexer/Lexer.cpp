@@ -2,6 +2,9 @@
 #include "../Core/Core.h"
 #include "../Core/Util.h"
 #include "../Core/MessagePrinter.h"
+#include "../Core/ErrorLimit.h"
+#include "../Core/JsonLinesSink.h"
+#include "../Core/OutputFiles.h"
 #include <string.h>
 #include <iostream>
 
@@ -233,12 +236,11 @@ void Lexer::SetInputFile(const std::string& filepath)
 {
 	Lexer& l = GetInstance();
 	l.m_inputFile = std::ifstream(filepath, std::ios_base::in);
-	std::string simplifiedName = SimplifyFilename(filepath);
 	l.m_lexOutFile.close();
 	l.m_lexErrFile.close();
 
-	l.m_lexOutFile = std::ofstream(simplifiedName + ".outlextokens");
-	l.m_lexErrFile = std::ofstream(simplifiedName + ".outlexerrors");
+	l.m_lexOutFile = OutputFiles::Open(filepath, Artifact::LexTokens);
+	l.m_lexErrFile = OutputFiles::Open(filepath, Artifact::LexErrors);
 
 	l.m_lineCounter = 1;
 	l.m_multiLineCommentsOpened = 0;
@@ -249,6 +251,32 @@ void Lexer::SetInputFile(const std::string& filepath)
 	l.m_lineBuffer.str("");
 }
 
+void Lexer::CloseOutputFiles()
+{
+	Lexer& l = GetInstance();
+	l.m_lexOutFile.close();
+	l.m_lexErrFile.close();
+}
+
+void Lexer::InitializeTables() { GetInstance(); }
+
+void Lexer::SetSourceLines(const std::string& source)
+{
+	Lexer& l = GetInstance();
+	l.m_lines.clear();
+	l.m_lineBuffer.str("");
+
+	size_t lineStart = 0;
+	size_t lineEnd = source.find(CharData::GetNewLineChar());
+	while (lineEnd != std::string::npos)
+	{
+		l.m_lines.push_back(source.substr(lineStart, lineEnd - lineStart + 1));
+		lineStart = lineEnd + 1;
+		lineEnd = source.find(CharData::GetNewLineChar(), lineStart);
+	}
+	l.m_lineBuffer << source.substr(lineStart);
+}
+
 Token Lexer::GetNextToken()
 {
 	Lexer& l = GetInstance();
@@ -589,17 +617,28 @@ void Lexer::WriteValidToken(const Token& t)
 
 void Lexer::WriteErrorToken(const Token& t)
 {
+	if (!ErrorLimit::AddError())
+	{
+		return;
+	}
+
 	std::stringstream ss;
 	ss << "Lexical error: " << t.GetTokenType() << ": \""
-		<< t.GetLexeme() << "\": line  " << t.GetLine() << ".\n";
+		<< t.GetLexeme() << "\": line  " << t.GetLine() << ".";
+	std::string message = ss.str();
+
+	m_lexErrFile << message << "\n";
+	MessagePrinter::AddMessage(t.GetLine(), message + "\n");
 
-	m_lexErrFile << ss.str();
-	MessagePrinter::AddMessage(t.GetLine(), ss.str());
+	std::stringstream code;
+	code << t.GetTokenType();
+	JsonLinesSink::Write("lexical error", code.str(), t.GetLine(), message);
 }
 
 
 Lexer& Lexer::GetInstance()
 {
-	static Lexer l;
+	// every thread compiling files lexes its own file
+	static thread_local Lexer l;
 	return l;
 }
@@ -97,6 +97,17 @@ public:
 	static void SetInputFile(const std::string& filepath);
 	static Token GetNextToken();
 
+	// writes the tokens and errors of the file to disk once it is tokenized, the compile 
+	// server reuses its threads so their lexer is not destroyed after every file
+	static void CloseOutputFiles();
+
+	// stores the lines of the source without tokenizing it so tokens which were not generated 
+	// by the lexer (ex: loaded from a cached AST) can still retrieve the string of their line
+	static void SetSourceLines(const std::string& source);
+
+	// builds the lexical table of the calling thread ahead of its first file
+	static void InitializeTables();
+
 private:
 	Lexer();
 	~Lexer();
@@ -1,14 +1,36 @@
 #include "Lexer/Lexer.h"
 #include "Core/Core.h"
 #include "Parser/Parser.h"
+#include "Parser/ASTSerializer.h"
+#include "Parser/ParserGenerator.h"
 #include "Core/Util.h"
 #include "Core/MessagePrinter.h"
+#include "Core/ErrorLimit.h"
+#include "Core/DiagnosticsContext.h"
+#include "Core/JsonLinesSink.h"
+#include "Core/OutputFiles.h"
+#include "Core/NameTable.h"
 #include "SemanticChecking/SemanticErrors.h"
+#include "SemanticChecking/TypeTable.h"
 #include "CodeGeneration/CodeGeneration.h"
+#include "Benchmark/Benchmark.h"
+#include "Driver/CommandLine.h"
+#include "Driver/CompileServer.h"
 
 #include <iostream>
+#include <fstream>
 #include <sstream>
 #include <filesystem>
+#include <memory>
+#include <cstdlib>
+#include <vector>
+#include <numeric>
+#include <algorithm>
+#include <chrono>
+#include <thread>
+#include <atomic>
+#include <mutex>
+#include <condition_variable>
 
 void ExitPrompt()
 {
@@ -18,88 +40,395 @@ void ExitPrompt()
 
 void PrintMessages(const std::string& filepath)
 {
-	std::cout << "Output from " << filepath << ":\n\n";
+	if (ErrorLimit::IsReached())
+	{
+		std::stringstream ss;
+		ss << "Compilation stopped after reaching the limit of " << ErrorLimit::GetLimit() 
+			<< " errors";
+		MessagePrinter::AddMessage(SIZE_MAX, ss.str());
+	}
+
+	if (MessagePrinter::IsConsoleEchoed())
+	{
+		DiagnosticsContext::GetCurrent().GetConsole() << "Output from " << filepath << ":\n\n";
+	}
 	MessagePrinter::PrintToConsole(filepath);
 	MessagePrinter::ClearMessages();
 }
 
 void DisplaySymbolTable(const std::string& filepath, ProgramNode* prog)
 {
-	std::ofstream symbolTableFile = std::ofstream(SimplifyFilename(filepath)
-		+ ".outsymboltables");
+	// the tables are only converted to text if they are written
+	if (!OutputFiles::IsEnabled(Artifact::SymbolTables))
+	{
+		return;
+	}
+
+	std::ofstream symbolTableFile = OutputFiles::Open(filepath, Artifact::SymbolTables);
 	symbolTableFile << SymbolTableDisplayManager::TableToStr(prog->GetSymbolTable());
 }
 
 void GenerateBatFile(const std::string& filepath)
 {
-	std::cout << "generating bat file for \"" << filepath << "\"\n";
+	DiagnosticsContext::GetCurrent().GetConsole() << "generating bat file for \"" << filepath 
+		<< "\"\n";
 	std::string simplifiedFilepath = SimplifyFilename(filepath);
 	std::string filename = simplifiedFilepath.substr(simplifiedFilepath.find_last_of("/\\") + 1);
-	std::ofstream batFile = std::ofstream(simplifiedFilepath + ".bat");
+	std::ofstream batFile = std::ofstream(OutputFiles::GetFilepath(filepath, ".bat"));
 
 	batFile << "Moon.exe +x " << filename << ".moon lib.m\n";
 	batFile << "pause";
 	batFile.close();
 }
 
-void Compile(const std::string& filepath)
+// the program and the visitors are released on every path since the compile server 
+// compiles files for as long as it runs
+void RunCompilation(const std::string& filepath, CompileMode mode)
 {
-	ProgramNode* program = Parser::Parse(filepath);
+	// unchanged files are loaded from their cached AST instead of being lexed and parsed again
+	bool isASTCached = ASTCache::IsEnabled();
+	std::unique_ptr<ProgramNode> program(isASTCached ? ASTCache::Load(filepath) : nullptr);
 	if (program == nullptr)
+	{
+		program.reset(Parser::Parse(filepath));
+		if (program == nullptr)
+		{
+			PrintMessages(filepath);
+			return;
+		}
+
+		// programs with lexical errors are not cached so their errors are reported again 
+		// every time they are compiled
+		if (isASTCached && DiagnosticsContext::GetCurrent().GetNumErrors() == 0)
+		{
+			ASTCache::Store(filepath, program.get());
+		}
+	}
+
+	if (mode == CompileMode::ParseOnly)
 	{
 		PrintMessages(filepath);
 		return;
 	}
 
-	SemanticErrorManager::Clear();
-	SemanticErrorManager::SetFilePath(SimplifyFilename(filepath) + ".outsemanticerrors");
+	if (OutputFiles::IsEnabled(Artifact::SemanticErrors))
+	{
+		SemanticErrorManager::SetFilePath(OutputFiles::GetFilepath(filepath, 
+			Artifact::SemanticErrors));
+	}
 
 	// semantic checking
-	SymbolTableAssembler* assembler = new SymbolTableAssembler();
-	program->AcceptVisit(assembler);
+	std::unique_ptr<SymbolTableAssembler> assembler(new SymbolTableAssembler());
+	program->AcceptVisit(assembler.get());
 
 	if (SemanticErrorManager::HasError())
 	{
 		SemanticErrorManager::LogData();
-		DisplaySymbolTable(filepath, program);
+		DisplaySymbolTable(filepath, program.get());
 		PrintMessages(filepath);
 		return;
 	}
 
-	SemanticChecker* checker = new SemanticChecker(assembler->GetGlobalSymbolTable());
-	program->AcceptVisit(checker);
+	std::unique_ptr<SemanticChecker> checker(
+		new SemanticChecker(assembler->GetGlobalSymbolTable()));
+	checker->CheckProgram(program.get());
 
 	if (SemanticErrorManager::HasError())
 	{
 		SemanticErrorManager::LogData();
-		DisplaySymbolTable(filepath, program);
+		DisplaySymbolTable(filepath, program.get());
+		PrintMessages(filepath);
+		return;
+	}
+
+	// the symbol tables are not displayed since their sizes are only computed for code generation
+	if (mode == CompileMode::CheckOnly)
+	{
+		SemanticErrorManager::LogData();
 		PrintMessages(filepath);
 		return;
 	}
 
+	// the symbol tables are final so the types of the expressions can be cached
+	std::unique_ptr<EvaluatedTypeCacher> typeCacher(new EvaluatedTypeCacher());
+	program->AcceptVisit(typeCacher.get());
+
 	// code generation
-	SizeGenerator* sizeGen = new SizeGenerator(program->GetSymbolTable());
-	program->AcceptVisit(sizeGen);
+	std::unique_ptr<SizeGenerator> sizeGen(new SizeGenerator(program->GetSymbolTable()));
+	program->AcceptVisit(sizeGen.get());
 
-	CodeGenerator* generator = new CodeGenerator(program->GetSymbolTable(), filepath);
-	program->AcceptVisit(generator);
+	std::unique_ptr<CodeGenerator> generator(
+		new CodeGenerator(program->GetSymbolTable(), filepath));
+	program->AcceptVisit(generator.get());
 	generator->OutputCode();
 
 #ifdef WINDOWS_BUILD
-	GenerateBatFile(filepath);
+	if (OutputFiles::IsEnabled(Artifact::Moon))
+	{
+		GenerateBatFile(filepath);
+	}
 #endif
 
 	SemanticErrorManager::LogData();
-	DisplaySymbolTable(filepath, program);
+	DisplaySymbolTable(filepath, program.get());
 	PrintMessages(filepath);
+}
+
+// console output and number of diagnostics of a file compiled in a batch
+struct CompileResult
+{
+	CompileResult() : m_numErrors(0), m_numWarnings(0), m_milliseconds(0.0), m_isDone(false) { }
+
+	std::stringstream m_console;
+	size_t m_numErrors;
+	size_t m_numWarnings;
+	double m_milliseconds;
+
+	// guarded by the mutex of the batch
+	bool m_isDone;
+};
 
-	delete checker;
-	delete assembler;
-	delete program;
+// the console output is written to the result instead of std::cout if one is provided, 
+// returns the number of errors of the file
+size_t Compile(const std::string& filepath, CompileMode mode = CompileMode::Full, 
+	CompileResult* outResult = nullptr)
+{
+	// every file is compiled with its own diagnostics so no message or error count 
+	// is carried over from another compilation
+	DiagnosticsContext diagnostics;
+	if (outResult != nullptr)
+	{
+		diagnostics.SetConsole(&outResult->m_console);
+	}
+	DiagnosticsContext::SetCurrent(&diagnostics);
+	JsonLinesSink::Open(OutputFiles::GetFilepath(filepath, ".outdiagnostics.jsonl"));
+	RunCompilation(filepath, mode);
+	DiagnosticsContext::SetCurrent(nullptr);
+
+	if (outResult != nullptr)
+	{
+		outResult->m_numErrors = diagnostics.GetNumErrors();
+		outResult->m_numWarnings = diagnostics.GetNumWarnings();
+	}
+	return diagnostics.GetNumErrors();
+}
+
+// compiles the files concurrently, the output of each file is printed in the order of the 
+// files as soon as it is compiled and is followed by a summary of every compilation, 
+// returns the number of files with errors
+size_t CompileBatch(const std::vector<std::string>& filepaths, CompileMode mode, 
+	size_t numThreads)
+{
+	std::vector<CompileResult> results(filepaths.size());
+
+	// the largest files are started first so the batch does not end on a single large file
+	std::vector<uintmax_t> fileSizes(filepaths.size(), 0);
+	for (size_t i = 0; i < filepaths.size(); i++)
+	{
+		std::error_code error;
+		uintmax_t fileSize = std::filesystem::file_size(filepaths[i], error);
+		fileSizes[i] = error ? 0 : fileSize;
+	}
+
+	std::vector<size_t> compileOrder(filepaths.size());
+	std::iota(compileOrder.begin(), compileOrder.end(), 0);
+	std::stable_sort(compileOrder.begin(), compileOrder.end(), [&fileSizes](size_t lhs, size_t rhs)
+	{
+		return fileSizes[lhs] > fileSizes[rhs];
+	});
+
+	std::atomic<size_t> nextFile(0);
+	std::mutex mutex;
+	std::condition_variable fileCompiled;
+	auto compileFiles = [&]()
+	{
+		size_t i;
+		while ((i = nextFile++) < compileOrder.size())
+		{
+			size_t file = compileOrder[i];
+			CompileResult& result = results[file];
+			result.m_console << "Processing file \"" << filepaths[file] << "\"\n";
+
+			auto start = std::chrono::steady_clock::now();
+			Compile(filepaths[file], mode, &result);
+			std::chrono::duration<double, std::milli> time = 
+				std::chrono::steady_clock::now() - start;
+			result.m_milliseconds = time.count();
+
+			std::lock_guard<std::mutex> lock(mutex);
+			result.m_isDone = true;
+			fileCompiled.notify_one();
+		}
+	};
+
+	auto start = std::chrono::steady_clock::now();
+	numThreads = std::min(filepaths.size(), std::max(numThreads, (size_t)1));
+	std::vector<std::thread> threads;
+	for (size_t i = 0; i < numThreads; i++)
+	{
+		threads.emplace_back(compileFiles);
+	}
+
+	for (CompileResult& result : results)
+	{
+		std::unique_lock<std::mutex> lock(mutex);
+		fileCompiled.wait(lock, [&result]() { return result.m_isDone; });
+		lock.unlock();
+		std::cout << result.m_console.str();
+	}
+
+	for (std::thread& thread : threads)
+	{
+		thread.join();
+	}
+	std::chrono::duration<double, std::milli> totalTime = std::chrono::steady_clock::now() - start;
+
+	std::cout << "Compiled " << filepaths.size() << " files on " << numThreads 
+		<< " threads in " << totalTime.count() << "ms\n";
+	size_t numFailedFiles = 0;
+	for (size_t i = 0; i < filepaths.size(); i++)
+	{
+		std::cout << filepaths[i] << ": " << results[i].m_numErrors << " errors, " 
+			<< results[i].m_numWarnings << " warnings (" << results[i].m_milliseconds << "ms)\n";
+		if (results[i].m_numErrors > 0)
+		{
+			numFailedFiles++;
+		}
+	}
+	return numFailedFiles;
+}
+
+// returns the number of files with errors
+size_t CompileFiles(const std::vector<std::string>& filepaths, const CommandLineOptions& options)
+{
+#ifdef BENCHMARK_MODE
+	for (const std::string& filename : filepaths)
+	{
+		std::cout << "Benchmarking file \"" << filename << "\"\n"; 
+		if (CompareParserBackends(filename))
+		{
+			BenchmarkParserBackends(filename);
+		}
+		BenchmarkIncrementalParse(filename);
+		BenchmarkASTCache(filename);
+	}
+	return 0;
+#else
+	if (options.m_numJobs > 0)
+	{
+		return CompileBatch(filepaths, options.m_mode, options.m_numJobs);
+	}
+
+	size_t numFailedFiles = 0;
+	for (const std::string& filename : filepaths)
+	{
+		std::cout << "Processing file \"" << filename << "\"\n"; 
+		if (Compile(filename, options.m_mode) > 0)
+		{
+			numFailedFiles++;
+		}
+	}
+	return numFailedFiles;
+#endif
+}
+
+// requests of different socket connections are compiled at the same time
+std::mutex s_requestMutex;
+size_t s_numRunningRequests = 0;
+
+// number of names after which the names and types of the previous requests are dropped
+constexpr size_t s_maxNumNames = 1 << 16;
+
+// compiles the files of a server request one after the other on the thread serving it 
+// so they all use its parser, returns the number of files with errors
+size_t CompileRequest(const std::vector<std::string>& filepaths, CompileMode mode, 
+	std::ostream& out)
+{
+	// the names and types of the previous requests are not used anymore once no other 
+	// request is being compiled, they are kept until there are too many of them since the 
+	// definitions kept by the parsers for --incremental are dropped with them
+	{
+		std::lock_guard<std::mutex> lock(s_requestMutex);
+		if (s_numRunningRequests == 0 && NameTable::GetNumNames() > s_maxNumNames)
+		{
+			NameTable::Reset();
+			TypeTable::Reset();
+		}
+		s_numRunningRequests++;
+	}
+
+	// only the definitions of the requested files can be reused
+	Parser::RetainDefinitionCaches(filepaths);
+
+	size_t numFailedFiles = 0;
+	for (const std::string& filename : filepaths)
+	{
+		CompileResult result;
+		result.m_console << "Processing file \"" << filename << "\"\n";
+		if (Compile(filename, mode, &result) > 0)
+		{
+			numFailedFiles++;
+		}
+		out << result.m_console.str();
+	}
+
+	std::lock_guard<std::mutex> lock(s_requestMutex);
+	s_numRunningRequests--;
+	return numFailedFiles;
 }
 
 int main(int argc, char* argv[])
 {
+	CommandLineOptions options;
+	if (!ParseCommandLine(argc, argv, options))
+	{
+		std::cerr << "Use --help to list the options\n";
+		return 2;
+	}
+
+	if (options.m_showHelp)
+	{
+		PrintUsage(argv[0]);
+		return 0;
+	}
+
+	if (!options.m_generatedParserPath.empty())
+	{
+		std::ofstream file(options.m_generatedParserPath);
+		if (!file.is_open())
+		{
+			std::cerr << "Generated parser \"" << options.m_generatedParserPath 
+				<< "\" could not be opened\n";
+			return 2;
+		}
+		WriteRecursiveDescentParser(file);
+		return 0;
+	}
+
+	if (options.m_isServer)
+	{
+		// the files of the requests are mostly parsed again after small edits
+		Parser::SetIncremental(true);
+
+		CompileRequestHandler handler = [&options](const std::vector<std::string>& filepaths, 
+			std::ostream& out)
+		{
+			return CompileRequest(filepaths, options.m_mode, out);
+		};
+
+		if (options.m_serverSocketPath.empty())
+		{
+			return CompileServer::ServeStdin(handler);
+		}
+		return CompileServer::ServeSocket(options.m_serverSocketPath, handler);
+	}
+
+	// the files provided on the command line are compiled without waiting for enter
+	if (!options.m_inputs.empty())
+	{
+		return CompileFiles(options.m_inputs, options) > 0 ? 1 : 0;
+	}
+
 #ifdef DEBUG_MODE
 	std::string file = "testInputFile.txt";
 	std::string currDir = std::string(argv[0]);
@@ -111,7 +440,7 @@ int main(int argc, char* argv[])
 #else
 	path += "/Comp442Compiler/Comp442Compiler/" + file;
 #endif
-	Compile(path);
+	return Compile(path, options.m_mode) > 0 ? 1 : 0;
 #else
 	std::string directoryPath = "TestFiles";
 	
@@ -120,21 +449,30 @@ int main(int argc, char* argv[])
 		std::cout << "Directory \"" << directoryPath 
 			<< "\" could not be found. Please put all the test files in "
 			<< "the relative directory \"" << directoryPath << "\"\n";
-		ExitPrompt();
+		if (options.m_isInteractive)
+		{
+			ExitPrompt();
+		}
 		return 1;
 	}
 
+	std::vector<std::string> filepaths;
 	for (auto& file : std::filesystem::directory_iterator(directoryPath))
 	{
 		std::string filename = directoryPath + "/" + file.path().filename().generic_string();
 		std::string fileExtention = filename.substr(filename.length() - 4);
 		if (fileExtention == ".src")
 		{
-			std::cout << "Processing file \"" << filename << "\"\n"; 
-			Compile(filename);
+			filepaths.push_back(filename);
 		}
 	}
+
+	size_t numFailedFiles = CompileFiles(filepaths, options);
 	std::cout << "Directory processing completed\n";
-	ExitPrompt();
+	if (options.m_isInteractive)
+	{
+		ExitPrompt();
+	}
+	return numFailedFiles > 0 ? 1 : 0;
 #endif
-}
\ No newline at end of file
+}
@@ -3,24 +3,59 @@
 #include "ASTUtil.h"
 
 // Helpers /////////////////////////////////////////////////
-void WriteIndentToStream(std::stringstream& ss, size_t indent)
+void WriteIndentToStream(std::ostream& stream, size_t indent)
 {
     for (size_t i = 0; i < indent; i++)
     {
-        ss << "|  ";
+        stream << "|  ";
     }
 }
 
 // ASTNode //////////////////////////////////////////////////
+ASTNode::ASTNode() : m_cachedEvaluatedType(TypeTable::GetInvalidType()), 
+    m_hasCachedEvaluatedType(false) { }
+
 ASTNode::~ASTNode() { }
 
-std::string ASTNode::GetEvaluatedType() { return InvalidType; }
+TypeID ASTNode::GetEvaluatedTypeID() { return TypeTable::GetInvalidType(); }
+
+const std::string& ASTNode::GetEvaluatedType() 
+{ 
+    return TypeTable::GetTypeStr(GetEvaluatedTypeID()); 
+}
+
+void ASTNode::CacheEvaluatedType()
+{
+    m_cachedEvaluatedType = GetEvaluatedTypeID();
+    m_hasCachedEvaluatedType = true;
+}
+
+const std::string& ASTNode::GetCachedEvaluatedType()
+{
+    return TypeTable::GetTypeStr(GetCachedEvaluatedTypeID());
+}
+
+TypeID ASTNode::GetCachedEvaluatedTypeID()
+{
+    if (!m_hasCachedEvaluatedType)
+    {
+        CacheEvaluatedType();
+    }
+    return m_cachedEvaluatedType;
+}
 
 SymbolTable* ASTNode::GetSymbolTable()
 {
     return GetParent()->GetSymbolTable();
 }
 
+std::string ASTNode::ToString(size_t indent)
+{
+    std::stringstream ss;
+    WriteToStream(ss, indent);
+    return ss.str();
+}
+
 // ASTNodeBase ///////////////////////////////////////////
 
 ASTNodeBase::ASTNodeBase() : m_parent(nullptr) { }
@@ -102,27 +137,6 @@ const ASTNode* LeafNode::GetParent() const { return m_parent; }
 void LeafNode::SetParent(ASTNode* parent) { m_parent = parent; };
 size_t LeafNode::GetNumChild() const { return 0; }
 
-// EmptyNodeBase ////////////////////////////////////////////////////////////
-ASTNode* EmptyNodeBase::GetParent() { return nullptr; }
-const ASTNode* EmptyNodeBase::GetParent() const { return nullptr; }
-void EmptyNodeBase::SetParent(ASTNode* parent) { }
-
-size_t EmptyNodeBase::GetNumChild() const { return 0; }
-std::string EmptyNodeBase::ToString(size_t indent) { return ""; };
-
-Token EmptyNodeBase::GetFirstToken() const
-{
-    //this function should never be called
-    DEBUG_BREAK();
-    return Token();
-}
-
-void EmptyNodeBase::AcceptVisit(Visitor* visitor) 
-{
-    //this function should never be called
-    DEBUG_BREAK();
-}
-
 // UnspecificedDimensionNode //////////////////////////////////////////
 Token UnspecificedDimensionNode::GetFirstToken() const
 {
@@ -131,13 +145,10 @@ Token UnspecificedDimensionNode::GetFirstToken() const
     return Token();
 }
 
-std::string UnspecificedDimensionNode::ToString(size_t indent)
+void UnspecificedDimensionNode::WriteToStream(std::ostream& stream, size_t indent)
 {
-    std::stringstream ss;
-    WriteIndentToStream(ss, indent);
-    ss << "UnspecifiedArrDimension\n";
-
-    return ss.str();
+    WriteIndentToStream(stream, indent);
+    stream << "UnspecifiedArrDimension\n";
 }
 
 void UnspecificedDimensionNode::AcceptVisit(Visitor* visitor) { visitor->Visit(this); }
@@ -147,7 +158,7 @@ IDNode::IDNode(const Token& id) : m_id(id) { }
 
 const Token& IDNode::GetID() const { return m_id; }
 
-std::string IDNode::GetEvaluatedType()
+TypeID IDNode::GetEvaluatedTypeID()
 {
     DotNode* dot = FindFirstDotNodeParent(this);
     if (dot != nullptr)
@@ -155,53 +166,50 @@ std::string IDNode::GetEvaluatedType()
         dot = GetRootDotNode(dot);
         if (dot->GetLeft() == this)
         {
-            return GetEvaluatedTypeWithoutDot();
+            return GetEvaluatedTypeIDWithoutDot();
         }
         SymbolTable* context = GetContextTableFromName(dot->GetSymbolTable(), 
             dot, GetID().GetLexeme());
 
         if (context == nullptr)
         {
-            return InvalidType;
+            return TypeTable::GetInvalidType();
         }
 
-        SymbolTableEntry* entry = context->FindEntryInScope(GetID().GetLexeme());
+        SymbolTableEntry* entry = context->FindEntryInScope(GetID().GetLexemeID());
         if (entry == nullptr)
         {
-            return InvalidType;
+            return TypeTable::GetInvalidType();
         }
-        return entry->GetEvaluatedType();
+        return entry->GetEvaluatedTypeID();
     }
     else
     {
-        return GetEvaluatedTypeWithoutDot();
+        return GetEvaluatedTypeIDWithoutDot();
     }
     
 }
 
 Token IDNode::GetFirstToken() const { return m_id; }
 
-std::string IDNode::ToString(size_t indent)
+void IDNode::WriteToStream(std::ostream& stream, size_t indent)
 {
-    std::stringstream ss;
-    WriteIndentToStream(ss, indent);
-    ss << "id\n";
-    WriteIndentToStream(ss, indent + 1);
-    ss << GetID().GetLexeme() << "\n";
-
-    return ss.str();
+    WriteIndentToStream(stream, indent);
+    stream << "id\n";
+    WriteIndentToStream(stream, indent + 1);
+    stream << GetID().GetLexeme() << "\n";
 }
 
 void IDNode::AcceptVisit(Visitor* visitor) { visitor->Visit(this); }
 
-std::string IDNode::GetEvaluatedTypeWithoutDot()
+TypeID IDNode::GetEvaluatedTypeIDWithoutDot()
 {
-    SymbolTableEntry* entry = GetSymbolTable()->FindEntryInScope(GetID().GetLexeme());
+    SymbolTableEntry* entry = GetSymbolTable()->FindEntryInScope(GetID().GetLexemeID());
     if (entry == nullptr)
     {
-        return InvalidType;
+        return TypeTable::GetInvalidType();
     }
-    return entry->GetEvaluatedType();
+    return entry->GetEvaluatedTypeID();
 }
 
 // TypeNode //////////////////////////////////////////////////////
@@ -209,22 +217,23 @@ TypeNode::TypeNode(const Token& type) : m_type(type) { }
 
 const Token& TypeNode::GetType() const { return m_type; }
 
-std::string TypeNode::GetEvaluatedType() 
+TypeID TypeNode::GetEvaluatedTypeID() 
 {
-    return GetType().GetLexeme();
+    if (GetType().GetLexemeID() == NameTable::InvalidNameID)
+    {
+        return TypeTable::GetTypeID(GetType().GetLexeme());
+    }
+    return TypeTable::GetNamedType(GetType().GetLexemeID());
 }
 
 Token TypeNode::GetFirstToken() const { return GetType(); }
 
-std::string TypeNode::ToString(size_t indent)
+void TypeNode::WriteToStream(std::ostream& stream, size_t indent)
 {
-    std::stringstream ss;
-    WriteIndentToStream(ss, indent);
-    ss << "TypeNode\n";
-    WriteIndentToStream(ss, indent + 1);
-    ss << GetType().GetLexeme() << "\n"; 
-
-    return ss.str();
+    WriteIndentToStream(stream, indent);
+    stream << "TypeNode\n";
+    WriteIndentToStream(stream, indent + 1);
+    stream << GetType().GetLexeme() << "\n"; 
 }
 
 void TypeNode::AcceptVisit(Visitor* visitor) { visitor->Visit(this); }
@@ -235,12 +244,10 @@ const Token& OperatorNode::GetOperator() const { return m_operator; }
 
 Token OperatorNode::GetFirstToken() const { return m_operator; }
 
-std::string OperatorNode::ToString(size_t indent)
+void OperatorNode::WriteToStream(std::ostream& stream, size_t indent)
 {
-    std::stringstream ss;
-    WriteIndentToStream(ss, indent);
-    ss << m_operator.GetLexeme() <<"\n";
-    return ss.str();
+    WriteIndentToStream(stream, indent);
+    stream << m_operator.GetLexeme() <<"\n";
 }
 
 void OperatorNode::AcceptVisit(Visitor* visitor) { visitor->Visit(this); }
@@ -258,27 +265,26 @@ ASTNode* BaseBinaryOperator::GetLeft() { return GetChild(0); }
 OperatorNode* BaseBinaryOperator::GetOperator() { return (OperatorNode*)GetChild(1); }
 ASTNode* BaseBinaryOperator::GetRight() { return GetChild(2); }
 
-std::string BaseBinaryOperator::GetEvaluatedType()
+TypeID BaseBinaryOperator::GetEvaluatedTypeID()
 {
-    std::string leftEvalType = GetLeft()->GetEvaluatedType();
-    if (leftEvalType == GetRight()->GetEvaluatedType() 
-        && (leftEvalType == "integer" || leftEvalType == "float"))
+    TypeID leftEvalType = GetLeft()->GetEvaluatedTypeID();
+    if (leftEvalType == GetRight()->GetEvaluatedTypeID() 
+        && (leftEvalType == TypeTable::GetIntegerType() 
+            || leftEvalType == TypeTable::GetFloatType()))
     {
         return leftEvalType;
     }
 
-    return InvalidType;
+    return TypeTable::GetInvalidType();
 }
 
-std::string BaseBinaryOperator::ToString(size_t indent)
+void BaseBinaryOperator::WriteToStream(std::ostream& stream, size_t indent)
 {
-    std::stringstream ss;
-    WriteIndentToStream(ss, indent);
-    ss << m_name << "\n";
-    ss << GetLeft()->ToString(indent + 1);
-    ss << GetOperator()->ToString(indent + 1);
-    ss << GetRight()->ToString(indent + 1);
-    return ss.str();
+    WriteIndentToStream(stream, indent);
+    stream << m_name << "\n";
+    GetLeft()->WriteToStream(stream, indent + 1);
+    GetOperator()->WriteToStream(stream, indent + 1);
+    GetRight()->WriteToStream(stream, indent + 1);
 }
 
 // AddOpNode //////////////////////////////////////////////
@@ -305,13 +311,13 @@ void MultOpNode::AcceptVisit(Visitor* visitor)
 RelOpNode::RelOpNode(ASTNode* left, OperatorNode* op, ASTNode* right) 
     : BaseBinaryOperator("RelOp", left, op, right) { }
 
-std::string RelOpNode::GetEvaluatedType()
+TypeID RelOpNode::GetEvaluatedTypeID()
 {
-    if (GetLeft()->GetEvaluatedType() == GetRight()->GetEvaluatedType())
+    if (GetLeft()->GetEvaluatedTypeID() == GetRight()->GetEvaluatedTypeID())
     {
-        return "integer";
+        return TypeTable::GetIntegerType();
     }
-    return InvalidType;
+    return TypeTable::GetInvalidType();
 }
 
 void RelOpNode::AcceptVisit(Visitor* visitor) 
@@ -331,17 +337,15 @@ IDNode* LiteralNode::GetLexemeNode() { return (IDNode*)GetChild(0); }
 
 TypeNode* LiteralNode::GetType() { return (TypeNode*)GetChild(1); }
 
-std::string LiteralNode::GetEvaluatedType() { return GetType()->GetEvaluatedType(); }
+TypeID LiteralNode::GetEvaluatedTypeID() { return GetType()->GetEvaluatedTypeID(); }
 
-std::string LiteralNode::ToString(size_t indent)
+void LiteralNode::WriteToStream(std::ostream& stream, size_t indent)
 {
-    std::stringstream ss;
-    WriteIndentToStream(ss, indent);
-    ss << "Literal\n";
-    WriteIndentToStream(ss, indent + 1);
-    ss << GetLexemeNode()->GetID().GetLexeme() << "\n";
-    ss << GetType()->ToString(indent + 1);
-    return ss.str();
+    WriteIndentToStream(stream, indent);
+    stream << "Literal\n";
+    WriteIndentToStream(stream, indent + 1);
+    stream << GetLexemeNode()->GetID().GetLexeme() << "\n";
+    GetType()->WriteToStream(stream, indent + 1);
 }
 
 void LiteralNode::AcceptVisit(Visitor* visitor) 
@@ -358,16 +362,14 @@ const std::list<ASTNode*>& DimensionNode::GetChildren() const
     return ASTNodeBase::GetChildren(); 
 }
 
-std::string DimensionNode::ToString(size_t indent)
+void DimensionNode::WriteToStream(std::ostream& stream, size_t indent)
 {
-    std::stringstream ss;
-    WriteIndentToStream(ss, indent);
-    ss << "Dimensions\n";
+    WriteIndentToStream(stream, indent);
+    stream << "Dimensions\n";
     for (ASTNode* dimension : GetChildren())
     {
-        ss << dimension->ToString(indent + 1);
+        dimension->WriteToStream(stream, indent + 1);
     }
-    return ss.str();
 }
 
 void DimensionNode::AcceptVisit(Visitor* visitor) 
@@ -411,25 +413,22 @@ AParamListNode* VarDeclNode::GetParamList()
     return dynamic_cast<AParamListNode*>(GetChild(2));
 }
 
-std::string VarDeclNode::GetEvaluatedType()
+TypeID VarDeclNode::GetEvaluatedTypeID()
 {
     SymbolTableEntry* entry = GetSymbolTable()
-        ->FindEntryInScope(GetID()->GetID().GetLexeme());
+        ->FindEntryInScope(GetID()->GetID().GetLexemeID());
     ASSERT(entry != nullptr);
 
-    return entry->GetEvaluatedType();
+    return entry->GetEvaluatedTypeID();
 }
 
-std::string VarDeclNode::ToString(size_t indent)
+void VarDeclNode::WriteToStream(std::ostream& stream, size_t indent)
 {
-    std::stringstream ss;
-    WriteIndentToStream(ss, indent);
-    ss << "VarDecl\n";
-    ss << GetID()->ToString(indent + 1);
-    ss << GetType()->ToString(indent + 1);
-    ss << GetChild(2)->ToString(indent + 1);
-
-    return ss.str();
+    WriteIndentToStream(stream, indent);
+    stream << "VarDecl\n";
+    GetID()->WriteToStream(stream, indent + 1);
+    GetType()->WriteToStream(stream, indent + 1);
+    GetChild(2)->WriteToStream(stream, indent + 1);
 }
 
 void VarDeclNode::AcceptVisit(Visitor* visitor) 
@@ -449,20 +448,17 @@ ASTNode* DotNode::GetLeft() { return GetChild(0); }
 
 ASTNode* DotNode::GetRight() { return GetChild(1); }
 
-std::string DotNode::GetEvaluatedType() 
+TypeID DotNode::GetEvaluatedTypeID() 
 {
-    return GetRight()->GetEvaluatedType();
+    return GetRight()->GetEvaluatedTypeID();
 }
 
-std::string DotNode::ToString(size_t indent)
+void DotNode::WriteToStream(std::ostream& stream, size_t indent)
 {
-    std::stringstream ss;
-    WriteIndentToStream(ss, indent);
-    ss << "Dot\n";
-    ss << GetLeft()->ToString(indent + 1);
-    ss << GetRight()->ToString(indent + 1);
-
-    return ss.str();
+    WriteIndentToStream(stream, indent);
+    stream << "Dot\n";
+    GetLeft()->WriteToStream(stream, indent + 1);
+    GetRight()->WriteToStream(stream, indent + 1);
 }
 
 void DotNode::AcceptVisit(Visitor* visitor) 
@@ -476,15 +472,13 @@ ExprNode::ExprNode(ASTNode* exprRoot) { AddChild(exprRoot); }
 
 ASTNode* ExprNode::GetRootOfExpr() { return GetChild(0); }
 
-std::string ExprNode::GetEvaluatedType() { return GetChild(0)->GetEvaluatedType(); }
+TypeID ExprNode::GetEvaluatedTypeID() { return GetChild(0)->GetEvaluatedTypeID(); }
 
-std::string ExprNode::ToString(size_t indent)
+void ExprNode::WriteToStream(std::ostream& stream, size_t indent)
 {
-    std::stringstream ss;
-    WriteIndentToStream(ss, indent);
-    ss << "Expr\n";
-    ss << GetChild(0)->ToString(indent + 1);
-    return ss.str();
+    WriteIndentToStream(stream, indent);
+    stream << "Expr\n";
+    GetChild(0)->WriteToStream(stream, indent + 1);
 }
 
 void ExprNode::AcceptVisit(Visitor* visitor) 
@@ -502,15 +496,12 @@ const Token& SignNode::GetSign() { return m_sign; }
 
 Token SignNode::GetFirstToken() const { return m_sign; }
 
-std::string SignNode::ToString(size_t indent)
+void SignNode::WriteToStream(std::ostream& stream, size_t indent)
 {
-    std::stringstream ss;
-    WriteIndentToStream(ss, indent);
-    ss << "Sign\n";
-    WriteIndentToStream(ss, indent + 1);
-    ss << m_sign.GetLexeme() << "\n";
-
-    return ss.str();
+    WriteIndentToStream(stream, indent);
+    stream << "Sign\n";
+    WriteIndentToStream(stream, indent + 1);
+    stream << m_sign.GetLexeme() << "\n";
 }
 
 void SignNode::AcceptVisit(Visitor* visitor) { visitor->Visit(this); }
@@ -519,13 +510,10 @@ void SignNode::AcceptVisit(Visitor* visitor) { visitor->Visit(this); }
 NotNode::NotNode(const Token& t) : m_notToken(t) { }
 Token NotNode::GetFirstToken() const { return m_notToken; }
 
-std::string NotNode::ToString(size_t indent)
+void NotNode::WriteToStream(std::ostream& stream, size_t indent)
 {
-    std::stringstream ss;
-    WriteIndentToStream(ss, indent);
-    ss << "not\n";
-
-    return ss.str();
+    WriteIndentToStream(stream, indent);
+    stream << "not\n";
 }
 
 void NotNode::AcceptVisit(Visitor* visitor) { visitor->Visit(this); }
@@ -541,17 +529,14 @@ ASTNode* ModifiedExpr::GetRootOfExpr() { return GetExpr(); }
 ASTNode* ModifiedExpr::GetModifier() { return GetChild(0); }
 ASTNode* ModifiedExpr::GetExpr() { return GetChild(1); }
 
-std::string ModifiedExpr::GetEvaluatedType() { return GetExpr()->GetEvaluatedType(); }
+TypeID ModifiedExpr::GetEvaluatedTypeID() { return GetExpr()->GetEvaluatedTypeID(); }
 
-std::string ModifiedExpr::ToString(size_t indent)
+void ModifiedExpr::WriteToStream(std::ostream& stream, size_t indent)
 {
-    std::stringstream ss;
-    WriteIndentToStream(ss, indent);
-    ss << "ModifiedExpr\n";
-    ss << GetModifier()->ToString(indent + 1);
-    ss << GetExpr()->ToString(indent + 1);
-
-    return ss.str();
+    WriteIndentToStream(stream, indent);
+    stream << "ModifiedExpr\n";
+    GetModifier()->WriteToStream(stream, indent + 1);
+    GetExpr()->WriteToStream(stream, indent + 1);
 }
 
 void ModifiedExpr::AcceptVisit(Visitor* visitor) 
@@ -568,14 +553,11 @@ ExprNode* BaseLangStatNode::GetExpr() { return (ExprNode*)GetChild(0); }
 // ReturnStatNode ////////////////////////////////////////////////
 ReturnStatNode::ReturnStatNode(ExprNode* expr) : BaseLangStatNode(expr) { }
 
-std::string ReturnStatNode::ToString(size_t indent)
+void ReturnStatNode::WriteToStream(std::ostream& stream, size_t indent)
 {
-    std::stringstream ss;
-    WriteIndentToStream(ss, indent);
-    ss << "ReturnStat\n";
-    ss << GetExpr()->ToString(indent + 1);
-
-    return ss.str();
+    WriteIndentToStream(stream, indent);
+    stream << "ReturnStat\n";
+    GetExpr()->WriteToStream(stream, indent + 1);
 }
 
 void ReturnStatNode::AcceptVisit(Visitor* visitor) 
@@ -594,10 +576,10 @@ VariableNode::VariableNode(IDNode* var, DimensionNode* dimension)
 IDNode* VariableNode::GetVariable() { return (IDNode*)GetChild(0); }
 DimensionNode* VariableNode::GetDimension() { return (DimensionNode*)GetChild(1); }
 
-std::string VariableNode::GetEvaluatedType() 
+TypeID VariableNode::GetEvaluatedTypeID() 
 { 
     SymbolTableEntry* entry = GetSymbolTable()
-        ->FindEntryInScope(GetVariable()->GetID().GetLexeme());
+        ->FindEntryInScope(GetVariable()->GetID().GetLexemeID());
 
     if (GetVariable()->GetID().GetLexeme() == "self"
         && (GetSymbolTable()->GetParentEntry()->GetKind()
@@ -605,127 +587,56 @@ std::string VariableNode::GetEvaluatedType()
             || GetSymbolTable()->GetParentEntry()->GetKind()
             == SymbolTableEntryKind::ConstructorDecl))
     {
-        return GetSymbolTable()->GetParentTable()->GetName();
+        // the type of the class entry owning the table of the member function
+        return GetSymbolTable()->GetParentTable()->GetParentEntry()->GetEvaluatedTypeID();
     }
-    
 
-    std::string typeStr = "";
     if (entry == nullptr)
     {
-        if (GetVariable()->GetID().GetLexeme() == "self" 
-            && (GetSymbolTable()->GetParentEntry()->GetKind() 
-                == SymbolTableEntryKind::MemFuncDecl 
-            || GetSymbolTable()->GetParentEntry()->GetKind() 
-                == SymbolTableEntryKind::ConstructorDecl))
+        if (dynamic_cast<DotNode*>(GetParent()) == nullptr)
         {
-            return GetSymbolTable()->GetParentTable()->GetName();
+            return TypeTable::GetInvalidType();
         }
-        else if (dynamic_cast<DotNode*>(GetParent()) != nullptr)
+
+        DotNode* dotParent = (DotNode*) GetParent();
+        SymbolTable* globalTable = GetGlobalTable(GetSymbolTable());
+        ASTNode* prevTerm = dotParent->GetLeft();
+        if (prevTerm == this)
         {
-            DotNode* dotParent = (DotNode*) GetParent();
-            SymbolTable* globalTable = GetGlobalTable(GetSymbolTable());
-            ASTNode* prevTerm = dotParent->GetLeft();
-            if (prevTerm == this)
-            {
-                prevTerm = ((DotNode*)dotParent->GetParent())->GetLeft();
-            }
-            SymbolTableEntry* leftScopeTableEntry 
-                = globalTable->FindEntryInScope(prevTerm->GetEvaluatedType());
-            if (leftScopeTableEntry != nullptr 
-                && leftScopeTableEntry->GetKind() == SymbolTableEntryKind::Class)
-            {
-                SymbolTable* leftVarScopeTable = leftScopeTableEntry->GetSubTable();
-                SymbolTableEntry* currVarEntry = leftVarScopeTable->
-                    FindEntryInScope(GetVariable()->GetID().GetLexeme());
-
-                if (currVarEntry != nullptr)
-                {
-                    typeStr = currVarEntry->GetEvaluatedType();
-                    if (!IsArrayType(typeStr))
-                    {
-                        return typeStr;
-                    }
-                    typeStr = BaseTypeOfArr(typeStr);
-                    entry = currVarEntry;
-                }
-            }
-            else
-            {
-                return InvalidType;
-            }
+            prevTerm = ((DotNode*)dotParent->GetParent())->GetLeft();
         }
-        else
+        SymbolTableEntry* leftScopeTableEntry = globalTable->FindEntryInScope(
+            TypeTable::GetTypeStr(prevTerm->GetEvaluatedTypeID()));
+        if (leftScopeTableEntry == nullptr 
+            || leftScopeTableEntry->GetKind() != SymbolTableEntryKind::Class)
         {
-            return InvalidType;
+            return TypeTable::GetInvalidType();
         }
-    }
-
-    VarDeclNode* node = (VarDeclNode*)entry->GetNode();
-    DimensionNode* dim = node->GetDimension();
-    size_t numDim;
-    
-    if (dim != nullptr) 
-    {
-        numDim = dim->GetNumChild();
-    }
-    else
-    {
-        numDim = 0;
-    }
-
-    if (numDim == 0)
-    {
-        return entry->GetEvaluatedType();
-    }
 
-    if (typeStr == "")
-    {
-        TypeNode* type = node->GetType();
-        typeStr = type->GetType().GetLexeme();
-    }
-    std::stringstream ss;
-    ss << typeStr;
-    size_t dimToSkip = GetDimension()->GetNumChild();
-    if (dimToSkip > numDim)
-    {
-        return InvalidType;
-    }
-    else if (dimToSkip == numDim)
-    {
-        return ss.str();
+        entry = leftScopeTableEntry->GetSubTable()->FindEntryInScope(
+            GetVariable()->GetID().GetLexemeID());
+        if (entry == nullptr)
+        {
+            return TypeTable::GetInvalidType();
+        }
     }
 
-    for (ASTNode* dimNode : node->GetDimension()->GetChildren())
+    // the type of the declaration without the dimensions indexed by this variable, 
+    // indexing a non array variable keeps its type
+    TypeID varType = entry->GetEvaluatedTypeID();
+    if (!TypeTable::IsArray(varType))
     {
-        if (dimToSkip > 0)
-        {
-            dimToSkip--;
-        }
-        else if (dynamic_cast<UnspecificedDimensionNode*>(dimNode) != nullptr)
-        {
-            ss << "[]";
-        }
-        else if (dynamic_cast<LiteralNode*>(dimNode) != nullptr)
-        {
-            LiteralNode* literal = (LiteralNode*) dimNode;
-            ss << "["<< literal->GetLexemeNode()->GetID().GetLexeme() << "]";
-        }
-        else
-        {
-            DEBUG_BREAK();
-        }
+        return varType;
     }
-    return ss.str();
+    return TypeTable::GetIndexedType(varType, GetDimension()->GetNumChild());
 }
 
-std::string VariableNode::ToString(size_t indent)
+void VariableNode::WriteToStream(std::ostream& stream, size_t indent)
 {
-    std::stringstream ss;
-    WriteIndentToStream(ss, indent);
-    ss << "Variable\n";
-    ss << GetVariable()->ToString(indent + 1);
-    ss << GetDimension()->ToString(indent + 1);
-    return ss.str();
+    WriteIndentToStream(stream, indent);
+    stream << "Variable\n";
+    GetVariable()->WriteToStream(stream, indent + 1);
+    GetDimension()->WriteToStream(stream, indent + 1);
 }
 
 void VariableNode::AcceptVisit(Visitor* visitor) 
@@ -739,14 +650,11 @@ ReadStatNode::ReadStatNode(ASTNode* var) { AddChild(var); }
 
 ASTNode* ReadStatNode::GetVariable() { return GetChild(0); }
 
-std::string ReadStatNode::ToString(size_t indent)
+void ReadStatNode::WriteToStream(std::ostream& stream, size_t indent)
 {
-    std::stringstream ss;
-    WriteIndentToStream(ss, indent);
-    ss << "ReadStat\n";
-    ss << GetVariable()->ToString(indent + 1);
-
-    return ss.str();
+    WriteIndentToStream(stream, indent);
+    stream << "ReadStat\n";
+    GetVariable()->WriteToStream(stream, indent + 1);
 }
 
 void ReadStatNode::AcceptVisit(Visitor* visitor) 
@@ -758,14 +666,11 @@ void ReadStatNode::AcceptVisit(Visitor* visitor)
 // WriteStatNode //////////////////////////////////////////////////////
 WriteStatNode::WriteStatNode(ExprNode* expr) : BaseLangStatNode(expr) { }
 
-std::string WriteStatNode::ToString(size_t indent)
+void WriteStatNode::WriteToStream(std::ostream& stream, size_t indent)
 {
-    std::stringstream ss;
-    WriteIndentToStream(ss, indent);
-    ss << "WriteStat\n";
-    ss << GetExpr()->ToString(indent + 1);
-
-    return ss.str();
+    WriteIndentToStream(stream, indent);
+    stream << "WriteStat\n";
+    GetExpr()->WriteToStream(stream, indent + 1);
 }
 
 void WriteStatNode::AcceptVisit(Visitor* visitor) 
@@ -784,14 +689,12 @@ AssignStatNode::AssignStatNode(ASTNode* left, ExprNode* expr)
 ASTNode* AssignStatNode::GetLeft() { return GetChild(0); }
 ExprNode* AssignStatNode::GetRight() { return (ExprNode*)GetChild(1); }
 
-std::string AssignStatNode::ToString(size_t indent)
+void AssignStatNode::WriteToStream(std::ostream& stream, size_t indent)
 {
-    std::stringstream ss;
-    WriteIndentToStream(ss, indent);
-    ss << "AssigStat\n";
-    ss << GetLeft()->ToString(indent + 1);
-    ss << GetRight()->ToString(indent + 1);
-    return ss.str();
+    WriteIndentToStream(stream, indent);
+    stream << "AssigStat\n";
+    GetLeft()->WriteToStream(stream, indent + 1);
+    GetRight()->WriteToStream(stream, indent + 1);
 }
 
 void AssignStatNode::AcceptVisit(Visitor* visitor) 
@@ -812,16 +715,13 @@ ExprNode* IfStatNode::GetCondition() { return (ExprNode*)GetChild(0); }
 StatBlockNode* IfStatNode::GetIfBranch() { return (StatBlockNode*)GetChild(1); }
 StatBlockNode* IfStatNode::GetElseBranch() { return (StatBlockNode*)GetChild(2); }
 
-std::string IfStatNode::ToString(size_t indent)
+void IfStatNode::WriteToStream(std::ostream& stream, size_t indent)
 {
-    std::stringstream ss;
-    WriteIndentToStream(ss, indent);
-    ss << "IfStat\n";
-    ss << GetCondition()->ToString(indent + 1);
-    ss << GetIfBranch()->ToString(indent + 1);
-    ss << GetElseBranch()->ToString(indent + 1);
-
-    return ss.str();
+    WriteIndentToStream(stream, indent);
+    stream << "IfStat\n";
+    GetCondition()->WriteToStream(stream, indent + 1);
+    GetIfBranch()->WriteToStream(stream, indent + 1);
+    GetElseBranch()->WriteToStream(stream, indent + 1);
 }
 
 void IfStatNode::AcceptVisit(Visitor* visitor) 
@@ -840,15 +740,12 @@ WhileStatNode::WhileStatNode(ExprNode* condition, StatBlockNode* statBlock)
 ExprNode* WhileStatNode::GetCondition() { return (ExprNode*)GetChild(0); }
 StatBlockNode* WhileStatNode::GetStatBlock() { return (StatBlockNode*)GetChild(1); }
 
-std::string WhileStatNode::ToString(size_t indent)
+void WhileStatNode::WriteToStream(std::ostream& stream, size_t indent)
 {
-    std::stringstream ss;
-    WriteIndentToStream(ss, indent);
-    ss << "WhileStat\n";
-    ss << GetCondition()->ToString(indent + 1);
-    ss << GetStatBlock()->ToString(indent + 1);
-
-    return ss.str();
+    WriteIndentToStream(stream, indent);
+    stream << "WhileStat\n";
+    GetCondition()->WriteToStream(stream, indent + 1);
+    GetStatBlock()->WriteToStream(stream, indent + 1);
 }
 
 void WhileStatNode::AcceptVisit(Visitor* visitor) 
@@ -869,16 +766,14 @@ const std::list<ASTNode*>& AParamListNode::GetChildren() const
     return ASTNodeBase::GetChildren(); 
 }
 
-std::string AParamListNode::ToString(size_t indent)
+void AParamListNode::WriteToStream(std::ostream& stream, size_t indent)
 {
-    std::stringstream ss;
-    WriteIndentToStream(ss, indent);
-    ss << "AParams\n";
+    WriteIndentToStream(stream, indent);
+    stream << "AParams\n";
     for (ASTNode* param : GetChildren())
     {
-        ss << param->ToString(indent + 1);
+        param->WriteToStream(stream, indent + 1);
     }
-    return ss.str();
 }
 
 void AParamListNode::AcceptVisit(Visitor* visitor) 
@@ -897,7 +792,7 @@ FuncCallNode::FuncCallNode(IDNode* id, AParamListNode* parameters)
 IDNode* FuncCallNode::GetID() { return (IDNode*)GetChild(0); }
 AParamListNode* FuncCallNode::GetParameters() { return (AParamListNode*)GetChild(1); }
 
-std::string FuncCallNode::GetEvaluatedType() 
+TypeID FuncCallNode::GetEvaluatedTypeID() 
 {
     if (HasDotForParent(this))
     {
@@ -907,25 +802,22 @@ std::string FuncCallNode::GetEvaluatedType()
         
         if (context == nullptr)
         {
-            return InvalidType;
+            return TypeTable::GetInvalidType();
         }
-        return GetEvaluatedType(context);
+        return GetEvaluatedTypeID(context);
     }
     else
     {
-        return GetEvaluatedType(GetSymbolTable());
+        return GetEvaluatedTypeID(GetSymbolTable());
     }
 }
 
-std::string FuncCallNode::ToString(size_t indent)
+void FuncCallNode::WriteToStream(std::ostream& stream, size_t indent)
 {
-    std::stringstream ss;
-    WriteIndentToStream(ss, indent);
-    ss << "FuncCall\n";
-    ss << GetID()->ToString(indent + 1);
-    ss << GetParameters()->ToString(indent + 1);
-
-    return ss.str();
+    WriteIndentToStream(stream, indent);
+    stream << "FuncCall\n";
+    GetID()->WriteToStream(stream, indent + 1);
+    GetParameters()->WriteToStream(stream, indent + 1);
 }
 
 void FuncCallNode::AcceptVisit(Visitor* visitor) 
@@ -934,34 +826,32 @@ void FuncCallNode::AcceptVisit(Visitor* visitor)
     visitor->Visit(this); 
 }
 
-std::string FuncCallNode::GetEvaluatedType(SymbolTable* context)
+TypeID FuncCallNode::GetEvaluatedTypeID(SymbolTable* context)
 {
-    SymbolTableEntry* entry = context->FindEntryInScope(GetID()->GetID().GetLexeme());
+    SymbolTableEntry* entry = context->FindEntryInScope(GetID()->GetID().GetLexemeID());
     if (entry == nullptr)
     {
-        return InvalidType;
+        return TypeTable::GetInvalidType();
     }
 
     ASSERT(entry->GetKind() == SymbolTableEntryKind::FreeFunction 
         || entry->GetKind() == SymbolTableEntryKind::MemFuncDecl 
         || entry->GetKind() == SymbolTableEntryKind::ConstructorDecl);
 
-    return entry->GetEvaluatedType();
+    return entry->GetEvaluatedTypeID();
 }
 
 // StatBlockNode ///////////////////////////////////////////////////
 void StatBlockNode::AddLoopingChild(ASTNode* statement) { AddChildFirst(statement); }
 
-std::string StatBlockNode::ToString(size_t indent)
+void StatBlockNode::WriteToStream(std::ostream& stream, size_t indent)
 {
-    std::stringstream ss;
-    WriteIndentToStream(ss, indent);
-    ss << "StatBlock\n";
+    WriteIndentToStream(stream, indent);
+    stream << "StatBlock\n";
     for (ASTNode* statement : GetChildren())
     {
-        ss << statement->ToString(indent + 1);
+        statement->WriteToStream(stream, indent + 1);
     }
-    return ss.str();
 }
 
 void StatBlockNode::AcceptVisit(Visitor* visitor) 
@@ -974,18 +864,15 @@ void StatBlockNode::AcceptVisit(Visitor* visitor)
 FParamNode::FParamNode(IDNode* id, TypeNode* type, DimensionNode* dimension)
     : VarDeclNode(id, type, dimension) { }
 
-std::string FParamNode::GetEvaluatedType()  { return GetID()->GetEvaluatedType(); }
+TypeID FParamNode::GetEvaluatedTypeID()  { return GetID()->GetEvaluatedTypeID(); }
 
-std::string FParamNode::ToString(size_t indent)
+void FParamNode::WriteToStream(std::ostream& stream, size_t indent)
 {
-    std::stringstream ss;
-    WriteIndentToStream(ss, indent);
-    ss << "FParam\n";
-    ss << GetID()->ToString(indent + 1);
-    ss << GetType()->ToString(indent + 1);
-    ss << GetChild(2)->ToString(indent + 1);
-
-    return ss.str();
+    WriteIndentToStream(stream, indent);
+    stream << "FParam\n";
+    GetID()->WriteToStream(stream, indent + 1);
+    GetType()->WriteToStream(stream, indent + 1);
+    GetChild(2)->WriteToStream(stream, indent + 1);
 }
 
 void FParamNode::AcceptVisit(Visitor* visitor) 
@@ -1005,17 +892,14 @@ const std::list<ASTNode*>& FParamListNode::GetChildren() const
     return ASTNodeBase::GetChildren();
 }
 
-std::string FParamListNode::ToString(size_t indent)
+void FParamListNode::WriteToStream(std::ostream& stream, size_t indent)
 {
-    std::stringstream ss;
-    WriteIndentToStream(ss, indent);
-    ss << "FParamList\n";
+    WriteIndentToStream(stream, indent);
+    stream << "FParamList\n";
     for (ASTNode* param : GetChildren())
     {
-        ss << param->ToString(indent + 1);
+        param->WriteToStream(stream, indent + 1);
     }
-
-    return ss.str();
 }
 
 void FParamListNode::AcceptVisit(Visitor* visitor) 
@@ -1042,22 +926,19 @@ StatBlockNode* FunctionDefNode::GetBody() { return (StatBlockNode*)GetChild(3);
 SymbolTable* FunctionDefNode::GetSymbolTable() { return m_symbolTable; }
 void FunctionDefNode::SetSymbolTable(SymbolTable* table) { m_symbolTable = table; }
 
-std::string FunctionDefNode::GetEvaluatedType()
+TypeID FunctionDefNode::GetEvaluatedTypeID()
 {
-    return GetReturnType()->GetEvaluatedType();
+    return GetReturnType()->GetEvaluatedTypeID();
 }
 
-std::string FunctionDefNode::ToString(size_t indent)
+void FunctionDefNode::WriteToStream(std::ostream& stream, size_t indent)
 {
-    std::stringstream ss;
-    WriteIndentToStream(ss, indent);
-    ss << "FuncDef\n";
-    ss << GetID()->ToString(indent + 1);
-    ss << GetReturnType()->ToString(indent + 1);
-    ss << GetParameters()->ToString(indent + 1);
-    ss << GetBody()->ToString(indent + 1);
-
-    return ss.str();
+    WriteIndentToStream(stream, indent);
+    stream << "FuncDef\n";
+    GetID()->WriteToStream(stream, indent + 1);
+    GetReturnType()->WriteToStream(stream, indent + 1);
+    GetParameters()->WriteToStream(stream, indent + 1);
+    GetBody()->WriteToStream(stream, indent + 1);
 }
 
 void FunctionDefNode::AcceptVisit(Visitor* visitor) 
@@ -1078,15 +959,12 @@ Token VisibilityNode::GetFirstToken() const
     return Token();
 }
 
-std::string VisibilityNode::ToString(size_t indent)
+void VisibilityNode::WriteToStream(std::ostream& stream, size_t indent)
 {
-    std::stringstream ss;
-    WriteIndentToStream(ss, indent);
-    ss << "Visibility\n";
-    WriteIndentToStream(ss, indent + 1);
-    ss << m_visibility << "\n";
-
-    return ss.str();
+    WriteIndentToStream(stream, indent);
+    stream << "Visibility\n";
+    WriteIndentToStream(stream, indent + 1);
+    stream << m_visibility << "\n";
 }
 
 void VisibilityNode::AcceptVisit(Visitor* visitor) { visitor->Visit(this); }
@@ -1109,17 +987,14 @@ VisibilityNode* MemVarNode::GetVisibility()
     return (VisibilityNode*)GetChild(3);
 }
 
-std::string MemVarNode::ToString(size_t indent)
+void MemVarNode::WriteToStream(std::ostream& stream, size_t indent)
 {
-    std::stringstream ss;
-    WriteIndentToStream(ss, indent);
-    ss << "MemVar\n";
-    ss << GetVisibility()->ToString(indent + 1);
-    ss << GetID()->ToString(indent + 1);
-    ss << GetType()->ToString(indent + 1);
-    ss << GetDimension()->ToString(indent + 1);
-
-    return ss.str();
+    WriteIndentToStream(stream, indent);
+    stream << "MemVar\n";
+    GetVisibility()->WriteToStream(stream, indent + 1);
+    GetID()->WriteToStream(stream, indent + 1);
+    GetType()->WriteToStream(stream, indent + 1);
+    GetDimension()->WriteToStream(stream, indent + 1);
 }
 
 void MemVarNode::AcceptVisit(Visitor* visitor) 
@@ -1161,17 +1036,14 @@ FParamListNode* MemFuncDeclNode::GetParameters()
 SymbolTable* MemFuncDeclNode::GetSymbolTable() { return m_symbolTable; }
 void MemFuncDeclNode::SetSymbolTable(SymbolTable* table) { m_symbolTable = table; }
 
-std::string MemFuncDeclNode::ToString(size_t indent)
+void MemFuncDeclNode::WriteToStream(std::ostream& stream, size_t indent)
 {
-    std::stringstream ss;
-    WriteIndentToStream(ss, indent);
-    ss << "MemFuncDecl\n";
-    ss << GetVisibility()->ToString(indent + 1);
-    ss << GetID()->ToString(indent + 1);
-    ss << GetParameters()->ToString(indent + 1);
-    ss << GetReturnType()->ToString(indent + 1);
-
-    return ss.str();
+    WriteIndentToStream(stream, indent);
+    stream << "MemFuncDecl\n";
+    GetVisibility()->WriteToStream(stream, indent + 1);
+    GetID()->WriteToStream(stream, indent + 1);
+    GetParameters()->WriteToStream(stream, indent + 1);
+    GetReturnType()->WriteToStream(stream, indent + 1);
 }
 
 void MemFuncDeclNode::AcceptVisit(Visitor* visitor) 
@@ -1190,18 +1062,15 @@ MemFuncDefNode::MemFuncDefNode(IDNode* classID, IDNode* id, TypeNode* returnType
 
 IDNode* MemFuncDefNode::GetClassID() { return (IDNode*)GetChild(4); }
 
-std::string MemFuncDefNode::ToString(size_t indent)
+void MemFuncDefNode::WriteToStream(std::ostream& stream, size_t indent)
 {
-    std::stringstream ss;
-    WriteIndentToStream(ss, indent);
-    ss << "MemFuncDef\n";
-    ss << GetClassID()->ToString(indent + 1);
-    ss << GetID()->ToString(indent + 1);
-    ss << GetReturnType()->ToString(indent + 1);
-    ss << GetParameters()->ToString(indent + 1);
-    ss << GetBody()->ToString(indent + 1);
-
-    return ss.str();
+    WriteIndentToStream(stream, indent);
+    stream << "MemFuncDef\n";
+    GetClassID()->WriteToStream(stream, indent + 1);
+    GetID()->WriteToStream(stream, indent + 1);
+    GetReturnType()->WriteToStream(stream, indent + 1);
+    GetParameters()->WriteToStream(stream, indent + 1);
+    GetBody()->WriteToStream(stream, indent + 1);
 }
 
 void MemFuncDefNode::AcceptVisit(Visitor* visitor) 
@@ -1225,15 +1094,12 @@ const Token& ConstructorDeclNode::GetToken() const { return m_constructorToken;
 SymbolTable* ConstructorDeclNode::GetSymbolTable() { return m_symbolTable; }
 void ConstructorDeclNode::SetSymbolTable(SymbolTable* table) { m_symbolTable = table; }
 
-std::string ConstructorDeclNode::ToString(size_t indent)
+void ConstructorDeclNode::WriteToStream(std::ostream& stream, size_t indent)
 {
-    std::stringstream ss;
-    WriteIndentToStream(ss, indent);
-    ss << "ConstructorDecl\n";
-    ss << GetVisibility()->ToString(indent + 1);
-    ss << GetParameters()->ToString(indent + 1);
-
-    return ss.str();
+    WriteIndentToStream(stream, indent);
+    stream << "ConstructorDecl\n";
+    GetVisibility()->WriteToStream(stream, indent + 1);
+    GetParameters()->WriteToStream(stream, indent + 1);
 }
 
 void ConstructorDeclNode::AcceptVisit(Visitor* visitor) 
@@ -1247,16 +1113,13 @@ ConstructorDefNode::ConstructorDefNode(IDNode* classID, FParamListNode* params,
     StatBlockNode* body) : FunctionDefNode(classID, new TypeNode(classID->GetID()), 
     params, body) { }
 
-std::string ConstructorDefNode::ToString(size_t indent)
+void ConstructorDefNode::WriteToStream(std::ostream& stream, size_t indent)
 {
-    std::stringstream ss;
-    WriteIndentToStream(ss, indent);
-    ss << "ConstructorDef\n";
-    ss << GetReturnType()->ToString(indent + 1);
-    ss << GetParameters()->ToString(indent + 1);
-    ss << GetBody()->ToString(indent + 1);
-
-    return ss.str();
+    WriteIndentToStream(stream, indent);
+    stream << "ConstructorDef\n";
+    GetReturnType()->WriteToStream(stream, indent + 1);
+    GetParameters()->WriteToStream(stream, indent + 1);
+    GetBody()->WriteToStream(stream, indent + 1);
 }
 
 void ConstructorDefNode::AcceptVisit(Visitor* visitor) 
@@ -1282,17 +1145,14 @@ bool InheritanceListNode::ContainsClassName(const std::string& className) const
     return false;
 }
 
-std::string InheritanceListNode::ToString(size_t indent)
+void InheritanceListNode::WriteToStream(std::ostream& stream, size_t indent)
 {
-    std::stringstream ss;
-    WriteIndentToStream(ss, indent);
-    ss << "InheritanceList\n";
+    WriteIndentToStream(stream, indent);
+    stream << "InheritanceList\n";
     for (ASTNode* id : GetChildren())
     {
-        ss << id->ToString(indent + 1);
+        id->WriteToStream(stream, indent + 1);
     }
-
-    return ss.str();
 }
 
 void InheritanceListNode::AcceptVisit(Visitor* visitor) 
@@ -1363,29 +1223,26 @@ std::list<MemVarNode*>& ClassDefNode::GetVarDecls() { return m_varDeclarations;
 std::list<ConstructorDeclNode*>& ClassDefNode::GetConstructors() { return m_constructors; }
 std::list<MemFuncDeclNode*>& ClassDefNode::GetFuncDecls() { return m_functionDeclarations; }
 
-std::string ClassDefNode::ToString(size_t indent)
+void ClassDefNode::WriteToStream(std::ostream& stream, size_t indent)
 {
-    std::stringstream ss;
-    WriteIndentToStream(ss, indent);
-    ss << "ClassDef\n";
-    ss << GetID()->ToString(indent + 1);
-    ss << GetInheritanceList()->ToString(indent + 1);
+    WriteIndentToStream(stream, indent);
+    stream << "ClassDef\n";
+    GetID()->WriteToStream(stream, indent + 1);
+    GetInheritanceList()->WriteToStream(stream, indent + 1);
     for (MemVarNode* memVar : m_varDeclarations)
     {
-        ss << memVar->ToString(indent + 1);
+        memVar->WriteToStream(stream, indent + 1);
     }
 
     for (ConstructorDeclNode* constructor : m_constructors)
     {
-        ss << constructor->ToString(indent + 1);
+        constructor->WriteToStream(stream, indent + 1);
     }
 
     for (MemFuncDeclNode* memFunc : m_functionDeclarations)
     {
-        ss << memFunc->ToString(indent + 1);
+        memFunc->WriteToStream(stream, indent + 1);
     }
-
-    return ss.str();
 }
 
 void ClassDefNode::AcceptVisit(Visitor* visitor) 
@@ -1416,22 +1273,40 @@ void ClassDefListNode::AddClass(ClassDefNode* classDef)
     AddChild(classDef);
 }
 
-std::string ClassDefListNode::ToString(size_t indent) 
+void ClassDefListNode::AppendClasses(ClassDefListNode* other)
 {
-    std::stringstream ss;
-    WriteIndentToStream(ss, indent);
-    ss << "ClassDefList\n";
+    for (ASTNode* classDef : other->GetChildren())
+    {
+        AddChild(classDef);
+    }
+    other->ASTNodeBase::GetChildren().clear();
+}
+
+void ClassDefListNode::WriteToStream(std::ostream& stream, size_t indent)
+{
+    WriteIndentToStream(stream, indent);
+    stream << "ClassDefList\n";
     for (ASTNode* classDef : GetChildren())
     {
-        ss << classDef->ToString(indent + 1);
+        classDef->WriteToStream(stream, indent + 1);
     }
+}
 
-    return ss.str();
+const std::list<ASTNode*>& ClassDefListNode::GetChildren() const 
+{ 
+    return ASTNodeBase::GetChildren(); 
 }
 
 void ClassDefListNode::AcceptVisit(Visitor* visitor) 
 { 
-    ChildrenAcceptVisit(visitor);
+    for (ASTNode* classDef : GetChildren())
+    {
+        if (visitor->ShouldStopVisiting())
+        {
+            break;
+        }
+        classDef->AcceptVisit(visitor);
+    }
     visitor->Visit(this); 
 }
 
@@ -1441,22 +1316,40 @@ void FunctionDefListNode::AddFunc(FunctionDefNode* funcDef)
     AddChild(funcDef);
 }
 
-std::string FunctionDefListNode::ToString(size_t indent)
+void FunctionDefListNode::AppendFuncs(FunctionDefListNode* other)
 {
-    std::stringstream ss;
-    WriteIndentToStream(ss, indent);
-    ss << "FuncDefList\n";
+    for (ASTNode* funcDef : other->GetChildren())
+    {
+        AddChild(funcDef);
+    }
+    other->ASTNodeBase::GetChildren().clear();
+}
+
+void FunctionDefListNode::WriteToStream(std::ostream& stream, size_t indent)
+{
+    WriteIndentToStream(stream, indent);
+    stream << "FuncDefList\n";
     for (ASTNode* funcDef : GetChildren())
     {
-        ss << funcDef->ToString(indent + 1);
+        funcDef->WriteToStream(stream, indent + 1);
     }
+}
 
-    return ss.str();
+const std::list<ASTNode*>& FunctionDefListNode::GetChildren() const 
+{ 
+    return ASTNodeBase::GetChildren(); 
 }
 
 void FunctionDefListNode::AcceptVisit(Visitor* visitor) 
 {
-    ChildrenAcceptVisit(visitor);
+    for (ASTNode* funcDef : GetChildren())
+    {
+        if (visitor->ShouldStopVisiting())
+        {
+            break;
+        }
+        funcDef->AcceptVisit(visitor);
+    }
     visitor->Visit(this); 
 }
 
@@ -1480,15 +1373,12 @@ FunctionDefListNode* ProgramNode::GetFunctionList()
 SymbolTable* ProgramNode::GetSymbolTable() { return m_globalTable; }
 void ProgramNode::SetSymbolTable(SymbolTable* table) { m_globalTable = table; }
 
-std::string ProgramNode::ToString(size_t indent)
+void ProgramNode::WriteToStream(std::ostream& stream, size_t indent)
 {
-    std::stringstream ss;
-    WriteIndentToStream(ss, indent);
-    ss << "Program\n";
-    ss << GetClassList()->ToString(indent + 1);
-    ss << GetFunctionList()->ToString(indent + 1);
-
-    return ss.str();
+    WriteIndentToStream(stream, indent);
+    stream << "Program\n";
+    GetClassList()->WriteToStream(stream, indent + 1);
+    GetFunctionList()->WriteToStream(stream, indent + 1);
 }
 
 void ProgramNode::AcceptVisit(Visitor* visitor) 
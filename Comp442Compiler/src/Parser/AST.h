@@ -4,6 +4,7 @@
 #include <sstream>
 
 #include "../SemanticChecking/Visitor.h"
+#include "../SemanticChecking/TypeTable.h"
 #include "../Core/Token.h"
 
 class SymbolTable;
@@ -15,9 +16,21 @@ class AParamListNode;
 class ASTNode : public IVisitableElement
 {
 public:
+    ASTNode();
     virtual ~ASTNode();
 
-    virtual std::string GetEvaluatedType();
+    // computed from the type ids of the declarations, GetEvaluatedType returns its string
+    virtual TypeID GetEvaluatedTypeID();
+    const std::string& GetEvaluatedType();
+
+    // stores the result of GetEvaluatedTypeID so it is only computed once, should only be 
+    // called once the symbol tables are complete (after semantic checking)
+    void CacheEvaluatedType();
+
+    // returns the cached evaluated type, computing and caching it if it was never cached
+    const std::string& GetCachedEvaluatedType();
+    TypeID GetCachedEvaluatedTypeID();
+
     virtual ASTNode* GetParent() = 0;
     virtual const ASTNode* GetParent() const = 0;
     virtual void SetParent(ASTNode* parent) = 0;
@@ -28,9 +41,15 @@ public:
     // retrieves the symbol table containing this node
     virtual SymbolTable* GetSymbolTable();
 
-    virtual std::string ToString(size_t indent = 0) = 0;
+    // writes the tree rooted at this node directly to the stream in a single pass
+    virtual void WriteToStream(std::ostream& stream, size_t indent = 0) = 0;
+    std::string ToString(size_t indent = 0);
 
     static constexpr const char* InvalidType = "";
+
+private:
+    TypeID m_cachedEvaluatedType;
+    bool m_hasCachedEvaluatedType;
 };
 
 // node that generates a temp variable
@@ -43,6 +62,7 @@ public:
 
 class ASTNodeBase : public ASTNode
 {
+    friend class ASTSerializer;
 public:
     ASTNodeBase();
     virtual ~ASTNodeBase();
@@ -112,35 +132,12 @@ private:
     ASTNode* m_parent;
 };
 
-// represent an empty node used only during the construction of the AST
-class EmptyNodeBase : public ASTNode 
-{
-public:
-    virtual ASTNode* GetParent() override;
-    virtual const ASTNode* GetParent() const override;
-    virtual void SetParent(ASTNode* parent) override;
-
-    virtual size_t GetNumChild() const override;
-
-    virtual std::string ToString(size_t indent = 0) override;
-    virtual Token GetFirstToken() const override;
-
-    virtual void AcceptVisit(Visitor* visitor) override;
-};
-// serves as stop point when looping
-class StopNode : public EmptyNodeBase { };
-
-// used to differentiate between free functions, member functions and constructors
-class FreeFuncMarkerNode : public EmptyNodeBase { };
-class MemFuncMarkerNode : public EmptyNodeBase { };
-class ConstructorMarkerNode : public EmptyNodeBase { };
-
 // serves as a marker when an array size is not specified
 class UnspecificedDimensionNode : public LeafNode 
 { 
 public:
     virtual Token GetFirstToken() const override;
-    virtual std::string ToString(size_t indent = 0) override;
+    virtual void WriteToStream(std::ostream& stream, size_t indent = 0) override;
     virtual void AcceptVisit(Visitor* visitor) override;
 };
 
@@ -150,13 +147,13 @@ public:
     IDNode(const Token& id);
 
     const Token& GetID() const;
-    virtual std::string GetEvaluatedType() override;
+    virtual TypeID GetEvaluatedTypeID() override;
     virtual Token GetFirstToken() const override;
 
-    virtual std::string ToString(size_t indent = 0) override;
+    virtual void WriteToStream(std::ostream& stream, size_t indent = 0) override;
     virtual void AcceptVisit(Visitor* visitor) override;
 private:
-    std::string GetEvaluatedTypeWithoutDot();
+    TypeID GetEvaluatedTypeIDWithoutDot();
 
     Token m_id;
 };
@@ -168,10 +165,10 @@ public:
 
     const Token& GetType() const;
 
-    virtual std::string GetEvaluatedType() override; 
+    virtual TypeID GetEvaluatedTypeID() override; 
     virtual Token GetFirstToken() const override;
 
-    virtual std::string ToString(size_t indent = 0) override;
+    virtual void WriteToStream(std::ostream& stream, size_t indent = 0) override;
     virtual void AcceptVisit(Visitor* visitor) override;
 private:
     Token m_type;
@@ -184,7 +181,7 @@ public:
     const Token& GetOperator() const;
     virtual Token GetFirstToken() const override;
 
-    virtual std::string ToString(size_t indent = 0) override;
+    virtual void WriteToStream(std::ostream& stream, size_t indent = 0) override;
     virtual void AcceptVisit(Visitor* visitor) override;
 
 private:
@@ -201,9 +198,9 @@ public:
     OperatorNode* GetOperator();
     ASTNode* GetRight();
 
-    virtual std::string GetEvaluatedType() override;
+    virtual TypeID GetEvaluatedTypeID() override;
 
-    virtual std::string ToString(size_t indent = 0) override;
+    virtual void WriteToStream(std::ostream& stream, size_t indent = 0) override;
 
 private:
     std::string m_name;
@@ -229,7 +226,7 @@ class RelOpNode : public BaseBinaryOperator
 public:
     RelOpNode(ASTNode* left, OperatorNode* op, ASTNode* right);
 
-    virtual std::string GetEvaluatedType() override;
+    virtual TypeID GetEvaluatedTypeID() override;
     virtual void AcceptVisit(Visitor* visitor) override;
 };
 
@@ -240,8 +237,8 @@ public:
 
     IDNode* GetLexemeNode();
     TypeNode* GetType();
-    virtual std::string GetEvaluatedType() override;
-    virtual std::string ToString(size_t indent = 0) override;
+    virtual TypeID GetEvaluatedTypeID() override;
+    virtual void WriteToStream(std::ostream& stream, size_t indent = 0) override;
     virtual void AcceptVisit(Visitor* visitor) override;
 };
 
@@ -251,7 +248,7 @@ public:
     void AddLoopingChild(ASTNode* dimension);
     
     const std::list<ASTNode*>& GetChildren() const;
-    virtual std::string ToString(size_t indent = 0) override;
+    virtual void WriteToStream(std::ostream& stream, size_t indent = 0) override;
     virtual void AcceptVisit(Visitor* visitor) override;
 };
 
@@ -266,8 +263,8 @@ public:
     DimensionNode* GetDimension();
     AParamListNode* GetParamList();
 
-    virtual std::string GetEvaluatedType() override;
-    virtual std::string ToString(size_t indent = 0) override;
+    virtual TypeID GetEvaluatedTypeID() override;
+    virtual void WriteToStream(std::ostream& stream, size_t indent = 0) override;
     virtual void AcceptVisit(Visitor* visitor) override;
 };
 
@@ -278,9 +275,9 @@ public:
 
     ASTNode* GetLeft();
     ASTNode* GetRight();
-    virtual std::string GetEvaluatedType() override;
+    virtual TypeID GetEvaluatedTypeID() override;
 
-    virtual std::string ToString(size_t indent = 0) override;
+    virtual void WriteToStream(std::ostream& stream, size_t indent = 0) override;
     virtual void AcceptVisit(Visitor* visitor) override;
 };
 
@@ -290,8 +287,8 @@ public:
     ExprNode(ASTNode* exprRoot);
 
     virtual ASTNode* GetRootOfExpr();
-    virtual std::string GetEvaluatedType() override;
-    virtual std::string ToString(size_t indent = 0) override;
+    virtual TypeID GetEvaluatedTypeID() override;
+    virtual void WriteToStream(std::ostream& stream, size_t indent = 0) override;
     virtual void AcceptVisit(Visitor* visitor) override;
 
 protected:
@@ -309,7 +306,7 @@ public:
     const Token& GetSign();
     virtual Token GetFirstToken() const override;
 
-    virtual std::string ToString(size_t indent = 0) override;
+    virtual void WriteToStream(std::ostream& stream, size_t indent = 0) override;
     virtual void AcceptVisit(Visitor* visitor) override;
 
 private:
@@ -321,7 +318,7 @@ class NotNode : public LeafNode
 public:
     NotNode(const Token& t);
     virtual Token GetFirstToken() const override;
-    virtual std::string ToString(size_t indent = 0) override;
+    virtual void WriteToStream(std::ostream& stream, size_t indent = 0) override;
     virtual void AcceptVisit(Visitor* visitor) override;
 
 private:
@@ -338,8 +335,8 @@ public:
     ASTNode* GetModifier();
     ASTNode* GetExpr();
 
-    virtual std::string GetEvaluatedType() override;
-    virtual std::string ToString(size_t indent = 0) override;
+    virtual TypeID GetEvaluatedTypeID() override;
+    virtual void WriteToStream(std::ostream& stream, size_t indent = 0) override;
     virtual void AcceptVisit(Visitor* visitor) override;
 
 private:
@@ -360,7 +357,7 @@ class ReturnStatNode : public BaseLangStatNode
 public:
     ReturnStatNode(ExprNode* expr);
 
-    virtual std::string ToString(size_t indent = 0) override;
+    virtual void WriteToStream(std::ostream& stream, size_t indent = 0) override;
     virtual void AcceptVisit(Visitor* visitor) override;
 };
 
@@ -371,9 +368,9 @@ public:
 
     IDNode* GetVariable();    
     DimensionNode* GetDimension();
-    virtual std::string GetEvaluatedType() override;
+    virtual TypeID GetEvaluatedTypeID() override;
 
-    virtual std::string ToString(size_t indent = 0) override;
+    virtual void WriteToStream(std::ostream& stream, size_t indent = 0) override;
     virtual void AcceptVisit(Visitor* visitor) override;
 };
 
@@ -384,7 +381,7 @@ public:
 
     ASTNode* GetVariable();
 
-    virtual std::string ToString(size_t indent = 0) override;
+    virtual void WriteToStream(std::ostream& stream, size_t indent = 0) override;
     virtual void AcceptVisit(Visitor* visitor) override;
 };
 
@@ -392,7 +389,7 @@ class WriteStatNode : public BaseLangStatNode
 {
 public:
     WriteStatNode(ExprNode* expr);
-    virtual std::string ToString(size_t indent = 0) override;
+    virtual void WriteToStream(std::ostream& stream, size_t indent = 0) override;
     virtual void AcceptVisit(Visitor* visitor) override;
 };
 
@@ -404,7 +401,7 @@ public:
     ASTNode* GetLeft();
     ExprNode* GetRight();
 
-    virtual std::string ToString(size_t indent = 0) override;
+    virtual void WriteToStream(std::ostream& stream, size_t indent = 0) override;
     virtual void AcceptVisit(Visitor* visitor) override;
 };
 
@@ -417,7 +414,7 @@ public:
     StatBlockNode* GetIfBranch();
     StatBlockNode* GetElseBranch();
 
-    virtual std::string ToString(size_t indent = 0) override;
+    virtual void WriteToStream(std::ostream& stream, size_t indent = 0) override;
     virtual void AcceptVisit(Visitor* visitor) override;
 };
 
@@ -429,7 +426,7 @@ public:
     ExprNode* GetCondition();
     StatBlockNode* GetStatBlock();
 
-    virtual std::string ToString(size_t indent = 0) override;
+    virtual void WriteToStream(std::ostream& stream, size_t indent = 0) override;
     virtual void AcceptVisit(Visitor* visitor) override;
 };
 
@@ -439,7 +436,7 @@ public:
     void AddLoopingChild(ASTNode* param);
 
     const std::list<ASTNode*>& GetChildren() const;
-    virtual std::string ToString(size_t indent = 0) override;
+    virtual void WriteToStream(std::ostream& stream, size_t indent = 0) override;
     virtual void AcceptVisit(Visitor* visitor) override;
 
 };
@@ -451,13 +448,13 @@ public:
 
     IDNode* GetID();
     AParamListNode* GetParameters();
-    virtual std::string GetEvaluatedType() override;
+    virtual TypeID GetEvaluatedTypeID() override;
 
-    virtual std::string ToString(size_t indent = 0) override;
+    virtual void WriteToStream(std::ostream& stream, size_t indent = 0) override;
     virtual void AcceptVisit(Visitor* visitor) override;
 
 private:
-    std::string GetEvaluatedType(SymbolTable* context);
+    TypeID GetEvaluatedTypeID(SymbolTable* context);
 };
 
 class StatBlockNode : public ASTNodeBase
@@ -465,7 +462,7 @@ class StatBlockNode : public ASTNodeBase
 public:
     void AddLoopingChild(ASTNode* statement);
 
-    virtual std::string ToString(size_t indent = 0) override;
+    virtual void WriteToStream(std::ostream& stream, size_t indent = 0) override;
     virtual void AcceptVisit(Visitor* visitor) override;
 };
 
@@ -474,8 +471,8 @@ class FParamNode : public VarDeclNode
 public:
     FParamNode(IDNode* id, TypeNode* type, DimensionNode* dimension);
 
-    virtual std::string GetEvaluatedType() override;
-    virtual std::string ToString(size_t indent = 0) override;
+    virtual TypeID GetEvaluatedTypeID() override;
+    virtual void WriteToStream(std::ostream& stream, size_t indent = 0) override;
     virtual void AcceptVisit(Visitor* visitor) override;
 };
 
@@ -485,7 +482,7 @@ public:
     void AddLoopingChild(ASTNode* param);
 
     const std::list<ASTNode*>& GetChildren() const;
-    virtual std::string ToString(size_t indent = 0) override;
+    virtual void WriteToStream(std::ostream& stream, size_t indent = 0) override;
     virtual void AcceptVisit(Visitor* visitor) override;
 };
 
@@ -501,9 +498,9 @@ public:
     StatBlockNode* GetBody();
     SymbolTable* GetSymbolTable() override;
     void SetSymbolTable(SymbolTable* table);
-    virtual std::string GetEvaluatedType() override;
+    virtual TypeID GetEvaluatedTypeID() override;
 
-    virtual std::string ToString(size_t indent = 0) override;
+    virtual void WriteToStream(std::ostream& stream, size_t indent = 0) override;
     virtual void AcceptVisit(Visitor* visitor) override;
 
 private:
@@ -518,7 +515,7 @@ public:
     const std::string& GetVisibility() const;
     virtual Token GetFirstToken() const override;
 
-    virtual std::string ToString(size_t indent = 0) override;
+    virtual void WriteToStream(std::ostream& stream, size_t indent = 0) override;
     virtual void AcceptVisit(Visitor* visitor) override;
     
 private:
@@ -541,7 +538,7 @@ public:
 
     VisibilityNode* GetVisibility();
 
-    virtual std::string ToString(size_t indent = 0) override;
+    virtual void WriteToStream(std::ostream& stream, size_t indent = 0) override;
     virtual void AcceptVisit(Visitor* visitor) override;
 };
 
@@ -558,7 +555,7 @@ public:
     SymbolTable* GetSymbolTable() override;
     void SetSymbolTable(SymbolTable* table);
 
-    virtual std::string ToString(size_t indent = 0) override;
+    virtual void WriteToStream(std::ostream& stream, size_t indent = 0) override;
     virtual void AcceptVisit(Visitor* visitor) override;
 
 private:
@@ -573,7 +570,7 @@ public:
 
     IDNode* GetClassID();
 
-    virtual std::string ToString(size_t indent = 0) override;
+    virtual void WriteToStream(std::ostream& stream, size_t indent = 0) override;
     virtual void AcceptVisit(Visitor* visitor) override;
 };
 
@@ -590,7 +587,7 @@ public:
     SymbolTable* GetSymbolTable() override;
     void SetSymbolTable(SymbolTable* table);
 
-    virtual std::string ToString(size_t indent = 0) override;
+    virtual void WriteToStream(std::ostream& stream, size_t indent = 0) override;
     virtual void AcceptVisit(Visitor* visitor) override;
 private:
     Token m_constructorToken;
@@ -602,7 +599,7 @@ class ConstructorDefNode : public FunctionDefNode
 public:
     ConstructorDefNode(IDNode* classID, FParamListNode* params, StatBlockNode* body);
 
-    virtual std::string ToString(size_t indent = 0) override;
+    virtual void WriteToStream(std::ostream& stream, size_t indent = 0) override;
     virtual void AcceptVisit(Visitor* visitor) override;
 };
 
@@ -613,7 +610,7 @@ public:
     
     bool ContainsClassName(const std::string& className) const;
 
-    virtual std::string ToString(size_t indent = 0) override;
+    virtual void WriteToStream(std::ostream& stream, size_t indent = 0) override;
     virtual void AcceptVisit(Visitor* visitor) override;
 
     const std::list<ASTNode*>& GetChildren() const;
@@ -638,7 +635,7 @@ public:
     std::list<ConstructorDeclNode*>& GetConstructors();
     std::list<MemFuncDeclNode*>& GetFuncDecls();
 
-    virtual std::string ToString(size_t indent = 0) override;
+    virtual void WriteToStream(std::ostream& stream, size_t indent = 0) override;
     virtual void AcceptVisit(Visitor* visitor) override;
 
 private:
@@ -653,7 +650,11 @@ class ClassDefListNode : public ASTNodeBase
 public:
     void AddClass(ClassDefNode* classDef);
 
-    virtual std::string ToString(size_t indent = 0) override;
+    // moves the classes of the other list to the end of this one
+    void AppendClasses(ClassDefListNode* other);
+
+    const std::list<ASTNode*>& GetChildren() const;
+    virtual void WriteToStream(std::ostream& stream, size_t indent = 0) override;
     virtual void AcceptVisit(Visitor* visitor) override;
 };
 
@@ -662,7 +663,11 @@ class FunctionDefListNode : public ASTNodeBase
 public:
     void AddFunc(FunctionDefNode* funcDef);
 
-    virtual std::string ToString(size_t indent = 0) override;
+    // moves the functions of the other list to the end of this one
+    void AppendFuncs(FunctionDefListNode* other);
+
+    const std::list<ASTNode*>& GetChildren() const;
+    virtual void WriteToStream(std::ostream& stream, size_t indent = 0) override;
     virtual void AcceptVisit(Visitor* visitor) override;
 };
 
@@ -676,7 +681,7 @@ public:
     SymbolTable* GetSymbolTable() override;
     void SetSymbolTable(SymbolTable* table);
 
-    virtual std::string ToString(size_t indent = 0) override;
+    virtual void WriteToStream(std::ostream& stream, size_t indent = 0) override;
     virtual void AcceptVisit(Visitor* visitor) override;
 
 private:
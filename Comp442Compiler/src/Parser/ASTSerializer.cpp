@@ -0,0 +1,781 @@
+#include "ASTSerializer.h"
+#include "AST.h"
+#include "../Core/Core.h"
+#include "../Core/Util.h"
+#include "../Core/OutputFiles.h"
+#include "../Lexer/Lexer.h"
+
+#include <fstream>
+#include <sstream>
+#include <iterator>
+
+// ASTSerializer ///////////////////////////////////////////////////////////
+void ASTSerializer::Serialize(ProgramNode* program, std::ostream& stream)
+{
+    ASTSerializer serializer;
+    serializer.WriteNode(program);
+    std::string tree = std::move(serializer.m_buffer);
+
+    // the name table can only be written once every name of the tree has been encountered
+    serializer.m_buffer.clear();
+    serializer.m_buffer.append(s_magic);
+    serializer.m_buffer.push_back((char)s_version);
+    serializer.WriteNum(serializer.m_names.size());
+    for (const std::string& name : serializer.m_names)
+    {
+        serializer.WriteNum(name.length());
+        serializer.m_buffer.append(name);
+    }
+
+    stream.write(serializer.m_buffer.data(), serializer.m_buffer.size());
+    stream.write(tree.data(), tree.size());
+}
+
+ProgramNode* ASTSerializer::Deserialize(std::istream& stream, int64_t lineOffset)
+{
+    ASTSerializer serializer;
+    serializer.m_lineOffset = lineOffset;
+    serializer.m_buffer.assign(std::istreambuf_iterator<char>(stream),
+        std::istreambuf_iterator<char>());
+
+    std::string magic = s_magic;
+    if (serializer.m_buffer.compare(0, magic.length(), magic) != 0
+        || serializer.m_buffer.length() <= magic.length()
+        || (uint8_t)serializer.m_buffer[magic.length()] != s_version)
+    {
+        return nullptr;
+    }
+    serializer.m_readPos = magic.length() + 1;
+
+    // every name and every child takes at least one byte so larger counts are invalid
+    size_t numNames;
+    if (!serializer.ReadNum(numNames)
+        || numNames > serializer.m_buffer.length() - serializer.m_readPos)
+    {
+        return nullptr;
+    }
+
+    serializer.m_names.reserve(numNames);
+    for (size_t i = 0; i < numNames; i++)
+    {
+        size_t length;
+        if (!serializer.ReadNum(length)
+            || length > serializer.m_buffer.length() - serializer.m_readPos)
+        {
+            return nullptr;
+        }
+        serializer.m_names.push_back(serializer.m_buffer.substr(serializer.m_readPos, length));
+        serializer.m_readPos += length;
+    }
+
+    ProgramNode* program = dynamic_cast<ProgramNode*>(serializer.ReadNode());
+    if (program != nullptr && serializer.m_readPos != serializer.m_buffer.length())
+    {
+        delete program;
+        return nullptr;
+    }
+    return program;
+}
+
+ProgramNode* ASTSerializer::Copy(ProgramNode* program, int64_t lineOffset)
+{
+    ASTSerializer serializer;
+    serializer.m_lineOffset = lineOffset;
+    return (ProgramNode*)serializer.CopyNode(program);
+}
+
+ASTSerializer::ASTSerializer() : m_readPos(0), m_lineOffset(0) { }
+
+ASTSerializer::NodeTag ASTSerializer::GetTag(ASTNode* node)
+{
+    // derived classes must be checked before their base class
+    if (dynamic_cast<UnspecificedDimensionNode*>(node) != nullptr) { return NodeTag::UnspecifiedDimension; }
+    else if (dynamic_cast<IDNode*>(node) != nullptr) { return NodeTag::ID; }
+    else if (dynamic_cast<TypeNode*>(node) != nullptr) { return NodeTag::Type; }
+    else if (dynamic_cast<OperatorNode*>(node) != nullptr) { return NodeTag::Operator; }
+    else if (dynamic_cast<AddOpNode*>(node) != nullptr) { return NodeTag::AddOp; }
+    else if (dynamic_cast<MultOpNode*>(node) != nullptr) { return NodeTag::MultOp; }
+    else if (dynamic_cast<RelOpNode*>(node) != nullptr) { return NodeTag::RelOp; }
+    else if (dynamic_cast<LiteralNode*>(node) != nullptr) { return NodeTag::Literal; }
+    else if (dynamic_cast<DimensionNode*>(node) != nullptr) { return NodeTag::Dimension; }
+    else if (dynamic_cast<FParamNode*>(node) != nullptr) { return NodeTag::FParam; }
+    else if (dynamic_cast<MemVarNode*>(node) != nullptr) { return NodeTag::MemVar; }
+    else if (dynamic_cast<VarDeclNode*>(node) != nullptr) { return NodeTag::VarDecl; }
+    else if (dynamic_cast<DotNode*>(node) != nullptr) { return NodeTag::Dot; }
+    else if (dynamic_cast<ModifiedExpr*>(node) != nullptr) { return NodeTag::ModifiedExpr; }
+    else if (dynamic_cast<ExprNode*>(node) != nullptr) { return NodeTag::Expr; }
+    else if (dynamic_cast<SignNode*>(node) != nullptr) { return NodeTag::Sign; }
+    else if (dynamic_cast<NotNode*>(node) != nullptr) { return NodeTag::Not; }
+    else if (dynamic_cast<ReturnStatNode*>(node) != nullptr) { return NodeTag::ReturnStat; }
+    else if (dynamic_cast<VariableNode*>(node) != nullptr) { return NodeTag::Variable; }
+    else if (dynamic_cast<ReadStatNode*>(node) != nullptr) { return NodeTag::ReadStat; }
+    else if (dynamic_cast<WriteStatNode*>(node) != nullptr) { return NodeTag::WriteStat; }
+    else if (dynamic_cast<AssignStatNode*>(node) != nullptr) { return NodeTag::AssignStat; }
+    else if (dynamic_cast<IfStatNode*>(node) != nullptr) { return NodeTag::IfStat; }
+    else if (dynamic_cast<WhileStatNode*>(node) != nullptr) { return NodeTag::WhileStat; }
+    else if (dynamic_cast<AParamListNode*>(node) != nullptr) { return NodeTag::AParamList; }
+    else if (dynamic_cast<FuncCallNode*>(node) != nullptr) { return NodeTag::FuncCall; }
+    else if (dynamic_cast<StatBlockNode*>(node) != nullptr) { return NodeTag::StatBlock; }
+    else if (dynamic_cast<FParamListNode*>(node) != nullptr) { return NodeTag::FParamList; }
+    else if (dynamic_cast<MemFuncDefNode*>(node) != nullptr) { return NodeTag::MemFuncDef; }
+    else if (dynamic_cast<ConstructorDefNode*>(node) != nullptr) { return NodeTag::ConstructorDef; }
+    else if (dynamic_cast<FunctionDefNode*>(node) != nullptr) { return NodeTag::FunctionDef; }
+    else if (dynamic_cast<DefaultVisibilityNode*>(node) != nullptr) { return NodeTag::DefaultVisibility; }
+    else if (dynamic_cast<VisibilityNode*>(node) != nullptr) { return NodeTag::Visibility; }
+    else if (dynamic_cast<MemFuncDeclNode*>(node) != nullptr) { return NodeTag::MemFuncDecl; }
+    else if (dynamic_cast<ConstructorDeclNode*>(node) != nullptr) { return NodeTag::ConstructorDecl; }
+    else if (dynamic_cast<InheritanceListNode*>(node) != nullptr) { return NodeTag::InheritanceList; }
+    else if (dynamic_cast<ClassDefNode*>(node) != nullptr) { return NodeTag::ClassDef; }
+    else if (dynamic_cast<ProgramNode*>(node) != nullptr) { return NodeTag::Program; }
+
+    return NodeTag::Invalid;
+}
+
+void ASTSerializer::WriteNode(ASTNode* node)
+{
+    NodeTag tag = GetTag(node);
+    ASSERT(tag != NodeTag::Invalid);
+    m_buffer.push_back((char)tag);
+
+    switch (tag)
+    {
+    case NodeTag::UnspecifiedDimension:
+    case NodeTag::DefaultVisibility:
+        break;
+
+    case NodeTag::ID:
+    case NodeTag::Type:
+    case NodeTag::Operator:
+    case NodeTag::Sign:
+    case NodeTag::Not:
+        WriteToken(node->GetFirstToken());
+        break;
+
+    case NodeTag::Visibility:
+        WriteName(((VisibilityNode*)node)->GetVisibility());
+        break;
+
+    case NodeTag::ConstructorDecl:
+        WriteToken(((ConstructorDeclNode*)node)->GetToken());
+        WriteChildren(node);
+        break;
+
+    case NodeTag::ClassDef:
+        {
+            ClassDefNode* classDef = (ClassDefNode*)node;
+            WriteChildren(classDef);
+            WriteNodeList(classDef->GetVarDecls());
+            WriteNodeList(classDef->GetConstructors());
+            WriteNodeList(classDef->GetFuncDecls());
+        }
+        break;
+
+    case NodeTag::Program:
+        {
+            // the class and function lists are always created by the ProgramNode itself
+            ProgramNode* program = (ProgramNode*)node;
+            WriteChildren(program->GetClassList());
+            WriteChildren(program->GetFunctionList());
+        }
+        break;
+
+    default:
+        WriteChildren(node);
+        break;
+    }
+}
+
+void ASTSerializer::WriteChildren(ASTNode* node)
+{
+    WriteNodeList(((ASTNodeBase*)node)->GetChildren());
+}
+
+void ASTSerializer::WriteToken(const Token& token)
+{
+    WriteName(token.GetLexeme());
+    m_buffer.push_back((char)token.GetTokenType());
+    WriteNum(token.GetLine());
+}
+
+void ASTSerializer::WriteName(const std::string& name)
+{
+    auto it = m_nameIndices.find(name);
+    if (it != m_nameIndices.end())
+    {
+        WriteNum(it->second);
+        return;
+    }
+
+    size_t index = m_names.size();
+    m_names.push_back(name);
+    m_nameIndices[name] = index;
+    WriteNum(index);
+}
+
+void ASTSerializer::WriteNum(size_t num)
+{
+    // variable length encoding, 7 bits per byte with the high bit set when more bytes follow
+    while (num >= 0x80)
+    {
+        m_buffer.push_back((char)((num & 0x7F) | 0x80));
+        num >>= 7;
+    }
+    m_buffer.push_back((char)num);
+}
+
+ASTNode* ASTSerializer::ReadNode()
+{
+    if (m_readPos >= m_buffer.length())
+    {
+        return nullptr;
+    }
+
+    NodeTag tag = (NodeTag)m_buffer[m_readPos++];
+    Token token;
+    std::string name;
+    switch (tag)
+    {
+    case NodeTag::UnspecifiedDimension:
+        return new UnspecificedDimensionNode();
+
+    case NodeTag::DefaultVisibility:
+        return new DefaultVisibilityNode();
+
+    case NodeTag::ID:
+        return ReadToken(token) ? new IDNode(token) : nullptr;
+
+    case NodeTag::Type:
+        return ReadToken(token) ? new TypeNode(token) : nullptr;
+
+    case NodeTag::Operator:
+        return ReadToken(token) ? new OperatorNode(token) : nullptr;
+
+    case NodeTag::Sign:
+        return ReadToken(token) ? new SignNode(token) : nullptr;
+
+    case NodeTag::Not:
+        return ReadToken(token) ? new NotNode(token) : nullptr;
+
+    case NodeTag::Visibility:
+        return ReadName(name) ? new VisibilityNode(name) : nullptr;
+
+    case NodeTag::ClassDef:
+        return ReadClassDef();
+
+    case NodeTag::Program:
+        return ReadProgram();
+
+    case NodeTag::ConstructorDecl:
+        if (!ReadToken(token))
+        {
+            return nullptr;
+        }
+        break;
+
+    default:
+        break;
+    }
+
+    std::vector<ASTNode*> children;
+    size_t expectedNumChildren = GetExpectedNumChildren(tag);
+    if (expectedNumChildren == 0 || !ReadChildren(children))
+    {
+        return nullptr;
+    }
+    else if (expectedNumChildren != SIZE_MAX && children.size() != expectedNumChildren)
+    {
+        DeleteNodes(children);
+        return nullptr;
+    }
+    return ConstructNode(tag, token, children);
+}
+
+ASTNode* ASTSerializer::ConstructNode(NodeTag tag, const Token& token, 
+    std::vector<ASTNode*>& children)
+{
+    std::vector<ASTNode*>& c = children;
+    switch (tag)
+    {
+    case NodeTag::AddOp: return new AddOpNode(c[0], (OperatorNode*)c[1], c[2]);
+    case NodeTag::MultOp: return new MultOpNode(c[0], (OperatorNode*)c[1], c[2]);
+    case NodeTag::RelOp: return new RelOpNode(c[0], (OperatorNode*)c[1], c[2]);
+    case NodeTag::Literal: return new LiteralNode((IDNode*)c[0], (TypeNode*)c[1]);
+    case NodeTag::Dot: return new DotNode(c[0], c[1]);
+    case NodeTag::Expr: return new ExprNode(c[0]);
+    case NodeTag::ModifiedExpr: return new ModifiedExpr(c[0], c[1]);
+    case NodeTag::ReturnStat: return new ReturnStatNode((ExprNode*)c[0]);
+    case NodeTag::Variable: return new VariableNode((IDNode*)c[0], (DimensionNode*)c[1]);
+    case NodeTag::ReadStat: return new ReadStatNode(c[0]);
+    case NodeTag::WriteStat: return new WriteStatNode((ExprNode*)c[0]);
+    case NodeTag::AssignStat: return new AssignStatNode(c[0], (ExprNode*)c[1]);
+    case NodeTag::WhileStat: return new WhileStatNode((ExprNode*)c[0], (StatBlockNode*)c[1]);
+    case NodeTag::FuncCall: return new FuncCallNode((IDNode*)c[0], (AParamListNode*)c[1]);
+
+    case NodeTag::IfStat:
+        return new IfStatNode((ExprNode*)c[0], (StatBlockNode*)c[1], (StatBlockNode*)c[2]);
+
+    case NodeTag::VarDecl:
+        if (dynamic_cast<DimensionNode*>(c[2]) != nullptr)
+        {
+            return new VarDeclNode((IDNode*)c[0], (TypeNode*)c[1], (DimensionNode*)c[2]);
+        }
+        return new VarDeclNode((IDNode*)c[0], (TypeNode*)c[1], (AParamListNode*)c[2]);
+
+    case NodeTag::FParam:
+        return new FParamNode((IDNode*)c[0], (TypeNode*)c[1], (DimensionNode*)c[2]);
+
+    case NodeTag::MemVar:
+        return new MemVarNode((VisibilityNode*)c[3], (IDNode*)c[0],
+            (TypeNode*)c[1], (DimensionNode*)c[2]);
+
+    case NodeTag::FunctionDef:
+        return new FunctionDefNode((IDNode*)c[0], (TypeNode*)c[1],
+            (FParamListNode*)c[2], (StatBlockNode*)c[3]);
+
+    case NodeTag::MemFuncDecl:
+        return new MemFuncDeclNode((VisibilityNode*)c[0], (IDNode*)c[1],
+            (TypeNode*)c[2], (FParamListNode*)c[3]);
+
+    case NodeTag::MemFuncDef:
+        return new MemFuncDefNode((IDNode*)c[4], (IDNode*)c[0], (TypeNode*)c[1],
+            (FParamListNode*)c[2], (StatBlockNode*)c[3]);
+
+    case NodeTag::ConstructorDecl:
+        return new ConstructorDeclNode((VisibilityNode*)c[0], (FParamListNode*)c[1], token);
+
+    case NodeTag::ConstructorDef:
+        // the return type node is recreated by the constructor from the class id
+        delete c[1];
+        return new ConstructorDefNode((IDNode*)c[0], (FParamListNode*)c[2],
+            (StatBlockNode*)c[3]);
+
+    // looping children are added to the front of the list so they are added back in reverse
+    case NodeTag::Dimension:
+        {
+            DimensionNode* dimension = new DimensionNode();
+            for (auto it = c.rbegin(); it != c.rend(); it++)
+            {
+                dimension->AddLoopingChild(*it);
+            }
+            return dimension;
+        }
+
+    case NodeTag::AParamList:
+        {
+            AParamListNode* params = new AParamListNode();
+            for (auto it = c.rbegin(); it != c.rend(); it++)
+            {
+                params->AddLoopingChild(*it);
+            }
+            return params;
+        }
+
+    case NodeTag::FParamList:
+        {
+            FParamListNode* params = new FParamListNode();
+            for (auto it = c.rbegin(); it != c.rend(); it++)
+            {
+                params->AddLoopingChild(*it);
+            }
+            return params;
+        }
+
+    case NodeTag::StatBlock:
+        {
+            StatBlockNode* statBlock = new StatBlockNode();
+            for (auto it = c.rbegin(); it != c.rend(); it++)
+            {
+                statBlock->AddLoopingChild(*it);
+            }
+            return statBlock;
+        }
+
+    case NodeTag::InheritanceList:
+        {
+            InheritanceListNode* inheritanceList = new InheritanceListNode();
+            for (auto it = c.rbegin(); it != c.rend(); it++)
+            {
+                inheritanceList->AddLoopingChild(*it);
+            }
+            return inheritanceList;
+        }
+
+    default:
+        // should never reach here
+        DEBUG_BREAK();
+        DeleteNodes(children);
+        return nullptr;
+    }
+}
+
+ProgramNode* ASTSerializer::ReadProgram()
+{
+    std::vector<ASTNode*> classes;
+    std::vector<ASTNode*> functions;
+    if (!ReadChildren(classes))
+    {
+        return nullptr;
+    }
+    else if (!ReadChildren(functions))
+    {
+        DeleteNodes(classes);
+        return nullptr;
+    }
+
+    return ConstructProgram(classes, functions);
+}
+
+ProgramNode* ASTSerializer::ConstructProgram(std::vector<ASTNode*>& classes, 
+    std::vector<ASTNode*>& functions)
+{
+    ProgramNode* program = new ProgramNode();
+    for (ASTNode* classDef : classes)
+    {
+        program->GetClassList()->AddClass((ClassDefNode*)classDef);
+    }
+
+    for (ASTNode* funcDef : functions)
+    {
+        program->GetFunctionList()->AddFunc((FunctionDefNode*)funcDef);
+    }
+    return program;
+}
+
+ASTNode* ASTSerializer::ReadClassDef()
+{
+    std::vector<ASTNode*> children;
+    std::vector<ASTNode*> varDecls;
+    std::vector<ASTNode*> constructors;
+    std::vector<ASTNode*> funcDecls;
+    if (!ReadChildren(children) || children.size() != 2 || !ReadChildren(varDecls)
+        || !ReadChildren(constructors) || !ReadChildren(funcDecls))
+    {
+        DeleteNodes(children);
+        DeleteNodes(varDecls);
+        DeleteNodes(constructors);
+        DeleteNodes(funcDecls);
+        return nullptr;
+    }
+    return ConstructClassDef(children, varDecls, constructors, funcDecls);
+}
+
+ASTNode* ASTSerializer::ConstructClassDef(std::vector<ASTNode*>& children, 
+    std::vector<ASTNode*>& varDecls, std::vector<ASTNode*>& constructors, 
+    std::vector<ASTNode*>& funcDecls)
+{
+    // members are added to the front of their list so they are added back in reverse
+    ClassDefNode* classDef = new ClassDefNode((IDNode*)children[0],
+        (InheritanceListNode*)children[1]);
+    for (auto it = varDecls.rbegin(); it != varDecls.rend(); it++)
+    {
+        classDef->AddVarDecl((MemVarNode*)*it);
+    }
+
+    for (auto it = constructors.rbegin(); it != constructors.rend(); it++)
+    {
+        classDef->AddConstructor((ConstructorDeclNode*)*it);
+    }
+
+    for (auto it = funcDecls.rbegin(); it != funcDecls.rend(); it++)
+    {
+        classDef->AddFuncDecl((MemFuncDeclNode*)*it);
+    }
+    return classDef;
+}
+
+bool ASTSerializer::ReadChildren(std::vector<ASTNode*>& outChildren)
+{
+    size_t numChildren;
+    if (!ReadNum(numChildren) || numChildren > m_buffer.length() - m_readPos)
+    {
+        return false;
+    }
+
+    outChildren.reserve(numChildren);
+    for (size_t i = 0; i < numChildren; i++)
+    {
+        ASTNode* child = ReadNode();
+        if (child == nullptr)
+        {
+            DeleteNodes(outChildren);
+            return false;
+        }
+        outChildren.push_back(child);
+    }
+    return true;
+}
+
+bool ASTSerializer::ReadToken(Token& outToken)
+{
+    std::string lexeme;
+    size_t line;
+    if (!ReadName(lexeme) || m_readPos >= m_buffer.length())
+    {
+        return false;
+    }
+
+    // IncompleteMultipleLineComment is the last token type
+    uint8_t typeValue = (uint8_t)m_buffer[m_readPos++];
+    if (typeValue > (uint8_t)TokenType::IncompleteMultipleLineComment || !ReadNum(line))
+    {
+        return false;
+    }
+
+    outToken = Token(lexeme, (TokenType)typeValue, (size_t)((int64_t)line + m_lineOffset));
+    return true;
+}
+
+bool ASTSerializer::ReadName(std::string& outName)
+{
+    size_t index;
+    if (!ReadNum(index) || index >= m_names.size())
+    {
+        return false;
+    }
+
+    outName = m_names[index];
+    return true;
+}
+
+bool ASTSerializer::ReadNum(size_t& outNum)
+{
+    outNum = 0;
+    size_t shift = 0;
+    while (m_readPos < m_buffer.length() && shift < sizeof(size_t) * 8)
+    {
+        uint8_t byte = (uint8_t)m_buffer[m_readPos++];
+        outNum |= (size_t)(byte & 0x7F) << shift;
+        if ((byte & 0x80) == 0)
+        {
+            return true;
+        }
+        shift += 7;
+    }
+    return false;
+}
+
+ASTNode* ASTSerializer::CopyNode(ASTNode* node)
+{
+    NodeTag tag = GetTag(node);
+    ASSERT(tag != NodeTag::Invalid);
+
+    Token token;
+    switch (tag)
+    {
+    case NodeTag::UnspecifiedDimension:
+        return new UnspecificedDimensionNode();
+
+    case NodeTag::DefaultVisibility:
+        return new DefaultVisibilityNode();
+
+    case NodeTag::ID:
+        return new IDNode(CopyToken(node->GetFirstToken()));
+
+    case NodeTag::Type:
+        return new TypeNode(CopyToken(node->GetFirstToken()));
+
+    case NodeTag::Operator:
+        return new OperatorNode(CopyToken(node->GetFirstToken()));
+
+    case NodeTag::Sign:
+        return new SignNode(CopyToken(node->GetFirstToken()));
+
+    case NodeTag::Not:
+        return new NotNode(CopyToken(node->GetFirstToken()));
+
+    case NodeTag::Visibility:
+        return new VisibilityNode(((VisibilityNode*)node)->GetVisibility());
+
+    case NodeTag::ClassDef:
+        {
+            ClassDefNode* classDef = (ClassDefNode*)node;
+            std::vector<ASTNode*> children = CopyNodeList(classDef->GetChildren());
+            std::vector<ASTNode*> varDecls = CopyNodeList(classDef->GetVarDecls());
+            std::vector<ASTNode*> constructors = CopyNodeList(classDef->GetConstructors());
+            std::vector<ASTNode*> funcDecls = CopyNodeList(classDef->GetFuncDecls());
+            return ConstructClassDef(children, varDecls, constructors, funcDecls);
+        }
+
+    case NodeTag::Program:
+        {
+            ProgramNode* program = (ProgramNode*)node;
+            std::vector<ASTNode*> classes = CopyNodeList(program->GetClassList()->GetChildren());
+            std::vector<ASTNode*> functions 
+                = CopyNodeList(program->GetFunctionList()->GetChildren());
+            return ConstructProgram(classes, functions);
+        }
+
+    case NodeTag::ConstructorDecl:
+        token = CopyToken(((ConstructorDeclNode*)node)->GetToken());
+        break;
+
+    default:
+        break;
+    }
+
+    std::vector<ASTNode*> children = CopyNodeList(((ASTNodeBase*)node)->GetChildren());
+    return ConstructNode(tag, token, children);
+}
+
+Token ASTSerializer::CopyToken(const Token& token) const
+{
+    return Token(token, (size_t)((int64_t)token.GetLine() + m_lineOffset));
+}
+
+size_t ASTSerializer::GetExpectedNumChildren(NodeTag tag)
+{
+    switch (tag)
+    {
+    case NodeTag::Expr:
+    case NodeTag::ReturnStat:
+    case NodeTag::ReadStat:
+    case NodeTag::WriteStat:
+        return 1;
+
+    case NodeTag::Literal:
+    case NodeTag::Dot:
+    case NodeTag::ModifiedExpr:
+    case NodeTag::Variable:
+    case NodeTag::AssignStat:
+    case NodeTag::WhileStat:
+    case NodeTag::FuncCall:
+    case NodeTag::ConstructorDecl:
+        return 2;
+
+    case NodeTag::AddOp:
+    case NodeTag::MultOp:
+    case NodeTag::RelOp:
+    case NodeTag::IfStat:
+    case NodeTag::VarDecl:
+    case NodeTag::FParam:
+        return 3;
+
+    case NodeTag::MemVar:
+    case NodeTag::FunctionDef:
+    case NodeTag::MemFuncDecl:
+    case NodeTag::ConstructorDef:
+        return 4;
+
+    case NodeTag::MemFuncDef:
+        return 5;
+
+    case NodeTag::Dimension:
+    case NodeTag::AParamList:
+    case NodeTag::FParamList:
+    case NodeTag::StatBlock:
+    case NodeTag::InheritanceList:
+        return SIZE_MAX;
+
+    default:
+        // not a node with children, the data is invalid
+        return 0;
+    }
+}
+
+void ASTSerializer::DeleteNodes(std::vector<ASTNode*>& nodes)
+{
+    for (ASTNode* node : nodes)
+    {
+        delete node;
+    }
+    nodes.clear();
+}
+
+// ASTCache ///////////////////////////////////////////////////////////////
+bool ASTCache::IsEnabled()
+{
+    return OutputFiles::IsEnabled(Artifact::ASTCache) 
+        && !OutputFiles::IsEnabled(Artifact::LexTokens) 
+        && !OutputFiles::IsEnabled(Artifact::LexErrors)
+        && !OutputFiles::IsEnabled(Artifact::Derivation) 
+        && !OutputFiles::IsEnabled(Artifact::SyntaxErrors)
+        && !OutputFiles::IsEnabled(Artifact::AST);
+}
+
+ProgramNode* ASTCache::Load(const std::string& filepath)
+{
+    std::string source;
+    if (!ReadSource(filepath, source))
+    {
+        return nullptr;
+    }
+
+    std::ifstream cacheFile = std::ifstream(GetCacheFilepath(filepath), std::ios::binary);
+    uint64_t hash;
+    uint64_t sourceSize;
+    uint64_t astHash;
+    cacheFile.read((char*)&hash, sizeof(hash));
+    cacheFile.read((char*)&sourceSize, sizeof(sourceSize));
+    cacheFile.read((char*)&astHash, sizeof(astHash));
+    if (!cacheFile || hash != Hash(source) || sourceSize != source.length())
+    {
+        return nullptr;
+    }
+
+    std::string ast(std::istreambuf_iterator<char>(cacheFile), 
+        (std::istreambuf_iterator<char>()));
+    if (astHash != Hash(ast))
+    {
+        return nullptr;
+    }
+
+    std::istringstream astStream(ast);
+    ProgramNode* program = ASTSerializer::Deserialize(astStream);
+    if (program != nullptr)
+    {
+        Lexer::SetSourceLines(source);
+    }
+    return program;
+}
+
+void ASTCache::Store(const std::string& filepath, ProgramNode* program)
+{
+    std::string source;
+    if (!ReadSource(filepath, source))
+    {
+        return;
+    }
+
+    std::ostringstream astStream;
+    ASTSerializer::Serialize(program, astStream);
+    std::string ast = astStream.str();
+
+    std::ofstream cacheFile = std::ofstream(GetCacheFilepath(filepath), std::ios::binary);
+    uint64_t hash = Hash(source);
+    uint64_t sourceSize = source.length();
+    uint64_t astHash = Hash(ast);
+    cacheFile.write((const char*)&hash, sizeof(hash));
+    cacheFile.write((const char*)&sourceSize, sizeof(sourceSize));
+    cacheFile.write((const char*)&astHash, sizeof(astHash));
+    cacheFile.write(ast.data(), ast.size());
+}
+
+bool ASTCache::ReadSource(const std::string& filepath, std::string& outSource)
+{
+    std::ifstream sourceFile = std::ifstream(filepath, std::ios::binary);
+    if (!sourceFile)
+    {
+        return false;
+    }
+
+    outSource.assign(std::istreambuf_iterator<char>(sourceFile),
+        std::istreambuf_iterator<char>());
+    return true;
+}
+
+uint64_t ASTCache::Hash(const std::string& bytes)
+{
+    // 64 bit FNV-1a
+    uint64_t hash = 14695981039346656037ull;
+    for (char c : bytes)
+    {
+        hash ^= (uint8_t)c;
+        hash *= 1099511628211ull;
+    }
+    return hash;
+}
+
+std::string ASTCache::GetCacheFilepath(const std::string& filepath)
+{
+    return OutputFiles::GetFilepath(filepath, Artifact::ASTCache);
+}
@@ -0,0 +1,160 @@
+#pragma once
+#include <string>
+#include <list>
+#include <vector>
+#include <unordered_map>
+#include <iostream>
+#include <cstdint>
+
+#include "../Core/Token.h"
+
+class ASTNode;
+class ProgramNode;
+
+// writes an AST to a compact binary format which can be read back without lexing or parsing
+class ASTSerializer
+{
+public:
+    static void Serialize(ProgramNode* program, std::ostream& stream);
+
+    // returns nullptr if the stream does not contain a valid serialized AST, 
+    // the line offset is added to the line of every token read
+    static ProgramNode* Deserialize(std::istream& stream, int64_t lineOffset = 0);
+
+    // copies the AST without writing it, the line offset is added to the line of every token
+    static ProgramNode* Copy(ProgramNode* program, int64_t lineOffset = 0);
+
+private:
+    enum class NodeTag : uint8_t
+    {
+        Invalid,
+        UnspecifiedDimension,
+        ID,
+        Type,
+        Operator,
+        AddOp,
+        MultOp,
+        RelOp,
+        Literal,
+        Dimension,
+        VarDecl,
+        Dot,
+        Expr,
+        Sign,
+        Not,
+        ModifiedExpr,
+        ReturnStat,
+        Variable,
+        ReadStat,
+        WriteStat,
+        AssignStat,
+        IfStat,
+        WhileStat,
+        AParamList,
+        FuncCall,
+        StatBlock,
+        FParam,
+        FParamList,
+        FunctionDef,
+        Visibility,
+        DefaultVisibility,
+        MemVar,
+        MemFuncDecl,
+        MemFuncDef,
+        ConstructorDecl,
+        ConstructorDef,
+        InheritanceList,
+        ClassDef,
+        Program
+    };
+
+    ASTSerializer();
+
+    static NodeTag GetTag(ASTNode* node);
+
+    // writing
+    void WriteNode(ASTNode* node);
+    void WriteChildren(ASTNode* node);
+    void WriteToken(const Token& token);
+    void WriteName(const std::string& name);
+    void WriteNum(size_t num);
+
+    template<typename NodeType>
+    void WriteNodeList(const std::list<NodeType*>& nodes)
+    {
+        WriteNum(nodes.size());
+        for (NodeType* node : nodes)
+        {
+            WriteNode(node);
+        }
+    }
+
+    // reading
+    ASTNode* ReadNode();
+    ProgramNode* ReadProgram();
+    ASTNode* ReadClassDef();
+    bool ReadChildren(std::vector<ASTNode*>& outChildren);
+    bool ReadToken(Token& outToken);
+    bool ReadName(std::string& outName);
+    bool ReadNum(size_t& outNum);
+
+    // the children are owned by the constructed node
+    static ASTNode* ConstructNode(NodeTag tag, const Token& token, 
+        std::vector<ASTNode*>& children);
+    static ProgramNode* ConstructProgram(std::vector<ASTNode*>& classes, 
+        std::vector<ASTNode*>& functions);
+    static ASTNode* ConstructClassDef(std::vector<ASTNode*>& children, 
+        std::vector<ASTNode*>& varDecls, std::vector<ASTNode*>& constructors, 
+        std::vector<ASTNode*>& funcDecls);
+
+    // copying
+    ASTNode* CopyNode(ASTNode* node);
+    Token CopyToken(const Token& token) const;
+
+    template<typename NodeType>
+    std::vector<ASTNode*> CopyNodeList(const std::list<NodeType*>& nodes)
+    {
+        std::vector<ASTNode*> copies;
+        copies.reserve(nodes.size());
+        for (NodeType* node : nodes)
+        {
+            copies.push_back(CopyNode(node));
+        }
+        return copies;
+    }
+
+    // number of children a node of the given tag must have or SIZE_MAX if it has a list of children
+    static size_t GetExpectedNumChildren(NodeTag tag);
+    static void DeleteNodes(std::vector<ASTNode*>& nodes);
+
+    std::string m_buffer;
+    size_t m_readPos;
+    int64_t m_lineOffset;
+
+    // names are written once in a table at the start of the data and referred to by index
+    std::unordered_map<std::string, size_t> m_nameIndices;
+    std::vector<std::string> m_names;
+
+    static constexpr const char* s_magic = "AST";
+    static constexpr uint8_t s_version = 1;
+};
+
+// caches the AST of successfully parsed source files keyed by a hash of their content
+// so unchanged files can skip the lexer and parser entirely
+class ASTCache
+{
+public:
+    // the cache is only used when its artifact is enabled and no output file of the lexer 
+    // or the parser is requested since they are not written for a cached AST
+    static bool IsEnabled();
+
+    // returns nullptr if there is no up to date cache for the source file or if the 
+    // serialized AST does not match its hash since a damaged AST may be well formed
+    static ProgramNode* Load(const std::string& filepath);
+    static void Store(const std::string& filepath, ProgramNode* program);
+
+private:
+    static bool ReadSource(const std::string& filepath, std::string& outSource);
+    static uint64_t Hash(const std::string& bytes);
+    static std::string GetCacheFilepath(const std::string& filepath);
+};
@@ -4,44 +4,34 @@
 #include "../CodeGeneration/CodeGeneration.h"
 
 #include <vector>
+#include <cstdlib>
 
-std::string BaseTypeOfArr(const std::string& arrTypeStr)
+TypeID VarDeclToTypeID(VarDeclNode* var)
 {
-    std::string typeStr;
-    for (size_t i = 0; i < arrTypeStr.length(); i++)
+    ASSERT(var != nullptr);
+    TypeID baseType = var->GetType()->GetEvaluatedTypeID();
+    if (var->GetDimension() == nullptr || var->GetDimension()->GetNumChild() == 0)
     {
-        if (arrTypeStr[i] == '[' || arrTypeStr[i] == ']')
-        {
-            break;
-        }
-        typeStr += arrTypeStr[i];
+        return baseType;
     }
-    return typeStr;
-}
-
-std::string VarDeclToTypeStr(VarDeclNode* var)
-{
-    ASSERT(var != nullptr);
-    std::stringstream ss;
-    ss << var->GetType()->GetType().GetLexeme();
 
-    if (var->GetDimension() != nullptr)
+    std::vector<size_t> dimensions;
+    dimensions.reserve(var->GetDimension()->GetNumChild());
+    for (ASTNode* dimension : *var->GetDimension())
     {
-        for (ASTNode* dimension : *var->GetDimension())
+        LiteralNode* literal = dynamic_cast<LiteralNode*>(dimension);
+        if (literal != nullptr)
         {
-            LiteralNode* literal = dynamic_cast<LiteralNode*>(dimension);
-            if (literal != nullptr)
-            {
-                ss << "[" << literal->GetLexemeNode()->GetID().GetLexeme() << "]";
-            }
-            else
-            {
-                ASSERT(dynamic_cast<UnspecificedDimensionNode*>(dimension) != nullptr);
-                ss << "[]";
-            }
+            dimensions.push_back((size_t)std::strtoull(
+                literal->GetLexemeNode()->GetID().GetLexeme().c_str(), nullptr, 10));
+        }
+        else
+        {
+            ASSERT(dynamic_cast<UnspecificedDimensionNode*>(dimension) != nullptr);
+            dimensions.push_back(UnspecifiedDimension);
         }
     }
-    return ss.str();
+    return TypeTable::GetArrayType(baseType, dimensions);
 }
 
 std::string FunctionParamTypeToStr(FParamListNode* params)
@@ -52,7 +42,7 @@ std::string FunctionParamTypeToStr(FParamListNode* params)
     {
         VarDeclNode* var = dynamic_cast<VarDeclNode*>(param);
         ASSERT(var != nullptr);
-        typeStr << VarDeclToTypeStr(var) << ", ";
+        typeStr << TypeTable::GetTypeStr(VarDeclToTypeID(var)) << ", ";
         hasParam = true;
     }
 
@@ -79,7 +69,7 @@ bool HasMatchingParameters(FParamListNode* fparam, AParamListNode* aparam)
     for (ASTNode* f : fparam->GetChildren())
     {
         FParamNode* currParam = (FParamNode*)f;
-        if (currParam->GetEvaluatedType() != (*it)->GetEvaluatedType())
+        if (currParam->GetEvaluatedTypeID() != (*it)->GetEvaluatedTypeID())
         {
             return false;
         }
@@ -117,7 +107,7 @@ SymbolTable* FindNameInDot(SymbolTable* globalTable, SymbolTable* contextTable,
         }
 
         SymbolTableEntry* varEntry = contextTable->FindEntryInScope(var->
-            GetVariable()->GetID().GetLexeme());
+            GetVariable()->GetID().GetLexemeID());
 
         if (varEntry == nullptr || (varEntry->GetKind() != SymbolTableEntryKind::MemVar 
             && varEntry->GetKind() != SymbolTableEntryKind::LocalVariable))
@@ -147,7 +137,7 @@ SymbolTable* FindNameInDot(SymbolTable* globalTable, SymbolTable* contextTable,
         if (contextTable->GetParentEntry()->GetKind() != SymbolTableEntryKind::Class)
         {
             SymbolTableEntry* funcEntry = contextTable->FindEntryInScope(funcCall->
-                GetID()->GetID().GetLexeme());
+                GetID()->GetID().GetLexemeID());
 
             if (funcEntry == nullptr 
                 || funcEntry->GetKind() != SymbolTableEntryKind::FreeFunction)
@@ -273,9 +263,9 @@ SymbolTable* GetContextTable(SymbolTable* globalTable, SymbolTable* prevContext,
     {
         VariableNode* var = (VariableNode*)node;
         SymbolTableEntry* entry = prevContext->FindEntryInScope(
-            var->GetVariable()->GetID().GetLexeme());
+            var->GetVariable()->GetID().GetLexemeID());
 
-        std::string type;
+        TypeID type = TypeTable::GetInvalidType();
 
         if (entry == nullptr || var->GetVariable()->GetID().GetLexeme() == "self")
         {
@@ -284,7 +274,7 @@ SymbolTable* GetContextTable(SymbolTable* globalTable, SymbolTable* prevContext,
             {
                 if (IsValidSelf(prevContext, var))
                 {
-                    type = var->GetEvaluatedType();
+                    type = var->GetEvaluatedTypeID();
                 }
                 else
                 {
@@ -314,15 +304,15 @@ SymbolTable* GetContextTable(SymbolTable* globalTable, SymbolTable* prevContext,
         }
         else
         {
-            type = entry->GetEvaluatedType();
+            type = entry->GetEvaluatedTypeID();
         }
 
-        if (IsArrayType(type))
+        if (TypeTable::IsArray(type))
         {
-            type = var->GetEvaluatedType();
+            type = var->GetEvaluatedTypeID();
         }
 
-        SymbolTableEntry* classEntry = globalTable->FindEntryInTable(type);
+        SymbolTableEntry* classEntry = globalTable->FindEntryInTable(TypeTable::GetTypeStr(type));
         
         if ((classEntry == nullptr || classEntry->GetKind() != SymbolTableEntryKind::Class))
         {
@@ -340,7 +330,7 @@ SymbolTable* GetContextTable(SymbolTable* globalTable, SymbolTable* prevContext,
     {
         FuncCallNode* funcCall = (FuncCallNode*)node;
         SymbolTableEntry* entry = prevContext->FindEntryInScope(
-            funcCall->GetID()->GetID().GetLexeme());
+            funcCall->GetID()->GetID().GetLexemeID());
         
         if (entry == nullptr)
         {
@@ -362,7 +352,7 @@ SymbolTable* GetContextTable(SymbolTable* globalTable, SymbolTable* prevContext,
         }
 
         SymbolTableEntry* classEntry = globalTable->FindEntryInTable(
-            entry->GetEvaluatedType());
+            TypeTable::GetTypeStr(entry->GetEvaluatedTypeID()));
 
         if (classEntry == nullptr || classEntry->GetKind() != SymbolTableEntryKind::Class)
         {
@@ -413,10 +403,20 @@ SymbolTable* GetContextTableFromName(SymbolTable* currContext,
     return FindNameInDot(GetGlobalTable(currContext), currContext, dot, name);
 }
 
+ParamListID GetArgumentListID(AParamListNode* aparams)
+{
+    std::vector<TypeID> argTypes;
+    argTypes.reserve(aparams->GetNumChild());
+    for (ASTNode* arg : aparams->GetChildren())
+    {
+        argTypes.push_back(arg->GetEvaluatedTypeID());
+    }
+    return TypeTable::FindParamListID(argTypes);
+}
+
 TagTableEntry* FindEntryForFuncCall(FuncCallNode* funcCall, SymbolTable* context)
 {
-    const std::string& funcName = funcCall->GetID()->GetID().GetLexeme();
-    AParamListNode* aparams = funcCall->GetParameters();
+    NameID funcName = funcCall->GetID()->GetID().GetLexemeID();
     if (context == nullptr)
     {
         context = funcCall->GetSymbolTable();
@@ -425,36 +425,19 @@ TagTableEntry* FindEntryForFuncCall(FuncCallNode* funcCall, SymbolTable* context
     ASSERT(tempEntry != nullptr);
     context = tempEntry->GetParentTable();
 
-    for (SymbolTableEntry* currEntry : *context)
-    {
-        if (currEntry->GetKind() == SymbolTableEntryKind::ConstructorDecl 
-            || currEntry->GetKind() == SymbolTableEntryKind::FreeFunction 
-            || currEntry->GetKind() == SymbolTableEntryKind::MemFuncDecl)
-        {
-            FunctionDefNode* funcNode = (FunctionDefNode*)currEntry->GetNode();
-            if (currEntry->GetName() == funcName && HasMatchingParameters(funcNode->GetParameters(), aparams))
-            {
-                return (TagTableEntry*)currEntry;
-            }
-        }
-    }
-    return nullptr;
+    return (TagTableEntry*)context->FindOverloadInTable(funcName, 
+        GetArgumentListID(funcCall->GetParameters()));
 }
 
 TagTableEntry* FindConstructorEntry(SymbolTable* classTable, AParamListNode* params)
 {
-    for (SymbolTableEntry* entry : *classTable)
+    NameID constructorName = NameTable::FindID(classTable->GetName() + "::constructor");
+    if (constructorName == NameTable::InvalidNameID)
     {
-        if (entry->GetKind() == SymbolTableEntryKind::ConstructorDecl)
-        {
-            ConstructorDefNode* constructorNode = (ConstructorDefNode*)entry->GetNode();
-            if (HasMatchingParameters(constructorNode->GetParameters(), params))
-            {
-                return (TagTableEntry*)entry;
-            }
-        }
+        return nullptr;
     }
-    return nullptr;
+    return (TagTableEntry*)classTable->FindOverloadInTable(constructorName, 
+        GetArgumentListID(params));
 }
 
 StatBlockNode* GetParentStatBlock(ASTNode* node)
@@ -493,18 +476,6 @@ bool IsArrayType(ASTNode* n)
     return false;
 }
 
-bool IsArrayType(const std::string typeStr)
-{
-    for (char c : typeStr)
-    {
-        if (c == '[' || c == ']')
-        {
-            return true;
-        }
-    }
-    return false;
-}
-
 int GetOffset(SymbolTable* context, const std::string& name)
 {
     SymbolTableEntry* entry = context->FindEntryInScope(name);
@@ -550,14 +521,14 @@ int GetOffset(ASTNode* node)
 
 int GetOffset(LiteralNode* node)
 {
-    ASSERT(node->GetEvaluatedType() == "float");
+    ASSERT(node->GetCachedEvaluatedTypeID() == TypeTable::GetFloatType());
     return GetOffset(node->GetSymbolTable(), node->GetTempVarName());
 }
 
 int GetOffset(VariableNode* var)
 {
     SymbolTableEntry* varEntry = var->GetSymbolTable()->FindEntryInScope(var->
-        GetVariable()->GetID().GetLexeme());
+        GetVariable()->GetID().GetLexemeID());
 
     if (varEntry->GetName() == "self")
     {
@@ -568,7 +539,7 @@ int GetOffset(VariableNode* var)
 
     VarDeclNode* declNode = (VarDeclNode*)varEntry->GetNode();
     
-    if (!IsArrayType(declNode->GetEvaluatedType()))
+    if (!TypeTable::IsArray(declNode->GetCachedEvaluatedTypeID()))
     {
         return selfOffset + GetOffset(var->GetSymbolTable(), var->GetVariable()->GetID().GetLexeme());
     }
@@ -654,7 +625,7 @@ int GetOffsetOfExpr(DotNode* dotExpr)
 int GetInternalOffsetOfExpr(DotNode* dotExpr)
 {
     SymbolTable* global = GetGlobalTable(dotExpr->GetSymbolTable());
-    SymbolTableEntry* classEntry = global->FindEntryInTable(dotExpr->GetLeft()->GetEvaluatedType());
+    SymbolTableEntry* classEntry = global->FindEntryInTable(dotExpr->GetLeft()->GetCachedEvaluatedType());
     return GetOffsetOfRight(dotExpr->GetRight(), classEntry->GetSubTable());
 }
 
@@ -677,12 +648,12 @@ int GetOffsetOfRight(ASTNode* rightOfDotExpr, SymbolTable* context)
             auto temp = var->GetVariable()->GetID().GetLexeme();
             SymbolTable* global = GetGlobalTable(context);
             offset = GetOffset(context, var->GetVariable()->GetID().GetLexeme());
-            newContext = global->FindEntryInTable(var->GetEvaluatedType())->GetSubTable();
+            newContext = global->FindEntryInTable(var->GetCachedEvaluatedType())->GetSubTable();
         }
         else if (dynamic_cast<FuncCallNode*>(leftOfDot) != nullptr)
         {
             FuncCallNode* var = (FuncCallNode*)leftOfDot;
-            newContext = context->FindEntryInScope(var->GetID()->GetID().GetLexeme())->GetParentTable();
+            newContext = context->FindEntryInScope(var->GetID()->GetID().GetLexemeID())->GetParentTable();
         }
         return offset + GetOffsetOfRight(dot->GetRight(), newContext);
     }
@@ -728,7 +699,7 @@ size_t ComputeSize(TypeNode* type, DimensionNode* dimensions)
             else
             {
                 LiteralNode* literal = (LiteralNode*)baseNode;
-                ASSERT(literal->GetEvaluatedType() == "integer");
+                ASSERT(literal->GetCachedEvaluatedTypeID() == TypeTable::GetIntegerType());
                 int lexemInt = std::stoi(literal->GetLexemeNode()->GetID().GetLexeme());
                 ASSERT(lexemInt > 0);
                 totalSize *= ((size_t)lexemInt);
@@ -738,13 +709,13 @@ size_t ComputeSize(TypeNode* type, DimensionNode* dimensions)
     return totalSize;
 }
 
-size_t ComputeSize(const std::string& typeStr)
+size_t ComputeSize(TypeID type)
 {
-    if (typeStr == "integer")
+    if (type == TypeTable::GetIntegerType())
     {
         return PlatformSpecifications::GetIntSize();
     }
-    else if (typeStr == "float")
+    else if (type == TypeTable::GetFloatType())
     {
         return PlatformSpecifications::GetFloatSize();
     }
@@ -764,13 +735,13 @@ size_t FindSize(SymbolTable* globalTable, const std::string& typeStr)
     return classEntry->GetSize();
 }
 
-bool IsRefWhenParameter(const std::string& typeStr)
+bool IsRefWhenParameter(TypeID type)
 {
-    if (IsArrayType(typeStr))
+    if (TypeTable::IsArray(type))
     {
         return true;
     }
-    return typeStr != "integer" && typeStr != "float";
+    return type != TypeTable::GetIntegerType() && type != TypeTable::GetFloatType();
 }
 
 bool IsParam(SymbolTable* context, const std::string& name)
@@ -797,7 +768,7 @@ bool IsRef(ASTNode* node)
         }
 
         return IsParam(table, varName) 
-            && IsRefWhenParameter(var->GetEvaluatedType());
+            && IsRefWhenParameter(var->GetCachedEvaluatedTypeID());
     }
 
     return false;
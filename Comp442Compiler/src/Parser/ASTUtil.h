@@ -2,8 +2,8 @@
 #include "AST.h"
 #include "../SemanticChecking/SymbolTable.h"
 
-std::string BaseTypeOfArr(const std::string& arrTypeStr);
-std::string VarDeclToTypeStr(VarDeclNode* var);
+// returns the type of the declaration, built from the type ids of its type and dimensions
+TypeID VarDeclToTypeID(VarDeclNode* var);
 std::string FunctionParamTypeToStr(FParamListNode* params);
 
 template<typename MemType>
@@ -61,6 +61,10 @@ SymbolTable* GetGlobalTable(SymbolTable* currTable);
 SymbolTable* GetContextTableFromName(SymbolTable* currContext, 
     DotNode* dot, const std::string& name);
 
+// returns the id of the param list made of the types of the arguments or InvalidParamListID 
+// if no function can have these parameters
+ParamListID GetArgumentListID(AParamListNode* aparams);
+
 TagTableEntry* FindEntryForFuncCall(FuncCallNode* funcCall, SymbolTable* context = nullptr);
 TagTableEntry* FindConstructorEntry(SymbolTable* classTable, AParamListNode* params);
 
@@ -83,7 +87,6 @@ StatBlockNode* GetParentStatBlock(ASTNode* node);
 bool IsValidSelf(SymbolTable* contextTable, VariableNode* var);
 
 bool IsArrayType(ASTNode* n);
-bool IsArrayType(const std::string typeStr);
 
 int GetOffset(SymbolTable* context, const std::string& name);
 int GetOffset(ASTNode* node);
@@ -101,12 +104,12 @@ int GetOffsetOfRight(ASTNode* rightOfDotExpr, SymbolTable* context);
 
 // returns InvalidSize if the type provided is could not be computed 
 size_t ComputeSize(TypeNode* type, DimensionNode* dimensions);
-size_t ComputeSize(const std::string& typeStr);
+size_t ComputeSize(TypeID type);
 
 // returns the size of a class object
 size_t FindSize(SymbolTable* globalTable, const std::string& typeStr);
 
-bool IsRefWhenParameter(const std::string& typeStr);
+bool IsRefWhenParameter(TypeID type);
 bool IsParam(SymbolTable* context, const std::string& name);
 
 bool IsRef(ASTNode* node);
\ No newline at end of file
@@ -0,0 +1,2419 @@
+// Generated by ParserGenerator.cpp from the rules and the parsing table of Parser.cpp,
+// generate it again with --generate-parser instead of editing it
+
+#include "RecursiveDescentParser.h"
+
+static bool ParseStart(RecursiveDescentParser& p);
+static bool ParseClassDeclOrFuncDefRepetition(RecursiveDescentParser& p);
+static bool ParseClassDeclOrFuncDef(RecursiveDescentParser& p);
+static bool ParseClassDecl(RecursiveDescentParser& p);
+static bool ParseClassDeclMembDeclRepetition(RecursiveDescentParser& p);
+static bool ParseClassDeclInheritance(RecursiveDescentParser& p);
+static bool ParseClassDeclInheritanceTail(RecursiveDescentParser& p);
+static bool ParseVisibility(RecursiveDescentParser& p);
+static bool ParseMemberDecl(RecursiveDescentParser& p);
+static bool ParseMemberFuncDecl(RecursiveDescentParser& p);
+static bool ParseMemberVarDecl(RecursiveDescentParser& p);
+static bool ParseFuncDef(RecursiveDescentParser& p);
+static bool ParseFuncHead(RecursiveDescentParser& p);
+static bool ParseFuncHead2(RecursiveDescentParser& p);
+static bool ParseFuncHead3(RecursiveDescentParser& p);
+static bool ParseFuncBody(RecursiveDescentParser& p);
+static bool ParseLocalVarDeclOrStmtRepetition(RecursiveDescentParser& p);
+static bool ParseLocalVarDeclOrStmt(RecursiveDescentParser& p);
+static bool ParseLocalVarDecl(RecursiveDescentParser& p);
+static bool ParseLocalVarDecl2(RecursiveDescentParser& p);
+static bool ParseStatement(RecursiveDescentParser& p);
+static bool ParseSimpleStatement(RecursiveDescentParser& p);
+static bool ParseSimpleStatement2(RecursiveDescentParser& p);
+static bool ParseSimpleStatement3(RecursiveDescentParser& p);
+static bool ParseSimpleStatement4(RecursiveDescentParser& p);
+static bool ParseStatementRepetition(RecursiveDescentParser& p);
+static bool ParseStatBlock(RecursiveDescentParser& p);
+static bool ParseExpr(RecursiveDescentParser& p);
+static bool ParseExpr2(RecursiveDescentParser& p);
+static bool ParseRelExpr(RecursiveDescentParser& p);
+static bool ParseArithExpr(RecursiveDescentParser& p);
+static bool ParseArithExpr2(RecursiveDescentParser& p);
+static bool ParseSign(RecursiveDescentParser& p);
+static bool ParseTerm(RecursiveDescentParser& p);
+static bool ParseTerm2(RecursiveDescentParser& p);
+static bool ParseFactor(RecursiveDescentParser& p);
+static bool ParseVarOrFuncCall(RecursiveDescentParser& p);
+static bool ParseVarOrFuncCall2(RecursiveDescentParser& p);
+static bool ParseVarOrFuncCall3(RecursiveDescentParser& p);
+static bool ParseVariable(RecursiveDescentParser& p);
+static bool ParseVariable2(RecursiveDescentParser& p);
+static bool ParseVariable3(RecursiveDescentParser& p);
+static bool ParseIndice(RecursiveDescentParser& p);
+static bool ParseArraySize(RecursiveDescentParser& p);
+static bool ParseArraySize2(RecursiveDescentParser& p);
+static bool ParseArraySizeRepetition(RecursiveDescentParser& p);
+static bool ParseType(RecursiveDescentParser& p);
+static bool ParseReturnType(RecursiveDescentParser& p);
+static bool ParseFParams(RecursiveDescentParser& p);
+static bool ParseAParams(RecursiveDescentParser& p);
+static bool ParseFParamsTail(RecursiveDescentParser& p);
+static bool ParseAParamsTail(RecursiveDescentParser& p);
+static bool ParseRelOp(RecursiveDescentParser& p);
+static bool ParseAddOp(RecursiveDescentParser& p);
+static bool ParseMultOp(RecursiveDescentParser& p);
+
+// <Start>
+static bool ParseStart(RecursiveDescentParser& p)
+{
+    while (true)
+    {
+        switch (p.GetTokenType())
+        {
+        case TokenType::Class:
+        case TokenType::Function:
+        case TokenType::EndOfFile:
+            // 0: <Start> -> <ClassDeclOrFuncDefRepetition>
+            p.Expand(0);
+            return ParseClassDeclOrFuncDefRepetition(p);
+
+        default:
+            if (p.RecoverFromError(NonTerminal::Start, ErrorID::Default))
+            {
+                continue;
+            }
+            return !p.IsStopped();
+        }
+    }
+}
+
+// <ClassDeclOrFuncDefRepetition>
+static bool ParseClassDeclOrFuncDefRepetition(RecursiveDescentParser& p)
+{
+    while (true)
+    {
+        switch (p.GetTokenType())
+        {
+        case TokenType::Class:
+        case TokenType::Function:
+            // 1: <ClassDeclOrFuncDefRepetition> -> <ClassDeclOrFuncDef> <ClassDeclOrFuncDefRepetition>
+            p.Expand(1);
+            if (!ParseClassDeclOrFuncDef(p))
+            {
+                return false;
+            }
+            continue;
+
+        case TokenType::EndOfFile:
+            // 2: <ClassDeclOrFuncDefRepetition> -> epsilon
+            p.Expand(2);
+            return true;
+
+        default:
+            if (p.RecoverFromError(NonTerminal::ClassDeclOrFuncDefRepetition, ErrorID::Default))
+            {
+                continue;
+            }
+            return !p.IsStopped();
+        }
+    }
+}
+
+// <ClassDeclOrFuncDef>
+static bool ParseClassDeclOrFuncDef(RecursiveDescentParser& p)
+{
+    while (true)
+    {
+        switch (p.GetTokenType())
+        {
+        case TokenType::Class:
+            // 3: <ClassDeclOrFuncDef> -> <ClassDecl>
+            p.Expand(3);
+            return ParseClassDecl(p);
+
+        case TokenType::Function:
+            // 4: <ClassDeclOrFuncDef> -> <FuncDef>
+            p.Expand(4);
+            return ParseFuncDef(p);
+
+        default:
+            if (p.RecoverFromError(NonTerminal::ClassDeclOrFuncDef, ErrorID::Default))
+            {
+                continue;
+            }
+            return !p.IsStopped();
+        }
+    }
+}
+
+// <ClassDecl>
+static bool ParseClassDecl(RecursiveDescentParser& p)
+{
+    while (true)
+    {
+        switch (p.GetTokenType())
+        {
+        case TokenType::Class:
+            // 5: <ClassDecl> -> 'class' 'id' <ClassDeclInheritance> '{' <ClassDeclMembDeclRepetition> '}' ';'
+            p.Expand(5);
+            p.Consume();
+            if (!p.Match(TokenType::ID))
+            {
+                return false;
+            }
+            p.ProcessSemanticAction(SemanticAction::PushID);
+            if (!ParseClassDeclInheritance(p))
+            {
+                return false;
+            }
+            if (!p.Match(TokenType::OpenCurlyBracket))
+            {
+                return false;
+            }
+            p.ProcessSemanticAction(SemanticAction::PushStopNode);
+            if (!ParseClassDeclMembDeclRepetition(p))
+            {
+                return false;
+            }
+            if (!p.Match(TokenType::CloseCurlyBracket))
+            {
+                return false;
+            }
+            p.ProcessSemanticAction(SemanticAction::ConstructClass);
+            if (!p.Match(TokenType::SemiColon))
+            {
+                return false;
+            }
+            return true;
+
+        default:
+            if (p.RecoverFromError(NonTerminal::ClassDecl, ErrorID::Default))
+            {
+                continue;
+            }
+            return !p.IsStopped();
+        }
+    }
+}
+
+// <ClassDeclMembDeclRepetition>
+static bool ParseClassDeclMembDeclRepetition(RecursiveDescentParser& p)
+{
+    while (true)
+    {
+        switch (p.GetTokenType())
+        {
+        case TokenType::Constructor:
+        case TokenType::Attribute:
+        case TokenType::Function:
+        case TokenType::Public:
+        case TokenType::Private:
+            // 6: <ClassDeclMembDeclRepetition> -> <Visibility> <MemberDecl> <ClassDeclMembDeclRepetition>
+            p.Expand(6);
+            if (!ParseVisibility(p))
+            {
+                return false;
+            }
+            if (!ParseMemberDecl(p))
+            {
+                return false;
+            }
+            continue;
+
+        case TokenType::CloseCurlyBracket:
+            // 7: <ClassDeclMembDeclRepetition> -> epsilon
+            p.Expand(7);
+            return true;
+
+        default:
+            if (p.RecoverFromError(NonTerminal::ClassDeclMembDeclRepetition, ErrorID::Default))
+            {
+                continue;
+            }
+            return !p.IsStopped();
+        }
+    }
+}
+
+// <ClassDeclInheritance>
+static bool ParseClassDeclInheritance(RecursiveDescentParser& p)
+{
+    while (true)
+    {
+        switch (p.GetTokenType())
+        {
+        case TokenType::IsA:
+            // 8: <ClassDeclInheritance> -> 'isa' 'id' <ClassDeclInheritanceTail>
+            p.Expand(8);
+            p.ProcessSemanticAction(SemanticAction::PushStopNode);
+            p.Consume();
+            if (!p.Match(TokenType::ID))
+            {
+                return false;
+            }
+            p.ProcessSemanticAction(SemanticAction::PushID);
+            return ParseClassDeclInheritanceTail(p);
+
+        case TokenType::OpenCurlyBracket:
+            // 9: <ClassDeclInheritance> ->
+            p.Expand(9);
+            p.ProcessSemanticAction(SemanticAction::PushStopNode);
+            p.ProcessSemanticAction(SemanticAction::ConstructInheritanceList);
+            return true;
+
+        default:
+            if (p.RecoverFromError(NonTerminal::ClassDeclInheritance, ErrorID::Default))
+            {
+                continue;
+            }
+            return !p.IsStopped();
+        }
+    }
+}
+
+// <ClassDeclInheritanceTail>
+static bool ParseClassDeclInheritanceTail(RecursiveDescentParser& p)
+{
+    while (true)
+    {
+        switch (p.GetTokenType())
+        {
+        case TokenType::Comma:
+            // 10: <ClassDeclInheritanceTail> -> ',' 'id' <ClassDeclInheritanceTail>
+            p.Expand(10);
+            p.Consume();
+            if (!p.Match(TokenType::ID))
+            {
+                return false;
+            }
+            p.ProcessSemanticAction(SemanticAction::PushID);
+            continue;
+
+        case TokenType::OpenCurlyBracket:
+            // 11: <ClassDeclInheritanceTail> ->
+            p.Expand(11);
+            p.ProcessSemanticAction(SemanticAction::ConstructInheritanceList);
+            return true;
+
+        default:
+            if (p.RecoverFromError(NonTerminal::ClassDeclInheritanceTail, ErrorID::Default))
+            {
+                continue;
+            }
+            return !p.IsStopped();
+        }
+    }
+}
+
+// <Visibility>
+static bool ParseVisibility(RecursiveDescentParser& p)
+{
+    while (true)
+    {
+        switch (p.GetTokenType())
+        {
+        case TokenType::Public:
+            // 12: <Visibility> -> 'public'
+            p.Expand(12);
+            p.Consume();
+            p.ProcessSemanticAction(SemanticAction::ConstructVisibility);
+            return true;
+
+        case TokenType::Private:
+            // 13: <Visibility> -> 'private'
+            p.Expand(13);
+            p.Consume();
+            p.ProcessSemanticAction(SemanticAction::ConstructVisibility);
+            return true;
+
+        case TokenType::Constructor:
+        case TokenType::Attribute:
+        case TokenType::Function:
+            // 14: <Visibility> ->
+            p.Expand(14);
+            p.ProcessSemanticAction(SemanticAction::ConstructDefaultVisibility);
+            return true;
+
+        default:
+            if (p.RecoverFromError(NonTerminal::Visibility, ErrorID::Default))
+            {
+                continue;
+            }
+            return !p.IsStopped();
+        }
+    }
+}
+
+// <MemberDecl>
+static bool ParseMemberDecl(RecursiveDescentParser& p)
+{
+    while (true)
+    {
+        switch (p.GetTokenType())
+        {
+        case TokenType::Constructor:
+        case TokenType::Function:
+            // 15: <MemberDecl> -> <MemberFuncDecl>
+            p.Expand(15);
+            return ParseMemberFuncDecl(p);
+
+        case TokenType::Attribute:
+            // 16: <MemberDecl> -> <MemberVarDecl>
+            p.Expand(16);
+            return ParseMemberVarDecl(p);
+
+        default:
+            if (p.RecoverFromError(NonTerminal::MemberDecl, ErrorID::Default))
+            {
+                continue;
+            }
+            return !p.IsStopped();
+        }
+    }
+}
+
+// <MemberFuncDecl>
+static bool ParseMemberFuncDecl(RecursiveDescentParser& p)
+{
+    while (true)
+    {
+        switch (p.GetTokenType())
+        {
+        case TokenType::Function:
+            // 17: <MemberFuncDecl> -> 'function' 'id' ':' '(' <FParams> ')' '=>' <ReturnType> ';'
+            p.Expand(17);
+            p.Consume();
+            if (!p.Match(TokenType::ID))
+            {
+                return false;
+            }
+            p.ProcessSemanticAction(SemanticAction::PushID);
+            if (!p.Match(TokenType::Colon))
+            {
+                return false;
+            }
+            if (!p.Match(TokenType::OpenParanthese))
+            {
+                return false;
+            }
+            p.ProcessSemanticAction(SemanticAction::PushStopNode);
+            if (!ParseFParams(p))
+            {
+                return false;
+            }
+            p.ProcessSemanticAction(SemanticAction::ConstructFParams);
+            if (!p.Match(TokenType::CloseParanthese))
+            {
+                return false;
+            }
+            if (!p.Match(TokenType::Arrow))
+            {
+                return false;
+            }
+            if (!ParseReturnType(p))
+            {
+                return false;
+            }
+            p.ProcessSemanticAction(SemanticAction::ConstructMemFuncDecl);
+            if (!p.Match(TokenType::SemiColon))
+            {
+                return false;
+            }
+            return true;
+
+        case TokenType::Constructor:
+            // 18: <MemberFuncDecl> -> 'constructor' ':' '(' <FParams> ')' ';'
+            p.Expand(18);
+            p.Consume();
+            if (!p.Match(TokenType::Colon))
+            {
+                return false;
+            }
+            if (!p.Match(TokenType::OpenParanthese))
+            {
+                return false;
+            }
+            p.ProcessSemanticAction(SemanticAction::PushStopNode);
+            if (!ParseFParams(p))
+            {
+                return false;
+            }
+            p.ProcessSemanticAction(SemanticAction::ConstructFParams);
+            if (!p.Match(TokenType::CloseParanthese))
+            {
+                return false;
+            }
+            p.ProcessSemanticAction(SemanticAction::ConstructConstructorDecl);
+            if (!p.Match(TokenType::SemiColon))
+            {
+                return false;
+            }
+            return true;
+
+        default:
+            if (p.RecoverFromError(NonTerminal::MemberFuncDecl, ErrorID::Default))
+            {
+                continue;
+            }
+            return !p.IsStopped();
+        }
+    }
+}
+
+// <MemberVarDecl>
+static bool ParseMemberVarDecl(RecursiveDescentParser& p)
+{
+    while (true)
+    {
+        switch (p.GetTokenType())
+        {
+        case TokenType::Attribute:
+            // 19: <MemberVarDecl> -> 'attribute' 'id' ':' <Type> <ArraySizeRepetition> ';'
+            p.Expand(19);
+            p.Consume();
+            if (!p.Match(TokenType::ID))
+            {
+                return false;
+            }
+            p.ProcessSemanticAction(SemanticAction::PushID);
+            if (!p.Match(TokenType::Colon))
+            {
+                return false;
+            }
+            if (!ParseType(p))
+            {
+                return false;
+            }
+            p.ProcessSemanticAction(SemanticAction::PushStopNode);
+            if (!ParseArraySizeRepetition(p))
+            {
+                return false;
+            }
+            p.ProcessSemanticAction(SemanticAction::ConstructMemVar);
+            if (!p.Match(TokenType::SemiColon))
+            {
+                return false;
+            }
+            return true;
+
+        default:
+            if (p.RecoverFromError(NonTerminal::MemberVarDecl, ErrorID::Default))
+            {
+                continue;
+            }
+            return !p.IsStopped();
+        }
+    }
+}
+
+// <FuncDef>
+static bool ParseFuncDef(RecursiveDescentParser& p)
+{
+    while (true)
+    {
+        switch (p.GetTokenType())
+        {
+        case TokenType::Function:
+            // 20: <FuncDef> -> <FuncHead> <FuncBody>
+            p.Expand(20);
+            if (!ParseFuncHead(p))
+            {
+                return false;
+            }
+            return ParseFuncBody(p);
+
+        default:
+            if (p.RecoverFromError(NonTerminal::FuncDef, ErrorID::Default))
+            {
+                continue;
+            }
+            return !p.IsStopped();
+        }
+    }
+}
+
+// <FuncHead>
+static bool ParseFuncHead(RecursiveDescentParser& p)
+{
+    while (true)
+    {
+        switch (p.GetTokenType())
+        {
+        case TokenType::Function:
+            // 21: <FuncHead> -> 'function' 'id' <FuncHead2>
+            p.Expand(21);
+            p.Consume();
+            if (!p.Match(TokenType::ID))
+            {
+                return false;
+            }
+            p.ProcessSemanticAction(SemanticAction::PushID);
+            return ParseFuncHead2(p);
+
+        default:
+            if (p.RecoverFromError(NonTerminal::FuncHead, ErrorID::InvalidFunctionHead))
+            {
+                continue;
+            }
+            return !p.IsStopped();
+        }
+    }
+}
+
+// <FuncHead2>
+static bool ParseFuncHead2(RecursiveDescentParser& p)
+{
+    while (true)
+    {
+        switch (p.GetTokenType())
+        {
+        case TokenType::Scope:
+            // 22: <FuncHead2> -> '::' <FuncHead3>
+            p.Expand(22);
+            p.Consume();
+            return ParseFuncHead3(p);
+
+        case TokenType::OpenParanthese:
+            // 23: <FuncHead2> -> '(' <FParams> ')' '=>' <ReturnType>
+            p.Expand(23);
+            p.Consume();
+            p.ProcessSemanticAction(SemanticAction::PushStopNode);
+            if (!ParseFParams(p))
+            {
+                return false;
+            }
+            p.ProcessSemanticAction(SemanticAction::ConstructFParams);
+            if (!p.Match(TokenType::CloseParanthese))
+            {
+                return false;
+            }
+            if (!p.Match(TokenType::Arrow))
+            {
+                return false;
+            }
+            if (!ParseReturnType(p))
+            {
+                return false;
+            }
+            p.ProcessSemanticAction(SemanticAction::PushFreeFuncMarker);
+            return true;
+
+        default:
+            if (p.RecoverFromError(NonTerminal::FuncHead2, ErrorID::InvalidFunctionHead))
+            {
+                continue;
+            }
+            return !p.IsStopped();
+        }
+    }
+}
+
+// <FuncHead3>
+static bool ParseFuncHead3(RecursiveDescentParser& p)
+{
+    while (true)
+    {
+        switch (p.GetTokenType())
+        {
+        case TokenType::ID:
+            // 24: <FuncHead3> -> 'id' '(' <FParams> ')' '=>' <ReturnType>
+            p.Expand(24);
+            p.Consume();
+            p.ProcessSemanticAction(SemanticAction::PushID);
+            if (!p.Match(TokenType::OpenParanthese))
+            {
+                return false;
+            }
+            p.ProcessSemanticAction(SemanticAction::PushStopNode);
+            if (!ParseFParams(p))
+            {
+                return false;
+            }
+            p.ProcessSemanticAction(SemanticAction::ConstructFParams);
+            if (!p.Match(TokenType::CloseParanthese))
+            {
+                return false;
+            }
+            if (!p.Match(TokenType::Arrow))
+            {
+                return false;
+            }
+            if (!ParseReturnType(p))
+            {
+                return false;
+            }
+            p.ProcessSemanticAction(SemanticAction::PushMemFuncMarker);
+            return true;
+
+        case TokenType::Constructor:
+            // 25: <FuncHead3> -> 'constructor' '(' <FParams> ')'
+            p.Expand(25);
+            p.Consume();
+            if (!p.Match(TokenType::OpenParanthese))
+            {
+                return false;
+            }
+            p.ProcessSemanticAction(SemanticAction::PushStopNode);
+            if (!ParseFParams(p))
+            {
+                return false;
+            }
+            p.ProcessSemanticAction(SemanticAction::ConstructFParams);
+            if (!p.Match(TokenType::CloseParanthese))
+            {
+                return false;
+            }
+            p.ProcessSemanticAction(SemanticAction::PushConstructorMarker);
+            return true;
+
+        default:
+            if (p.RecoverFromError(NonTerminal::FuncHead3, ErrorID::InvalidFunctionHead))
+            {
+                continue;
+            }
+            return !p.IsStopped();
+        }
+    }
+}
+
+// <FuncBody>
+static bool ParseFuncBody(RecursiveDescentParser& p)
+{
+    while (true)
+    {
+        switch (p.GetTokenType())
+        {
+        case TokenType::OpenCurlyBracket:
+            // 26: <FuncBody> -> '{' <LocalVarDeclOrStmtRepetition> '}'
+            p.Expand(26);
+            p.Consume();
+            p.ProcessSemanticAction(SemanticAction::PushStopNode);
+            if (!ParseLocalVarDeclOrStmtRepetition(p))
+            {
+                return false;
+            }
+            p.ProcessSemanticAction(SemanticAction::ConstructStatBlock);
+            if (!p.Match(TokenType::CloseCurlyBracket))
+            {
+                return false;
+            }
+            p.ProcessSemanticAction(SemanticAction::ConstructFuncDef);
+            return true;
+
+        default:
+            if (p.RecoverFromError(NonTerminal::FuncBody, ErrorID::ErroneousTokenAtFuncDef))
+            {
+                continue;
+            }
+            return !p.IsStopped();
+        }
+    }
+}
+
+// <LocalVarDeclOrStmtRepetition>
+static bool ParseLocalVarDeclOrStmtRepetition(RecursiveDescentParser& p)
+{
+    while (true)
+    {
+        switch (p.GetTokenType())
+        {
+        case TokenType::ID:
+        case TokenType::While:
+        case TokenType::If:
+        case TokenType::Read:
+        case TokenType::Write:
+        case TokenType::Return:
+        case TokenType::LocalVar:
+            // 27: <LocalVarDeclOrStmtRepetition> -> <LocalVarDeclOrStmt> <LocalVarDeclOrStmtRepetition>
+            p.Expand(27);
+            if (!ParseLocalVarDeclOrStmt(p))
+            {
+                return false;
+            }
+            continue;
+
+        case TokenType::CloseCurlyBracket:
+            // 28: <LocalVarDeclOrStmtRepetition> -> epsilon
+            p.Expand(28);
+            return true;
+
+        default:
+            if (p.RecoverFromError(NonTerminal::LocalVarDeclOrStmtRepetition, ErrorID::InvalidStatement))
+            {
+                continue;
+            }
+            return !p.IsStopped();
+        }
+    }
+}
+
+// <LocalVarDeclOrStmt>
+static bool ParseLocalVarDeclOrStmt(RecursiveDescentParser& p)
+{
+    while (true)
+    {
+        switch (p.GetTokenType())
+        {
+        case TokenType::LocalVar:
+            // 29: <LocalVarDeclOrStmt> -> <LocalVarDecl>
+            p.Expand(29);
+            return ParseLocalVarDecl(p);
+
+        case TokenType::ID:
+        case TokenType::While:
+        case TokenType::If:
+        case TokenType::Read:
+        case TokenType::Write:
+        case TokenType::Return:
+            // 30: <LocalVarDeclOrStmt> -> <Statement>
+            p.Expand(30);
+            return ParseStatement(p);
+
+        default:
+            if (p.RecoverFromError(NonTerminal::LocalVarDeclOrStmt, ErrorID::Default))
+            {
+                continue;
+            }
+            return !p.IsStopped();
+        }
+    }
+}
+
+// <LocalVarDecl>
+static bool ParseLocalVarDecl(RecursiveDescentParser& p)
+{
+    while (true)
+    {
+        switch (p.GetTokenType())
+        {
+        case TokenType::LocalVar:
+            // 31: <LocalVarDecl> -> 'localvar' 'id' ':' <Type> <LocalVarDecl2> ';'
+            p.Expand(31);
+            p.Consume();
+            if (!p.Match(TokenType::ID))
+            {
+                return false;
+            }
+            p.ProcessSemanticAction(SemanticAction::PushID);
+            if (!p.Match(TokenType::Colon))
+            {
+                return false;
+            }
+            if (!ParseType(p))
+            {
+                return false;
+            }
+            if (!ParseLocalVarDecl2(p))
+            {
+                return false;
+            }
+            p.ProcessSemanticAction(SemanticAction::ConstructVarDecl);
+            if (!p.Match(TokenType::SemiColon))
+            {
+                return false;
+            }
+            return true;
+
+        default:
+            if (p.RecoverFromError(NonTerminal::LocalVarDecl, ErrorID::Default))
+            {
+                continue;
+            }
+            return !p.IsStopped();
+        }
+    }
+}
+
+// <LocalVarDecl2>
+static bool ParseLocalVarDecl2(RecursiveDescentParser& p)
+{
+    while (true)
+    {
+        switch (p.GetTokenType())
+        {
+        case TokenType::OpenSquareBracket:
+        case TokenType::SemiColon:
+            // 32: <LocalVarDecl2> -> <ArraySizeRepetition>
+            p.Expand(32);
+            p.ProcessSemanticAction(SemanticAction::PushStopNode);
+            return ParseArraySizeRepetition(p);
+
+        case TokenType::OpenParanthese:
+            // 33: <LocalVarDecl2> -> '(' <AParams> ')'
+            p.Expand(33);
+            p.Consume();
+            p.ProcessSemanticAction(SemanticAction::PushStopNode);
+            if (!ParseAParams(p))
+            {
+                return false;
+            }
+            p.ProcessSemanticAction(SemanticAction::ConstructAParams);
+            if (!p.Match(TokenType::CloseParanthese))
+            {
+                return false;
+            }
+            return true;
+
+        default:
+            if (p.RecoverFromError(NonTerminal::LocalVarDecl2, ErrorID::Default))
+            {
+                continue;
+            }
+            return !p.IsStopped();
+        }
+    }
+}
+
+// <Statement>
+static bool ParseStatement(RecursiveDescentParser& p)
+{
+    while (true)
+    {
+        switch (p.GetTokenType())
+        {
+        case TokenType::ID:
+            // 34: <Statement> -> <SimpleStatement> ';'
+            p.Expand(34);
+            if (!ParseSimpleStatement(p))
+            {
+                return false;
+            }
+            if (!p.Match(TokenType::SemiColon))
+            {
+                return false;
+            }
+            return true;
+
+        case TokenType::If:
+            // 35: <Statement> -> 'if' '(' <RelExpr> ')' 'then' <StatBlock> 'else' <StatBlock> ';'
+            p.Expand(35);
+            p.Consume();
+            if (!p.Match(TokenType::OpenParanthese))
+            {
+                return false;
+            }
+            if (!ParseRelExpr(p))
+            {
+                return false;
+            }
+            if (!p.Match(TokenType::CloseParanthese))
+            {
+                return false;
+            }
+            if (!p.Match(TokenType::Then))
+            {
+                return false;
+            }
+            if (!ParseStatBlock(p))
+            {
+                return false;
+            }
+            if (!p.Match(TokenType::Else))
+            {
+                return false;
+            }
+            if (!ParseStatBlock(p))
+            {
+                return false;
+            }
+            p.ProcessSemanticAction(SemanticAction::ConstructIfStat);
+            if (!p.Match(TokenType::SemiColon))
+            {
+                return false;
+            }
+            return true;
+
+        case TokenType::While:
+            // 36: <Statement> -> 'while' '(' <RelExpr> ')' <StatBlock> ';'
+            p.Expand(36);
+            p.Consume();
+            if (!p.Match(TokenType::OpenParanthese))
+            {
+                return false;
+            }
+            if (!ParseRelExpr(p))
+            {
+                return false;
+            }
+            if (!p.Match(TokenType::CloseParanthese))
+            {
+                return false;
+            }
+            if (!ParseStatBlock(p))
+            {
+                return false;
+            }
+            p.ProcessSemanticAction(SemanticAction::ConstructWhileStat);
+            if (!p.Match(TokenType::SemiColon))
+            {
+                return false;
+            }
+            return true;
+
+        case TokenType::Read:
+            // 37: <Statement> -> 'read' '(' <Variable> ')' ';'
+            p.Expand(37);
+            p.Consume();
+            if (!p.Match(TokenType::OpenParanthese))
+            {
+                return false;
+            }
+            if (!ParseVariable(p))
+            {
+                return false;
+            }
+            if (!p.Match(TokenType::CloseParanthese))
+            {
+                return false;
+            }
+            p.ProcessSemanticAction(SemanticAction::ConstructReadStat);
+            if (!p.Match(TokenType::SemiColon))
+            {
+                return false;
+            }
+            return true;
+
+        case TokenType::Write:
+            // 38: <Statement> -> 'write' '(' <Expr> ')' ';'
+            p.Expand(38);
+            p.Consume();
+            if (!p.Match(TokenType::OpenParanthese))
+            {
+                return false;
+            }
+            if (!ParseExpr(p))
+            {
+                return false;
+            }
+            if (!p.Match(TokenType::CloseParanthese))
+            {
+                return false;
+            }
+            p.ProcessSemanticAction(SemanticAction::ConstructWriteStat);
+            if (!p.Match(TokenType::SemiColon))
+            {
+                return false;
+            }
+            return true;
+
+        case TokenType::Return:
+            // 39: <Statement> -> 'return' '(' <Expr> ')' ';'
+            p.Expand(39);
+            p.Consume();
+            if (!p.Match(TokenType::OpenParanthese))
+            {
+                return false;
+            }
+            if (!ParseExpr(p))
+            {
+                return false;
+            }
+            if (!p.Match(TokenType::CloseParanthese))
+            {
+                return false;
+            }
+            p.ProcessSemanticAction(SemanticAction::ConstructReturnStat);
+            if (!p.Match(TokenType::SemiColon))
+            {
+                return false;
+            }
+            return true;
+
+        default:
+            if (p.RecoverFromError(NonTerminal::Statement, ErrorID::Default))
+            {
+                continue;
+            }
+            return !p.IsStopped();
+        }
+    }
+}
+
+// <SimpleStatement>
+static bool ParseSimpleStatement(RecursiveDescentParser& p)
+{
+    while (true)
+    {
+        switch (p.GetTokenType())
+        {
+        case TokenType::ID:
+            // 40: <SimpleStatement> -> 'id' <SimpleStatement2>
+            p.Expand(40);
+            p.Consume();
+            p.ProcessSemanticAction(SemanticAction::PushID);
+            return ParseSimpleStatement2(p);
+
+        default:
+            if (p.RecoverFromError(NonTerminal::SimpleStatement, ErrorID::InvalidStatement))
+            {
+                continue;
+            }
+            return !p.IsStopped();
+        }
+    }
+}
+
+// <SimpleStatement2>
+static bool ParseSimpleStatement2(RecursiveDescentParser& p)
+{
+    while (true)
+    {
+        switch (p.GetTokenType())
+        {
+        case TokenType::Assign:
+        case TokenType::OpenSquareBracket:
+        case TokenType::Dot:
+            // 41: <SimpleStatement2> -> <Indice> <SimpleStatement3>
+            p.Expand(41);
+            p.ProcessSemanticAction(SemanticAction::PushStopNode);
+            if (!ParseIndice(p))
+            {
+                return false;
+            }
+            p.ProcessSemanticAction(SemanticAction::ConstructVariable);
+            return ParseSimpleStatement3(p);
+
+        case TokenType::OpenParanthese:
+            // 42: <SimpleStatement2> -> '(' <AParams> ')' <SimpleStatement4>
+            p.Expand(42);
+            p.Consume();
+            p.ProcessSemanticAction(SemanticAction::PushStopNode);
+            if (!ParseAParams(p))
+            {
+                return false;
+            }
+            p.ProcessSemanticAction(SemanticAction::ConstructAParams);
+            if (!p.Match(TokenType::CloseParanthese))
+            {
+                return false;
+            }
+            p.ProcessSemanticAction(SemanticAction::ConstructFuncCall);
+            return ParseSimpleStatement4(p);
+
+        default:
+            if (p.RecoverFromError(NonTerminal::SimpleStatement2, ErrorID::Default))
+            {
+                continue;
+            }
+            return !p.IsStopped();
+        }
+    }
+}
+
+// <SimpleStatement3>
+static bool ParseSimpleStatement3(RecursiveDescentParser& p)
+{
+    while (true)
+    {
+        switch (p.GetTokenType())
+        {
+        case TokenType::Dot:
+            // 43: <SimpleStatement3> -> '.' <SimpleStatement>
+            p.Expand(43);
+            p.Consume();
+            p.ProcessSemanticAction(SemanticAction::EncounteredDot);
+            if (!ParseSimpleStatement(p))
+            {
+                return false;
+            }
+            p.ProcessSemanticAction(SemanticAction::ConstructDotNode);
+            return true;
+
+        case TokenType::Assign:
+            // 44: <SimpleStatement3> -> '=' <Expr>
+            p.Expand(44);
+            p.Consume();
+            p.ProcessSemanticAction(SemanticAction::ConstructEncounteredDots);
+            if (!ParseExpr(p))
+            {
+                return false;
+            }
+            p.ProcessSemanticAction(SemanticAction::ConstructAssignStat);
+            return true;
+
+        default:
+            if (p.RecoverFromError(NonTerminal::SimpleStatement3, ErrorID::Default))
+            {
+                continue;
+            }
+            return !p.IsStopped();
+        }
+    }
+}
+
+// <SimpleStatement4>
+static bool ParseSimpleStatement4(RecursiveDescentParser& p)
+{
+    while (true)
+    {
+        switch (p.GetTokenType())
+        {
+        case TokenType::Dot:
+            // 45: <SimpleStatement4> -> '.' <SimpleStatement>
+            p.Expand(45);
+            p.Consume();
+            p.ProcessSemanticAction(SemanticAction::EncounteredDot);
+            if (!ParseSimpleStatement(p))
+            {
+                return false;
+            }
+            p.ProcessSemanticAction(SemanticAction::ConstructDotNode);
+            return true;
+
+        case TokenType::SemiColon:
+            // 46: <SimpleStatement4> -> epsilon
+            p.Expand(46);
+            return true;
+
+        default:
+            if (p.RecoverFromError(NonTerminal::SimpleStatement4, ErrorID::Default))
+            {
+                continue;
+            }
+            return !p.IsStopped();
+        }
+    }
+}
+
+// <StatementRepetition>
+static bool ParseStatementRepetition(RecursiveDescentParser& p)
+{
+    while (true)
+    {
+        switch (p.GetTokenType())
+        {
+        case TokenType::ID:
+        case TokenType::While:
+        case TokenType::If:
+        case TokenType::Read:
+        case TokenType::Write:
+        case TokenType::Return:
+            // 47: <StatementRepetition> -> <Statement> <StatementRepetition>
+            p.Expand(47);
+            if (!ParseStatement(p))
+            {
+                return false;
+            }
+            continue;
+
+        case TokenType::CloseCurlyBracket:
+            // 48: <StatementRepetition> -> epsilon
+            p.Expand(48);
+            return true;
+
+        default:
+            if (p.RecoverFromError(NonTerminal::StatementRepetition, ErrorID::InvalidStatement))
+            {
+                continue;
+            }
+            return !p.IsStopped();
+        }
+    }
+}
+
+// <StatBlock>
+static bool ParseStatBlock(RecursiveDescentParser& p)
+{
+    while (true)
+    {
+        switch (p.GetTokenType())
+        {
+        case TokenType::OpenCurlyBracket:
+            // 49: <StatBlock> -> '{' <StatementRepetition> '}'
+            p.Expand(49);
+            p.ProcessSemanticAction(SemanticAction::PushStopNode);
+            p.Consume();
+            if (!ParseStatementRepetition(p))
+            {
+                return false;
+            }
+            p.ProcessSemanticAction(SemanticAction::ConstructStatBlock);
+            if (!p.Match(TokenType::CloseCurlyBracket))
+            {
+                return false;
+            }
+            return true;
+
+        case TokenType::ID:
+        case TokenType::While:
+        case TokenType::If:
+        case TokenType::Read:
+        case TokenType::Write:
+        case TokenType::Return:
+            // 50: <StatBlock> -> <Statement>
+            p.Expand(50);
+            p.ProcessSemanticAction(SemanticAction::PushStopNode);
+            if (!ParseStatement(p))
+            {
+                return false;
+            }
+            p.ProcessSemanticAction(SemanticAction::ConstructStatBlock);
+            return true;
+
+        case TokenType::Else:
+        case TokenType::SemiColon:
+            // 51: <StatBlock> ->
+            p.Expand(51);
+            p.ProcessSemanticAction(SemanticAction::PushStopNode);
+            p.ProcessSemanticAction(SemanticAction::ConstructStatBlock);
+            return true;
+
+        default:
+            if (p.RecoverFromError(NonTerminal::StatBlock, ErrorID::Default))
+            {
+                continue;
+            }
+            return !p.IsStopped();
+        }
+    }
+}
+
+// <Expr>
+static bool ParseExpr(RecursiveDescentParser& p)
+{
+    while (true)
+    {
+        switch (p.GetTokenType())
+        {
+        case TokenType::ID:
+        case TokenType::IntegerLiteral:
+        case TokenType::FloatLiteral:
+        case TokenType::Not:
+        case TokenType::Plus:
+        case TokenType::Minus:
+        case TokenType::OpenParanthese:
+            // 52: <Expr> -> <ArithExpr> <Expr2>
+            p.Expand(52);
+            if (!ParseArithExpr(p))
+            {
+                return false;
+            }
+            return ParseExpr2(p);
+
+        default:
+            if (p.RecoverFromError(NonTerminal::Expr, ErrorID::Default))
+            {
+                continue;
+            }
+            return !p.IsStopped();
+        }
+    }
+}
+
+// <Expr2>
+static bool ParseExpr2(RecursiveDescentParser& p)
+{
+    while (true)
+    {
+        switch (p.GetTokenType())
+        {
+        case TokenType::Equal:
+        case TokenType::NotEqual:
+        case TokenType::LessThan:
+        case TokenType::GreaterThan:
+        case TokenType::LessOrEqual:
+        case TokenType::GreaterOrEqual:
+            // 53: <Expr2> -> <RelOp> <ArithExpr>
+            p.Expand(53);
+            if (!ParseRelOp(p))
+            {
+                return false;
+            }
+            if (!ParseArithExpr(p))
+            {
+                return false;
+            }
+            p.ProcessSemanticAction(SemanticAction::ConstructRelOp);
+            p.ProcessSemanticAction(SemanticAction::ConstructExpr);
+            return true;
+
+        case TokenType::CloseParanthese:
+        case TokenType::SemiColon:
+        case TokenType::Comma:
+            // 54: <Expr2> ->
+            p.Expand(54);
+            p.ProcessSemanticAction(SemanticAction::ConstructExpr);
+            return true;
+
+        default:
+            if (p.RecoverFromError(NonTerminal::Expr2, ErrorID::InvalidOperator))
+            {
+                continue;
+            }
+            return !p.IsStopped();
+        }
+    }
+}
+
+// <RelExpr>
+static bool ParseRelExpr(RecursiveDescentParser& p)
+{
+    while (true)
+    {
+        switch (p.GetTokenType())
+        {
+        case TokenType::ID:
+        case TokenType::IntegerLiteral:
+        case TokenType::FloatLiteral:
+        case TokenType::Not:
+        case TokenType::Plus:
+        case TokenType::Minus:
+        case TokenType::OpenParanthese:
+            // 55: <RelExpr> -> <ArithExpr> <RelOp> <ArithExpr>
+            p.Expand(55);
+            if (!ParseArithExpr(p))
+            {
+                return false;
+            }
+            if (!ParseRelOp(p))
+            {
+                return false;
+            }
+            if (!ParseArithExpr(p))
+            {
+                return false;
+            }
+            p.ProcessSemanticAction(SemanticAction::ConstructRelOp);
+            p.ProcessSemanticAction(SemanticAction::ConstructExpr);
+            return true;
+
+        default:
+            if (p.RecoverFromError(NonTerminal::RelExpr, ErrorID::InvalidRelExpr))
+            {
+                continue;
+            }
+            return !p.IsStopped();
+        }
+    }
+}
+
+// <ArithExpr>
+static bool ParseArithExpr(RecursiveDescentParser& p)
+{
+    while (true)
+    {
+        switch (p.GetTokenType())
+        {
+        case TokenType::ID:
+        case TokenType::IntegerLiteral:
+        case TokenType::FloatLiteral:
+        case TokenType::Not:
+        case TokenType::Plus:
+        case TokenType::Minus:
+        case TokenType::OpenParanthese:
+            // 56: <ArithExpr> -> <Term> <ArithExpr2>
+            p.Expand(56);
+            if (!ParseTerm(p))
+            {
+                return false;
+            }
+            return ParseArithExpr2(p);
+
+        default:
+            if (p.RecoverFromError(NonTerminal::ArithExpr, ErrorID::InvalidArithExpr))
+            {
+                continue;
+            }
+            return !p.IsStopped();
+        }
+    }
+}
+
+// <ArithExpr2>
+static bool ParseArithExpr2(RecursiveDescentParser& p)
+{
+    while (true)
+    {
+        switch (p.GetTokenType())
+        {
+        case TokenType::Or:
+        case TokenType::Plus:
+        case TokenType::Minus:
+            // 57: <ArithExpr2> -> <AddOp> <Term> <ArithExpr2>
+            p.Expand(57);
+            if (!ParseAddOp(p))
+            {
+                return false;
+            }
+            if (!ParseTerm(p))
+            {
+                return false;
+            }
+            p.ProcessSemanticAction(SemanticAction::ConstructAddOp);
+            continue;
+
+        case TokenType::Equal:
+        case TokenType::NotEqual:
+        case TokenType::LessThan:
+        case TokenType::GreaterThan:
+        case TokenType::LessOrEqual:
+        case TokenType::GreaterOrEqual:
+        case TokenType::CloseParanthese:
+        case TokenType::CloseSquareBracket:
+        case TokenType::SemiColon:
+        case TokenType::Comma:
+            // 58: <ArithExpr2> -> epsilon
+            p.Expand(58);
+            return true;
+
+        default:
+            if (p.RecoverFromError(NonTerminal::ArithExpr2, ErrorID::InvalidOperator))
+            {
+                continue;
+            }
+            return !p.IsStopped();
+        }
+    }
+}
+
+// <Sign>
+static bool ParseSign(RecursiveDescentParser& p)
+{
+    while (true)
+    {
+        switch (p.GetTokenType())
+        {
+        case TokenType::Plus:
+            // 59: <Sign> -> '+'
+            p.Expand(59);
+            p.Consume();
+            p.ProcessSemanticAction(SemanticAction::PushSign);
+            return true;
+
+        case TokenType::Minus:
+            // 60: <Sign> -> '-'
+            p.Expand(60);
+            p.Consume();
+            p.ProcessSemanticAction(SemanticAction::PushSign);
+            return true;
+
+        default:
+            if (p.RecoverFromError(NonTerminal::Sign, ErrorID::Default))
+            {
+                continue;
+            }
+            return !p.IsStopped();
+        }
+    }
+}
+
+// <Term>
+static bool ParseTerm(RecursiveDescentParser& p)
+{
+    while (true)
+    {
+        switch (p.GetTokenType())
+        {
+        case TokenType::ID:
+        case TokenType::IntegerLiteral:
+        case TokenType::FloatLiteral:
+        case TokenType::Not:
+        case TokenType::Plus:
+        case TokenType::Minus:
+        case TokenType::OpenParanthese:
+            // 61: <Term> -> <Factor> <Term2>
+            p.Expand(61);
+            if (!ParseFactor(p))
+            {
+                return false;
+            }
+            return ParseTerm2(p);
+
+        default:
+            if (p.RecoverFromError(NonTerminal::Term, ErrorID::Default))
+            {
+                continue;
+            }
+            return !p.IsStopped();
+        }
+    }
+}
+
+// <Term2>
+static bool ParseTerm2(RecursiveDescentParser& p)
+{
+    while (true)
+    {
+        switch (p.GetTokenType())
+        {
+        case TokenType::And:
+        case TokenType::Multiply:
+        case TokenType::Divide:
+            // 62: <Term2> -> <MultOp> <Factor> <Term2>
+            p.Expand(62);
+            if (!ParseMultOp(p))
+            {
+                return false;
+            }
+            if (!ParseFactor(p))
+            {
+                return false;
+            }
+            p.ProcessSemanticAction(SemanticAction::ConstructMultOp);
+            continue;
+
+        case TokenType::Or:
+        case TokenType::Equal:
+        case TokenType::NotEqual:
+        case TokenType::LessThan:
+        case TokenType::GreaterThan:
+        case TokenType::LessOrEqual:
+        case TokenType::GreaterOrEqual:
+        case TokenType::Plus:
+        case TokenType::Minus:
+        case TokenType::CloseParanthese:
+        case TokenType::CloseSquareBracket:
+        case TokenType::SemiColon:
+        case TokenType::Comma:
+            // 63: <Term2> -> epsilon
+            p.Expand(63);
+            return true;
+
+        default:
+            if (p.RecoverFromError(NonTerminal::Term2, ErrorID::InvalidOperator))
+            {
+                continue;
+            }
+            return !p.IsStopped();
+        }
+    }
+}
+
+// <Factor>
+static bool ParseFactor(RecursiveDescentParser& p)
+{
+    while (true)
+    {
+        switch (p.GetTokenType())
+        {
+        case TokenType::ID:
+            // 64: <Factor> -> <VarOrFuncCall>
+            p.Expand(64);
+            return ParseVarOrFuncCall(p);
+
+        case TokenType::IntegerLiteral:
+            // 65: <Factor> -> 'integer literal'
+            p.Expand(65);
+            p.Consume();
+            p.ProcessSemanticAction(SemanticAction::ConstructIntLiteral);
+            return true;
+
+        case TokenType::FloatLiteral:
+            // 66: <Factor> -> 'float literal'
+            p.Expand(66);
+            p.Consume();
+            p.ProcessSemanticAction(SemanticAction::ConstructFloatLiteral);
+            return true;
+
+        case TokenType::OpenParanthese:
+            // 67: <Factor> -> '(' <ArithExpr> ')'
+            p.Expand(67);
+            p.Consume();
+            if (!ParseArithExpr(p))
+            {
+                return false;
+            }
+            if (!p.Match(TokenType::CloseParanthese))
+            {
+                return false;
+            }
+            return true;
+
+        case TokenType::Not:
+            // 68: <Factor> -> 'not' <Factor>
+            p.Expand(68);
+            p.Consume();
+            p.ProcessSemanticAction(SemanticAction::PushNot);
+            if (!ParseFactor(p))
+            {
+                return false;
+            }
+            p.ProcessSemanticAction(SemanticAction::ConstructModifiedExpr);
+            return true;
+
+        case TokenType::Plus:
+        case TokenType::Minus:
+            // 69: <Factor> -> <Sign> <Factor>
+            p.Expand(69);
+            if (!ParseSign(p))
+            {
+                return false;
+            }
+            if (!ParseFactor(p))
+            {
+                return false;
+            }
+            p.ProcessSemanticAction(SemanticAction::ConstructModifiedExpr);
+            return true;
+
+        default:
+            if (p.RecoverFromError(NonTerminal::Factor, ErrorID::Default))
+            {
+                continue;
+            }
+            return !p.IsStopped();
+        }
+    }
+}
+
+// <VarOrFuncCall>
+static bool ParseVarOrFuncCall(RecursiveDescentParser& p)
+{
+    while (true)
+    {
+        switch (p.GetTokenType())
+        {
+        case TokenType::ID:
+            // 70: <VarOrFuncCall> -> 'id' <VarOrFuncCall2>
+            p.Expand(70);
+            p.Consume();
+            p.ProcessSemanticAction(SemanticAction::PushID);
+            return ParseVarOrFuncCall2(p);
+
+        default:
+            if (p.RecoverFromError(NonTerminal::VarOrFuncCall, ErrorID::Default))
+            {
+                continue;
+            }
+            return !p.IsStopped();
+        }
+    }
+}
+
+// <VarOrFuncCall2>
+static bool ParseVarOrFuncCall2(RecursiveDescentParser& p)
+{
+    while (true)
+    {
+        switch (p.GetTokenType())
+        {
+        case TokenType::Or:
+        case TokenType::And:
+        case TokenType::Equal:
+        case TokenType::NotEqual:
+        case TokenType::LessThan:
+        case TokenType::GreaterThan:
+        case TokenType::LessOrEqual:
+        case TokenType::GreaterOrEqual:
+        case TokenType::Plus:
+        case TokenType::Minus:
+        case TokenType::Multiply:
+        case TokenType::Divide:
+        case TokenType::CloseParanthese:
+        case TokenType::OpenSquareBracket:
+        case TokenType::CloseSquareBracket:
+        case TokenType::SemiColon:
+        case TokenType::Comma:
+        case TokenType::Dot:
+            // 71: <VarOrFuncCall2> -> <Indice> <VarOrFuncCall3>
+            p.Expand(71);
+            p.ProcessSemanticAction(SemanticAction::PushStopNode);
+            if (!ParseIndice(p))
+            {
+                return false;
+            }
+            p.ProcessSemanticAction(SemanticAction::ConstructVariable);
+            return ParseVarOrFuncCall3(p);
+
+        case TokenType::OpenParanthese:
+            // 72: <VarOrFuncCall2> -> '(' <AParams> ')' <VarOrFuncCall3>
+            p.Expand(72);
+            p.Consume();
+            p.ProcessSemanticAction(SemanticAction::PushStopNode);
+            if (!ParseAParams(p))
+            {
+                return false;
+            }
+            p.ProcessSemanticAction(SemanticAction::ConstructAParams);
+            if (!p.Match(TokenType::CloseParanthese))
+            {
+                return false;
+            }
+            p.ProcessSemanticAction(SemanticAction::ConstructFuncCall);
+            return ParseVarOrFuncCall3(p);
+
+        default:
+            if (p.RecoverFromError(NonTerminal::VarOrFuncCall2, ErrorID::Default))
+            {
+                continue;
+            }
+            return !p.IsStopped();
+        }
+    }
+}
+
+// <VarOrFuncCall3>
+static bool ParseVarOrFuncCall3(RecursiveDescentParser& p)
+{
+    while (true)
+    {
+        switch (p.GetTokenType())
+        {
+        case TokenType::Dot:
+            // 73: <VarOrFuncCall3> -> '.' <VarOrFuncCall>
+            p.Expand(73);
+            p.Consume();
+            p.ProcessSemanticAction(SemanticAction::EncounteredDot);
+            if (!ParseVarOrFuncCall(p))
+            {
+                return false;
+            }
+            p.ProcessSemanticAction(SemanticAction::ConstructDotNode);
+            return true;
+
+        case TokenType::Or:
+        case TokenType::And:
+        case TokenType::Equal:
+        case TokenType::NotEqual:
+        case TokenType::LessThan:
+        case TokenType::GreaterThan:
+        case TokenType::LessOrEqual:
+        case TokenType::GreaterOrEqual:
+        case TokenType::Plus:
+        case TokenType::Minus:
+        case TokenType::Multiply:
+        case TokenType::Divide:
+        case TokenType::CloseParanthese:
+        case TokenType::CloseSquareBracket:
+        case TokenType::SemiColon:
+        case TokenType::Comma:
+            // 74: <VarOrFuncCall3> -> epsilon
+            p.Expand(74);
+            return true;
+
+        default:
+            if (p.RecoverFromError(NonTerminal::VarOrFuncCall3, ErrorID::Default))
+            {
+                continue;
+            }
+            return !p.IsStopped();
+        }
+    }
+}
+
+// <Variable>
+static bool ParseVariable(RecursiveDescentParser& p)
+{
+    while (true)
+    {
+        switch (p.GetTokenType())
+        {
+        case TokenType::ID:
+            // 75: <Variable> -> 'id' <Variable2>
+            p.Expand(75);
+            p.Consume();
+            p.ProcessSemanticAction(SemanticAction::PushID);
+            return ParseVariable2(p);
+
+        default:
+            if (p.RecoverFromError(NonTerminal::Variable, ErrorID::Default))
+            {
+                continue;
+            }
+            return !p.IsStopped();
+        }
+    }
+}
+
+// <Variable2>
+static bool ParseVariable2(RecursiveDescentParser& p)
+{
+    while (true)
+    {
+        switch (p.GetTokenType())
+        {
+        case TokenType::CloseParanthese:
+        case TokenType::OpenSquareBracket:
+        case TokenType::Dot:
+            // 76: <Variable2> -> <Indice> <Variable3>
+            p.Expand(76);
+            p.ProcessSemanticAction(SemanticAction::PushStopNode);
+            if (!ParseIndice(p))
+            {
+                return false;
+            }
+            p.ProcessSemanticAction(SemanticAction::ConstructVariable);
+            return ParseVariable3(p);
+
+        case TokenType::OpenParanthese:
+            // 77: <Variable2> -> '(' <AParams> ')' '.' <Variable>
+            p.Expand(77);
+            p.Consume();
+            p.ProcessSemanticAction(SemanticAction::PushStopNode);
+            if (!ParseAParams(p))
+            {
+                return false;
+            }
+            p.ProcessSemanticAction(SemanticAction::ConstructAParams);
+            if (!p.Match(TokenType::CloseParanthese))
+            {
+                return false;
+            }
+            p.ProcessSemanticAction(SemanticAction::ConstructFuncCall);
+            if (!p.Match(TokenType::Dot))
+            {
+                return false;
+            }
+            p.ProcessSemanticAction(SemanticAction::EncounteredDot);
+            if (!ParseVariable(p))
+            {
+                return false;
+            }
+            p.ProcessSemanticAction(SemanticAction::ConstructDotNode);
+            return true;
+
+        default:
+            if (p.RecoverFromError(NonTerminal::Variable2, ErrorID::Default))
+            {
+                continue;
+            }
+            return !p.IsStopped();
+        }
+    }
+}
+
+// <Variable3>
+static bool ParseVariable3(RecursiveDescentParser& p)
+{
+    while (true)
+    {
+        switch (p.GetTokenType())
+        {
+        case TokenType::Dot:
+            // 78: <Variable3> -> '.' <Variable>
+            p.Expand(78);
+            p.Consume();
+            p.ProcessSemanticAction(SemanticAction::EncounteredDot);
+            if (!ParseVariable(p))
+            {
+                return false;
+            }
+            p.ProcessSemanticAction(SemanticAction::ConstructDotNode);
+            return true;
+
+        case TokenType::CloseParanthese:
+            // 79: <Variable3> -> epsilon
+            p.Expand(79);
+            return true;
+
+        default:
+            if (p.RecoverFromError(NonTerminal::Variable3, ErrorID::Default))
+            {
+                continue;
+            }
+            return !p.IsStopped();
+        }
+    }
+}
+
+// <Indice>
+static bool ParseIndice(RecursiveDescentParser& p)
+{
+    while (true)
+    {
+        switch (p.GetTokenType())
+        {
+        case TokenType::OpenSquareBracket:
+            // 80: <Indice> -> '[' <ArithExpr> ']' <Indice>
+            p.Expand(80);
+            p.Consume();
+            if (!ParseArithExpr(p))
+            {
+                return false;
+            }
+            if (!p.Match(TokenType::CloseSquareBracket))
+            {
+                return false;
+            }
+            continue;
+
+        case TokenType::Or:
+        case TokenType::And:
+        case TokenType::Equal:
+        case TokenType::NotEqual:
+        case TokenType::LessThan:
+        case TokenType::GreaterThan:
+        case TokenType::LessOrEqual:
+        case TokenType::GreaterOrEqual:
+        case TokenType::Plus:
+        case TokenType::Minus:
+        case TokenType::Multiply:
+        case TokenType::Divide:
+        case TokenType::Assign:
+        case TokenType::CloseParanthese:
+        case TokenType::CloseSquareBracket:
+        case TokenType::SemiColon:
+        case TokenType::Comma:
+        case TokenType::Dot:
+            // 81: <Indice> ->
+            p.Expand(81);
+            p.ProcessSemanticAction(SemanticAction::ConstructDimensions);
+            return true;
+
+        default:
+            if (p.RecoverFromError(NonTerminal::Indice, ErrorID::Default))
+            {
+                continue;
+            }
+            return !p.IsStopped();
+        }
+    }
+}
+
+// <ArraySize>
+static bool ParseArraySize(RecursiveDescentParser& p)
+{
+    while (true)
+    {
+        switch (p.GetTokenType())
+        {
+        case TokenType::OpenSquareBracket:
+            // 82: <ArraySize> -> '[' <ArraySize2>
+            p.Expand(82);
+            p.Consume();
+            return ParseArraySize2(p);
+
+        default:
+            if (p.RecoverFromError(NonTerminal::ArraySize, ErrorID::InvalidArraySize))
+            {
+                continue;
+            }
+            return !p.IsStopped();
+        }
+    }
+}
+
+// <ArraySize2>
+static bool ParseArraySize2(RecursiveDescentParser& p)
+{
+    while (true)
+    {
+        switch (p.GetTokenType())
+        {
+        case TokenType::IntegerLiteral:
+            // 83: <ArraySize2> -> 'integer literal' ']'
+            p.Expand(83);
+            p.Consume();
+            p.ProcessSemanticAction(SemanticAction::ConstructIntLiteral);
+            if (!p.Match(TokenType::CloseSquareBracket))
+            {
+                return false;
+            }
+            return true;
+
+        case TokenType::CloseSquareBracket:
+            // 84: <ArraySize2> -> ']'
+            p.Expand(84);
+            p.ProcessSemanticAction(SemanticAction::PushUnspecifiedDimensionNode);
+            p.Consume();
+            return true;
+
+        default:
+            if (p.RecoverFromError(NonTerminal::ArraySize2, ErrorID::InvalidArraySize))
+            {
+                continue;
+            }
+            return !p.IsStopped();
+        }
+    }
+}
+
+// <ArraySizeRepetition>
+static bool ParseArraySizeRepetition(RecursiveDescentParser& p)
+{
+    while (true)
+    {
+        switch (p.GetTokenType())
+        {
+        case TokenType::OpenSquareBracket:
+            // 85: <ArraySizeRepetition> -> <ArraySize> <ArraySizeRepetition>
+            p.Expand(85);
+            if (!ParseArraySize(p))
+            {
+                return false;
+            }
+            continue;
+
+        case TokenType::CloseParanthese:
+        case TokenType::SemiColon:
+        case TokenType::Comma:
+            // 86: <ArraySizeRepetition> ->
+            p.Expand(86);
+            p.ProcessSemanticAction(SemanticAction::ConstructDimensions);
+            return true;
+
+        default:
+            if (p.RecoverFromError(NonTerminal::ArraySizeRepetition, ErrorID::InvalidArraySize))
+            {
+                continue;
+            }
+            return !p.IsStopped();
+        }
+    }
+}
+
+// <Type>
+static bool ParseType(RecursiveDescentParser& p)
+{
+    while (true)
+    {
+        switch (p.GetTokenType())
+        {
+        case TokenType::IntegerKeyword:
+            // 87: <Type> -> 'integer'
+            p.Expand(87);
+            p.Consume();
+            p.ProcessSemanticAction(SemanticAction::PushType);
+            return true;
+
+        case TokenType::FloatKeyword:
+            // 88: <Type> -> 'float'
+            p.Expand(88);
+            p.Consume();
+            p.ProcessSemanticAction(SemanticAction::PushType);
+            return true;
+
+        case TokenType::ID:
+            // 89: <Type> -> 'id'
+            p.Expand(89);
+            p.Consume();
+            p.ProcessSemanticAction(SemanticAction::PushType);
+            return true;
+
+        default:
+            if (p.RecoverFromError(NonTerminal::Type, ErrorID::InvalidTypeSpecifier))
+            {
+                continue;
+            }
+            return !p.IsStopped();
+        }
+    }
+}
+
+// <ReturnType>
+static bool ParseReturnType(RecursiveDescentParser& p)
+{
+    while (true)
+    {
+        switch (p.GetTokenType())
+        {
+        case TokenType::ID:
+        case TokenType::IntegerKeyword:
+        case TokenType::FloatKeyword:
+            // 90: <ReturnType> -> <Type>
+            p.Expand(90);
+            return ParseType(p);
+
+        case TokenType::Void:
+            // 91: <ReturnType> -> 'void'
+            p.Expand(91);
+            p.Consume();
+            p.ProcessSemanticAction(SemanticAction::PushType);
+            return true;
+
+        default:
+            if (p.RecoverFromError(NonTerminal::ReturnType, ErrorID::InvalidTypeSpecifier))
+            {
+                continue;
+            }
+            return !p.IsStopped();
+        }
+    }
+}
+
+// <FParams>
+static bool ParseFParams(RecursiveDescentParser& p)
+{
+    while (true)
+    {
+        switch (p.GetTokenType())
+        {
+        case TokenType::ID:
+            // 92: <FParams> -> 'id' ':' <Type> <ArraySizeRepetition> <FParamsTail>
+            p.Expand(92);
+            p.Consume();
+            p.ProcessSemanticAction(SemanticAction::PushID);
+            if (!p.Match(TokenType::Colon))
+            {
+                return false;
+            }
+            if (!ParseType(p))
+            {
+                return false;
+            }
+            p.ProcessSemanticAction(SemanticAction::PushStopNode);
+            if (!ParseArraySizeRepetition(p))
+            {
+                return false;
+            }
+            p.ProcessSemanticAction(SemanticAction::ConstructFParam);
+            return ParseFParamsTail(p);
+
+        case TokenType::CloseParanthese:
+            // 93: <FParams> -> epsilon
+            p.Expand(93);
+            return true;
+
+        default:
+            if (p.RecoverFromError(NonTerminal::FParams, ErrorID::InvalidArgumentDefinition))
+            {
+                continue;
+            }
+            return !p.IsStopped();
+        }
+    }
+}
+
+// <AParams>
+static bool ParseAParams(RecursiveDescentParser& p)
+{
+    while (true)
+    {
+        switch (p.GetTokenType())
+        {
+        case TokenType::ID:
+        case TokenType::IntegerLiteral:
+        case TokenType::FloatLiteral:
+        case TokenType::Not:
+        case TokenType::Plus:
+        case TokenType::Minus:
+        case TokenType::OpenParanthese:
+            // 94: <AParams> -> <Expr> <AParamsTail>
+            p.Expand(94);
+            if (!ParseExpr(p))
+            {
+                return false;
+            }
+            return ParseAParamsTail(p);
+
+        case TokenType::CloseParanthese:
+            // 95: <AParams> -> epsilon
+            p.Expand(95);
+            return true;
+
+        default:
+            if (p.RecoverFromError(NonTerminal::AParams, ErrorID::InvalidArgumentProvided))
+            {
+                continue;
+            }
+            return !p.IsStopped();
+        }
+    }
+}
+
+// <FParamsTail>
+static bool ParseFParamsTail(RecursiveDescentParser& p)
+{
+    while (true)
+    {
+        switch (p.GetTokenType())
+        {
+        case TokenType::Comma:
+            // 96: <FParamsTail> -> ',' 'id' ':' <Type> <ArraySizeRepetition> <FParamsTail>
+            p.Expand(96);
+            p.Consume();
+            if (!p.Match(TokenType::ID))
+            {
+                return false;
+            }
+            p.ProcessSemanticAction(SemanticAction::PushID);
+            if (!p.Match(TokenType::Colon))
+            {
+                return false;
+            }
+            if (!ParseType(p))
+            {
+                return false;
+            }
+            p.ProcessSemanticAction(SemanticAction::PushStopNode);
+            if (!ParseArraySizeRepetition(p))
+            {
+                return false;
+            }
+            p.ProcessSemanticAction(SemanticAction::ConstructFParam);
+            continue;
+
+        case TokenType::CloseParanthese:
+            // 97: <FParamsTail> -> epsilon
+            p.Expand(97);
+            return true;
+
+        default:
+            if (p.RecoverFromError(NonTerminal::FParamsTail, ErrorID::InvalidTypeSpecifier))
+            {
+                continue;
+            }
+            return !p.IsStopped();
+        }
+    }
+}
+
+// <AParamsTail>
+static bool ParseAParamsTail(RecursiveDescentParser& p)
+{
+    while (true)
+    {
+        switch (p.GetTokenType())
+        {
+        case TokenType::Comma:
+            // 98: <AParamsTail> -> ',' <Expr> <AParamsTail>
+            p.Expand(98);
+            p.Consume();
+            if (!ParseExpr(p))
+            {
+                return false;
+            }
+            continue;
+
+        case TokenType::CloseParanthese:
+            // 99: <AParamsTail> -> epsilon
+            p.Expand(99);
+            return true;
+
+        default:
+            if (p.RecoverFromError(NonTerminal::AParamsTail, ErrorID::InvalidArgumentProvided))
+            {
+                continue;
+            }
+            return !p.IsStopped();
+        }
+    }
+}
+
+// <RelOp>
+static bool ParseRelOp(RecursiveDescentParser& p)
+{
+    while (true)
+    {
+        switch (p.GetTokenType())
+        {
+        case TokenType::Equal:
+            // 100: <RelOp> -> '=='
+            p.Expand(100);
+            p.Consume();
+            p.ProcessSemanticAction(SemanticAction::PushOp);
+            return true;
+
+        case TokenType::NotEqual:
+            // 101: <RelOp> -> '<>'
+            p.Expand(101);
+            p.Consume();
+            p.ProcessSemanticAction(SemanticAction::PushOp);
+            return true;
+
+        case TokenType::LessThan:
+            // 102: <RelOp> -> '<'
+            p.Expand(102);
+            p.Consume();
+            p.ProcessSemanticAction(SemanticAction::PushOp);
+            return true;
+
+        case TokenType::GreaterThan:
+            // 103: <RelOp> -> '>'
+            p.Expand(103);
+            p.Consume();
+            p.ProcessSemanticAction(SemanticAction::PushOp);
+            return true;
+
+        case TokenType::LessOrEqual:
+            // 104: <RelOp> -> '<='
+            p.Expand(104);
+            p.Consume();
+            p.ProcessSemanticAction(SemanticAction::PushOp);
+            return true;
+
+        case TokenType::GreaterOrEqual:
+            // 105: <RelOp> -> '>='
+            p.Expand(105);
+            p.Consume();
+            p.ProcessSemanticAction(SemanticAction::PushOp);
+            return true;
+
+        default:
+            if (p.RecoverFromError(NonTerminal::RelOp, ErrorID::InvalidOperator))
+            {
+                continue;
+            }
+            return !p.IsStopped();
+        }
+    }
+}
+
+// <AddOp>
+static bool ParseAddOp(RecursiveDescentParser& p)
+{
+    while (true)
+    {
+        switch (p.GetTokenType())
+        {
+        case TokenType::Plus:
+            // 106: <AddOp> -> '+'
+            p.Expand(106);
+            p.Consume();
+            p.ProcessSemanticAction(SemanticAction::PushOp);
+            return true;
+
+        case TokenType::Minus:
+            // 107: <AddOp> -> '-'
+            p.Expand(107);
+            p.Consume();
+            p.ProcessSemanticAction(SemanticAction::PushOp);
+            return true;
+
+        case TokenType::Or:
+            // 108: <AddOp> -> 'or'
+            p.Expand(108);
+            p.Consume();
+            p.ProcessSemanticAction(SemanticAction::PushOp);
+            return true;
+
+        default:
+            if (p.RecoverFromError(NonTerminal::AddOp, ErrorID::InvalidOperator))
+            {
+                continue;
+            }
+            return !p.IsStopped();
+        }
+    }
+}
+
+// <MultOp>
+static bool ParseMultOp(RecursiveDescentParser& p)
+{
+    while (true)
+    {
+        switch (p.GetTokenType())
+        {
+        case TokenType::Multiply:
+            // 109: <MultOp> -> '*'
+            p.Expand(109);
+            p.Consume();
+            p.ProcessSemanticAction(SemanticAction::PushOp);
+            return true;
+
+        case TokenType::Divide:
+            // 110: <MultOp> -> '/'
+            p.Expand(110);
+            p.Consume();
+            p.ProcessSemanticAction(SemanticAction::PushOp);
+            return true;
+
+        case TokenType::And:
+            // 111: <MultOp> -> 'and'
+            p.Expand(111);
+            p.Consume();
+            p.ProcessSemanticAction(SemanticAction::PushOp);
+            return true;
+
+        default:
+            if (p.RecoverFromError(NonTerminal::MultOp, ErrorID::InvalidOperator))
+            {
+                continue;
+            }
+            return !p.IsStopped();
+        }
+    }
+}
+
+Token Parser::ParseRecursiveDescent(Token currToken)
+{
+    RecursiveDescentParser parser(*this, currToken);
+    ParseStart(parser);
+    return parser.GetCurrToken();
+}
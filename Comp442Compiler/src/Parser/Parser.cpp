@@ -2,6 +2,18 @@
 #include "../Lexer/Lexer.h"
 #include "../Core/Util.h"
 #include "../Core/MessagePrinter.h"
+#include "../Core/ErrorLimit.h"
+#include "../Core/JsonLinesSink.h"
+#include "../Core/OutputFiles.h"
+#include "../Core/DiagnosticsContext.h"
+#include "../Core/WorkerThreads.h"
+#include "ASTSerializer.h"
+
+#include <sstream>
+#include <string_view>
+#include <thread>
+#include <atomic>
+#include <algorithm>
 
 std::ostream& operator<<(std::ostream& stream, NonTerminal n)
 {
@@ -325,15 +337,7 @@ std::ostream& operator<<(std::ostream& stream, const StackableItem& item)
 // SetManager /////////////////////////////////////////////////////////////////
 bool SetManager::IsInFirstSet(NonTerminal n, TokenType t)
 {
-    auto& set = GetInstance().m_firstSets[n];
-    for (TokenType curr : set)
-    {
-        if (curr == t)
-        {
-            return true;
-        }
-    }
-    return false;
+    return GetInstance().m_firstSetBitmaps[(size_t)n].test((size_t)t);
 }
 
 bool SetManager::IsInFirstSet(const StackableItem& n, TokenType t) 
@@ -353,15 +357,7 @@ bool SetManager::IsInFirstSet(TokenType n, TokenType t) { return n == t; }
 
 bool SetManager::IsInFollowSet(NonTerminal n, TokenType t)
 {
-    auto& set = GetInstance().m_followSets[n];
-    for (TokenType curr : set)
-    {
-        if (curr == t)
-        {
-            return true;
-        }
-    }
-    return false;
+    return GetInstance().m_followSetBitmaps[(size_t)n].test((size_t)t);
 }
 
 bool SetManager::IsInFollowSet(const StackableItem& n, TokenType t)
@@ -373,6 +369,19 @@ bool SetManager::IsInFollowSet(const StackableItem& n, TokenType t)
     return false;
 }
 
+bool SetManager::IsInSyncSet(const StackableItem& n, TokenType t)
+{
+    if (n.GetType() == StackableType::NonTerminalItem)
+    {
+        return GetInstance().m_syncSetBitmaps[(size_t)n.GetNonTerminal()].test((size_t)t);
+    }
+    else if (n.GetType() == StackableType::TerminalItem)
+    {
+        return n.GetTerminal() == t || t == TokenType::EndOfFile;
+    }
+    return t == TokenType::EndOfFile;
+}
+
 SetManager::SetManager() { InitializeSets(); }
 
 SetManager& SetManager::GetInstance()
@@ -385,6 +394,7 @@ void SetManager::InitializeSets()
 {
     InitializeFirstSets();
     InitializeFollowSets();
+    InitializeSetBitmaps();
 }
 
 void SetManager::InitializeFirstSets()
@@ -665,6 +675,39 @@ void SetManager::InitializeFollowSets()
         TokenType::Plus, TokenType::Minus};
 }
 
+void SetManager::InitializeSetBitmaps()
+{
+    m_firstSetBitmaps.resize(s_numNonTerminals);
+    m_followSetBitmaps.resize(s_numNonTerminals);
+    m_syncSetBitmaps.resize(s_numNonTerminals);
+
+    for (auto& pair : m_firstSets)
+    {
+        for (TokenType t : pair.second)
+        {
+            m_firstSetBitmaps[(size_t)pair.first].set((size_t)t);
+        }
+    }
+
+    for (auto& pair : m_followSets)
+    {
+        for (TokenType t : pair.second)
+        {
+            m_followSetBitmaps[(size_t)pair.first].set((size_t)t);
+        }
+    }
+
+    for (size_t n = 0; n < s_numNonTerminals; n++)
+    {
+        m_syncSetBitmaps[n] = m_firstSetBitmaps[n];
+        if (m_firstSetBitmaps[n].test((size_t)TokenType::None))
+        {
+            m_syncSetBitmaps[n] |= m_followSetBitmaps[n];
+        }
+        m_syncSetBitmaps[n].set((size_t)TokenType::EndOfFile);
+    }
+}
+
 
 // Rule //////////////////////////////////////////////
 
@@ -685,10 +728,11 @@ ParsingErrorRule::ParsingErrorRule(ErrorID id)
 
 void ParsingErrorRule::Apply(const StackableItem& top, const Token& currToken) const
 {
-    Parser& p = Parser::GetInstance();
-    p.m_errors.emplace_front(currToken, top, m_errorID);
+    Parser::GetInstance().AddError(currToken, top, m_errorID);
 }
 
+ErrorID ParsingErrorRule::GetErrorID() const { return m_errorID; }
+
 // RuleManager /////////////////////////////////////////////////////////////////////////
 const Rule* RuleManager::GetRule(RuleID id)
 {
@@ -1214,184 +1258,652 @@ RuleID ParsingTableEntry::GetRule(const Token& t) const
     return it->second;
 }
 
-// ErrorData //////////////////////////////////////////////////////////
-ParsingErrorData::ParsingErrorData(const Token& token, const StackableItem& top, ErrorID id) 
-    : m_token(token), m_top(top), m_id(id) { }
+const std::unordered_map<TokenType, RuleID>& ParsingTableEntry::GetEntries() const
+{
+    return m_entries;
+}
 
-const StackableItem& ParsingErrorData::GetTop() const { return m_top; }
-const Token& ParsingErrorData::GetToken() const { return m_token; }
-ErrorID ParsingErrorData::GetID() const { return m_id; }
+// ParsingTableManager ///////////////////////////////////////////////////////////////////
+RuleID ParsingTableManager::GetRule(NonTerminal n, const Token& t)
+{
+    ParsingTableManager& manager = GetInstance();
+    auto it = manager.m_parsingTable.find(n);
+    ASSERT(it != manager.m_parsingTable.end());
+    return it->second->GetRule(t);
+}
 
-std::ostream& operator<<(std::ostream& stream, const ParsingErrorData& data)
+const ParsingTableEntry* ParsingTableManager::GetEntry(NonTerminal n)
 {
-    const Token& token = data.GetToken();
-    stream << "Unexpected token \"" << token.GetLexeme() << "\". Expected " 
-        << data.GetTop() << " at line " << token.GetLine() << ": \"" 
-        << token.GetStrOfLine() << "\""; 
-    return stream;
+    ParsingTableManager& manager = GetInstance();
+    auto it = manager.m_parsingTable.find(n);
+    return it == manager.m_parsingTable.end() ? nullptr : it->second;
 }
 
-// ParsingErrorManager ////////////////////////////////////////////////////////
+ParsingTableManager::ParsingTableManager() { InitializeParsingTable(); }
 
-void ParsingErrorManager::WriteErrorToFile(std::ofstream& file, const ParsingErrorData& error)
+ParsingTableManager::~ParsingTableManager()
 {
-    switch(error.GetID())
+    for (auto& pair : m_parsingTable)
     {
-    case ErrorID::Default:
-        DefaultError(file, error);
-        break;
-
-    case ErrorID::InvalidTypeSpecifier:
-        InvalidTypeSpecifierError(file, error);
-        break;
-    
-    case ErrorID::InvalidFunctionHead:
-        InvalidFunctionHeadError(file, error);
-        break;
-
-    case ErrorID::InvalidArgumentDefinition:
-        InvalidArgumentDefinitionError(file, error);
-        break;
+        delete pair.second;
+    }
+}
 
-    case ErrorID::InvalidArgumentProvided:
-        InvalidArgumentProvidedError(file, error);
-        break;
+ParsingTableManager& ParsingTableManager::GetInstance()
+{
+    static ParsingTableManager manager;
+    return manager;
+}
 
-    case ErrorID::InvalidArithExpr:
-        InvalidArithExprError(file, error);
-        break;
+void ParsingTableManager::InitializeParsingTable()
+{
+    m_parsingTable[NonTerminal::Start] = new ParsingTableEntry({{TokenType::EndOfFile, 0}, 
+        {TokenType::Function, 0}, {TokenType::Class, 0}});
 
-    case ErrorID::ErroneousTokenAtFuncDef:
-        ErroneousTokenAtFuncDefError(file, error);
-        break;
+    m_parsingTable[NonTerminal::ClassDeclOrFuncDefRepetition] 
+        = new ParsingTableEntry({{TokenType::EndOfFile, 2}, {TokenType::Function, 1}, 
+        {TokenType::Class, 1}});
 
-    case ErrorID::InvalidStatement:
-        InvalidStatementError(file, error);
-        break;
+    m_parsingTable[NonTerminal::ClassDeclOrFuncDef] 
+        = new ParsingTableEntry({{TokenType::Function, 4}, {TokenType::Class, 3}});
+    
+    m_parsingTable[NonTerminal::ClassDecl] = new ParsingTableEntry({{TokenType::Class, 5}});
+    
+    m_parsingTable[NonTerminal::ClassDeclMembDeclRepetition] 
+        = new ParsingTableEntry({{TokenType::CloseCurlyBracket, 7}, 
+        {TokenType::Constructor, 6}, {TokenType::Function, 6}, {TokenType::Attribute, 6}, 
+        {TokenType::Private, 6}, {TokenType::Public, 6}});
 
-    case ErrorID::InvalidArraySize:
-        InvalidArraySizeError(file, error);
-        break;
+    m_parsingTable[NonTerminal::ClassDeclInheritance] 
+        = new ParsingTableEntry({{TokenType::OpenCurlyBracket, 9}, {TokenType::IsA, 8}});
+           
+    m_parsingTable[NonTerminal::ClassDeclInheritanceTail] 
+        = new ParsingTableEntry({{TokenType::Comma, 10}, {TokenType::OpenCurlyBracket, 11}});
 
-    case ErrorID::InvalidRelExpr:
-        InvalidRelExprError(file, error);
-        break;
+    m_parsingTable[NonTerminal::Visibility] 
+        = new ParsingTableEntry({{TokenType::Constructor, 14}, {TokenType::Function, 14}, 
+        {TokenType::Attribute, 14}, {TokenType::Private, 13}, {TokenType::Public, 12}});
 
-    case ErrorID::InvalidOperator:
-        InvalidOperatorError(file, error);
-        break;
+    m_parsingTable[NonTerminal::MemberDecl] 
+        = new ParsingTableEntry({{TokenType::Constructor, 15}, 
+        {TokenType::Function, 15}, {TokenType::Attribute, 16}});
 
-    default:
-        DEBUG_BREAK();
-        break;
-    }
-    file << "\n";
-}
+    m_parsingTable[NonTerminal::MemberFuncDecl] 
+        = new ParsingTableEntry({{TokenType::Constructor, 18}, {TokenType::Function, 17}});
 
-ParsingErrorManager::ParsingErrorManager() { }
-ParsingErrorManager::~ParsingErrorManager() { }
+    m_parsingTable[NonTerminal::MemberVarDecl] 
+        = new ParsingTableEntry({{TokenType::Attribute, 19}});
 
-void ParsingErrorManager::DefaultError(std::ofstream& file, const ParsingErrorData& error)
-{
-    const Token& token = error.GetToken();
-    std::stringstream ss;
-    ss << "Unexpected token \"" << token.GetLexeme() << "\". Expected " 
-        << error.GetTop() << " at line " << token.GetLine() << ": \"" 
-        << token.GetStrOfLine() << "\""; 
+    m_parsingTable[NonTerminal::FuncDef] 
+        = new ParsingTableEntry({{TokenType::Function, 20}});
 
-    file << ss.str();
-    MessagePrinter::AddMessage(token.GetLine(), ss.str());
-}
+    m_parsingTable[NonTerminal::FuncHead] 
+        = new ParsingTableEntry({{TokenType::Function, 21}, {TokenType::None, 113}});
 
-void ParsingErrorManager::InvalidTypeSpecifierError(std::ofstream& file, 
-    const ParsingErrorData& error)
-{
-    const Token& token = error.GetToken();
-    std::stringstream ss;
-    ss << "Invalid type specifier \"" << token.GetLexeme() << "\" found at line " 
-        << token.GetLine() << ": \"" << token.GetStrOfLine() << "\"" ; 
+    m_parsingTable[NonTerminal::FuncHead2] 
+        = new ParsingTableEntry({{TokenType::OpenParanthese, 23}, {TokenType::Scope, 22}, 
+        {TokenType::None, 113}, {TokenType::None, 113}});
 
-    file << ss.str();
-    MessagePrinter::AddMessage(token.GetLine(), ss.str());
-}
+    m_parsingTable[NonTerminal::FuncHead3] 
+        = new ParsingTableEntry({{TokenType::ID, 24}, {TokenType::Constructor, 25}, 
+        {TokenType::None, 113}});
 
-void ParsingErrorManager::InvalidFunctionHeadError(std::ofstream& file, 
-    const ParsingErrorData& error)
-{
-    const Token& token = error.GetToken();
-    std::stringstream ss;
-    ss << "Invalid function head found at line " << token.GetLine() 
-        << ": \"" << token.GetStrOfLine() << "\". Unexpected token \"" 
-        << token.GetLexeme() << "\" encountered"; 
+    m_parsingTable[NonTerminal::FuncBody] 
+        = new ParsingTableEntry({{TokenType::OpenCurlyBracket, 26}, {TokenType::None, 116}});
 
-    file << ss.str();
-    MessagePrinter::AddMessage(token.GetLine(), ss.str());
-}
+    m_parsingTable[NonTerminal::LocalVarDeclOrStmtRepetition] 
+        = new ParsingTableEntry({{TokenType::ID, 27}, {TokenType::CloseCurlyBracket, 28}, 
+        {TokenType::Return, 27}, {TokenType::Write, 27}, {TokenType::Read, 27}, 
+        {TokenType::While, 27}, {TokenType::If, 27}, {TokenType::LocalVar, 27}, 
+        {TokenType::None, 117}});
 
-void ParsingErrorManager::InvalidArgumentDefinitionError(std::ofstream& file, 
-        const ParsingErrorData& error)
-{
-    const Token& token = error.GetToken();
-    std::stringstream ss;
-    ss << "Invalid argument definition encountered at line " << token.GetLine() 
-        << ": \"" << token.GetStrOfLine() << "\". Unexpected token \"" 
-        << token.GetLexeme() << "\" encountered"; 
+    m_parsingTable[NonTerminal::LocalVarDeclOrStmt] 
+        = new ParsingTableEntry({{TokenType::ID, 30}, {TokenType::Return, 30}, 
+        {TokenType::Write, 30}, {TokenType::Read, 30}, {TokenType::While, 30}, 
+        {TokenType::If, 30}, {TokenType::LocalVar, 29}});
 
-    file << ss.str();
-    MessagePrinter::AddMessage(token.GetLine(), ss.str());
-}
+    m_parsingTable[NonTerminal::LocalVarDecl] 
+        = new ParsingTableEntry({{TokenType::LocalVar, 31}});
 
-void ParsingErrorManager::InvalidArgumentProvidedError(std::ofstream& file, 
-    const ParsingErrorData& error)
-{
-    const Token& token = error.GetToken();
-    std::stringstream ss;
-    ss << "Invalid argument provided at line " << token.GetLine() 
-        << ": \"" << token.GetStrOfLine() << "\". Unexpected token \"" 
-        << token.GetLexeme() << "\" encountered";
+    m_parsingTable[NonTerminal::LocalVarDecl2] 
+        = new ParsingTableEntry({{TokenType::OpenSquareBracket, 32}, 
+        {TokenType::OpenParanthese, 33}, {TokenType::SemiColon, 32}});
 
-    file << ss.str();
-    MessagePrinter::AddMessage(token.GetLine(), ss.str());
-}
+    m_parsingTable[NonTerminal::Statement] 
+        = new ParsingTableEntry({{TokenType::ID, 34}, {TokenType::Return, 39}, 
+        {TokenType::Write, 38}, {TokenType::Read, 37}, {TokenType::While, 36}, 
+        {TokenType::If, 35}});
 
-void ParsingErrorManager::InvalidArithExprError(std::ofstream& file, 
-        const ParsingErrorData& error)
-{
-    const Token& token = error.GetToken();
-    std::stringstream ss;
-    ss << "Invalid arithmetic expresion provided at line " << token.GetLine() 
-        << ": \"" << token.GetStrOfLine() << "\". Unexpected token \"" 
-        << token.GetLexeme() << "\" encountered";
+    m_parsingTable[NonTerminal::SimpleStatement] 
+        = new ParsingTableEntry({{TokenType::ID, 40}, {TokenType::None, 117}});
 
-    file << ss.str();
-    MessagePrinter::AddMessage(token.GetLine(), ss.str());
-}
+    m_parsingTable[NonTerminal::SimpleStatement2] 
+        = new ParsingTableEntry({{TokenType::OpenSquareBracket, 41}, 
+        {TokenType::Dot, 41}, {TokenType::OpenParanthese, 42}, {TokenType::Assign, 41}});
 
-void ParsingErrorManager::ErroneousTokenAtFuncDefError(std::ofstream& file, 
-    const ParsingErrorData& error)
-{
-    const Token& token = error.GetToken();
-    std::stringstream ss;
-    ss << "Erroneous token found at line " << token.GetLine() 
-        << ": \"" << token.GetStrOfLine() << "\". Expected a function definition but found: \""
-        << token.GetLexeme() << "\""; 
+    m_parsingTable[NonTerminal::SimpleStatement3] 
+        = new ParsingTableEntry({{TokenType::Dot, 43}, {TokenType::Assign, 44}});
 
-    file << ss.str();
-    MessagePrinter::AddMessage(token.GetLine(), ss.str());
-}
+    m_parsingTable[NonTerminal::SimpleStatement4] 
+        = new ParsingTableEntry({{TokenType::Dot, 45}, {TokenType::SemiColon, 46}});
 
-void ParsingErrorManager::InvalidStatementError(std::ofstream& file, 
-        const ParsingErrorData& error)
-{
-    const Token& token = error.GetToken();
-    std::stringstream ss;
-    ss << "Invalid statement found at line " << token.GetLine() 
-        << ": \"" << token.GetStrOfLine() << "\". Unexpected token \"" 
-        << token.GetLexeme() << "\" encountered";
+    m_parsingTable[NonTerminal::StatementRepetition] 
+        = new ParsingTableEntry({{TokenType::ID, 47}, {TokenType::CloseCurlyBracket, 48}, 
+        {TokenType::Return, 47}, {TokenType::Write, 47}, {TokenType::Read, 47}, 
+        {TokenType::While, 47}, {TokenType::If, 47}, {TokenType::None, 117}});
 
-    file << ss.str();
-    MessagePrinter::AddMessage(token.GetLine(), ss.str());
-}
+    m_parsingTable[NonTerminal::StatBlock] 
+        = new ParsingTableEntry({{TokenType::ID, 50}, {TokenType::OpenCurlyBracket, 49}, 
+        {TokenType::SemiColon, 51}, {TokenType::Return, 50}, {TokenType::Write, 50}, 
+        {TokenType::Read, 50}, {TokenType::While, 50}, {TokenType::Else, 51}, 
+        {TokenType::If, 50}});
+
+    m_parsingTable[NonTerminal::Expr] 
+        = new ParsingTableEntry({{TokenType::Minus, 52}, {TokenType::Plus, 52}, 
+        {TokenType::ID, 52}, {TokenType::IntegerLiteral, 52}, {TokenType::OpenParanthese, 52}, 
+        {TokenType::Not, 52}, {TokenType::FloatLiteral, 52}});
+
+    m_parsingTable[NonTerminal::Expr2] 
+        = new ParsingTableEntry({{TokenType::GreaterOrEqual, 53}, {TokenType::LessOrEqual, 53}, 
+        {TokenType::GreaterThan, 53}, {TokenType::LessThan, 53}, {TokenType::NotEqual, 53}, 
+        {TokenType::Equal, 53}, {TokenType::Comma, 54}, {TokenType::CloseParanthese, 54}, 
+        {TokenType::SemiColon, 54}, {TokenType::None, 121}});
+
+    m_parsingTable[NonTerminal::RelExpr] 
+        = new ParsingTableEntry({{TokenType::Minus, 55}, {TokenType::Plus, 55}, 
+        {TokenType::ID, 55}, {TokenType::IntegerLiteral, 55}, {TokenType::OpenParanthese, 55}, 
+        {TokenType::Not, 55}, {TokenType::FloatLiteral, 55}, {TokenType::None, 120}});
+
+    m_parsingTable[NonTerminal::ArithExpr] 
+        = new ParsingTableEntry({{TokenType::Minus, 56}, {TokenType::Plus, 56}, 
+        {TokenType::ID, 56}, {TokenType::IntegerLiteral, 56}, {TokenType::OpenParanthese, 56}, 
+        {TokenType::Not, 56}, {TokenType::FloatLiteral, 56}, {TokenType::None, 115}});
+
+    m_parsingTable[NonTerminal::ArithExpr2] 
+        = new ParsingTableEntry({{TokenType::Or, 57}, {TokenType::Minus, 57}, 
+        {TokenType::Plus, 57}, {TokenType::GreaterOrEqual, 58}, {TokenType::LessOrEqual, 58}, 
+        {TokenType::GreaterThan, 58}, {TokenType::LessThan, 58}, {TokenType::NotEqual, 58}, 
+        {TokenType::Equal, 58}, {TokenType::Comma, 58}, {TokenType::CloseSquareBracket, 58}, 
+        {TokenType::CloseParanthese, 58}, {TokenType::SemiColon, 58}, 
+        {TokenType::None, 121}});   
+
+    m_parsingTable[NonTerminal::Sign] 
+        = new ParsingTableEntry({{TokenType::Minus, 60}, {TokenType::Plus, 59}});
+
+    m_parsingTable[NonTerminal::Term] 
+        = new ParsingTableEntry({{TokenType::Minus, 61}, {TokenType::Plus, 61}, 
+        {TokenType::ID, 61}, {TokenType::IntegerLiteral, 61}, {TokenType::OpenParanthese, 61}, 
+        {TokenType::Not, 61}, {TokenType::FloatLiteral, 61}}); 
+
+    m_parsingTable[NonTerminal::Term2] 
+        = new ParsingTableEntry({{TokenType::And, 62}, {TokenType::Divide, 62}, 
+        {TokenType::Multiply, 62}, {TokenType::Or, 63}, {TokenType::Minus, 63}, 
+        {TokenType::Plus, 63}, {TokenType::GreaterOrEqual, 63}, {TokenType::LessOrEqual, 63}, 
+        {TokenType::GreaterThan, 63}, {TokenType::LessThan, 63}, {TokenType::NotEqual, 63}, 
+        {TokenType::Equal, 63}, {TokenType::Comma, 63}, {TokenType::CloseSquareBracket, 63}, 
+        {TokenType::CloseParanthese, 63}, {TokenType::SemiColon, 63}, 
+        {TokenType::None, 121}});
+
+    m_parsingTable[NonTerminal::Factor] 
+        = new ParsingTableEntry({{TokenType::Minus, 69}, {TokenType::Plus, 69}, 
+        {TokenType::ID, 64}, {TokenType::IntegerLiteral, 65}, {TokenType::OpenParanthese, 67}, 
+        {TokenType::Not, 68}, {TokenType::FloatLiteral, 66}});
+
+    m_parsingTable[NonTerminal::VarOrFuncCall] 
+        = new ParsingTableEntry({{TokenType::ID, 70}});
+
+    m_parsingTable[NonTerminal::VarOrFuncCall2] 
+        = new ParsingTableEntry({{TokenType::And, 71}, {TokenType::Divide, 71}, 
+        {TokenType::Multiply, 71}, {TokenType::Or, 71}, {TokenType::Minus, 71}, 
+        {TokenType::Plus, 71}, {TokenType::GreaterOrEqual, 71}, {TokenType::LessOrEqual, 71}, 
+        {TokenType::GreaterThan, 71}, {TokenType::LessThan, 71}, {TokenType::NotEqual, 71}, 
+        {TokenType::Equal, 71}, {TokenType::Comma, 71}, {TokenType::CloseSquareBracket, 71}, 
+        {TokenType::OpenSquareBracket, 71}, {TokenType::Dot, 71}, 
+        {TokenType::CloseParanthese, 71}, {TokenType::OpenParanthese, 72}, 
+        {TokenType::SemiColon, 71}});
+
+    m_parsingTable[NonTerminal::VarOrFuncCall3] 
+        = new ParsingTableEntry({{TokenType::And, 74}, {TokenType::Divide, 74}, 
+        {TokenType::Multiply, 74}, {TokenType::Or, 74}, {TokenType::Minus, 74}, 
+        {TokenType::Plus, 74}, {TokenType::GreaterOrEqual, 74}, {TokenType::LessOrEqual, 74}, 
+        {TokenType::GreaterThan, 74}, {TokenType::LessThan, 74}, {TokenType::NotEqual, 74}, 
+        {TokenType::Equal, 74}, {TokenType::Comma, 74}, {TokenType::CloseSquareBracket, 74}, 
+        {TokenType::Dot, 73}, {TokenType::CloseParanthese, 74}, {TokenType::SemiColon, 74}});
+
+    m_parsingTable[NonTerminal::Variable] 
+        = new ParsingTableEntry({{TokenType::ID, 75}});
+
+    m_parsingTable[NonTerminal::Variable2] 
+        = new ParsingTableEntry({{TokenType::OpenSquareBracket, 76}, {TokenType::Dot, 76}, 
+        {TokenType::CloseParanthese, 76}, {TokenType::OpenParanthese, 77}});
+
+    m_parsingTable[NonTerminal::Variable3] 
+        = new ParsingTableEntry({{TokenType::Dot, 78}, {TokenType::CloseParanthese, 79}});
+
+    m_parsingTable[NonTerminal::Indice] 
+        = new ParsingTableEntry({{TokenType::And, 81}, {TokenType::Divide, 81}, 
+        {TokenType::Multiply, 81}, {TokenType::Or, 81}, {TokenType::Minus, 81}, 
+        {TokenType::Plus, 81}, {TokenType::GreaterOrEqual, 81}, {TokenType::LessOrEqual, 81}, 
+        {TokenType::GreaterThan, 81}, {TokenType::LessThan, 81}, {TokenType::NotEqual, 81}, 
+        {TokenType::Equal, 81}, {TokenType::Comma, 81}, {TokenType::CloseSquareBracket, 81}, 
+        {TokenType::OpenSquareBracket, 80}, {TokenType::Dot, 81}, 
+        {TokenType::CloseParanthese, 81}, {TokenType::Assign, 81}, 
+        {TokenType::SemiColon, 81}});
+
+    m_parsingTable[NonTerminal::ArraySize] 
+        = new ParsingTableEntry({{TokenType::OpenSquareBracket, 82}, {TokenType::None, 119}});
+
+    m_parsingTable[NonTerminal::ArraySize2] 
+        = new ParsingTableEntry({{TokenType::CloseSquareBracket, 84}, 
+        {TokenType::IntegerLiteral, 83}, {TokenType::None, 119}});
+
+    m_parsingTable[NonTerminal::ArraySizeRepetition] 
+        = new ParsingTableEntry({{TokenType::Comma, 86}, {TokenType::OpenSquareBracket, 85}, 
+        {TokenType::CloseParanthese, 86}, {TokenType::SemiColon, 86}, {TokenType::None, 119}});
+
+    m_parsingTable[NonTerminal::Type] 
+        = new ParsingTableEntry({{TokenType::ID, 89}, {TokenType::FloatKeyword, 88}, 
+        {TokenType::IntegerKeyword, 87}, {TokenType::None, 112}});
+
+    m_parsingTable[NonTerminal::ReturnType] 
+        = new ParsingTableEntry({{TokenType::ID, 90}, {TokenType::Void, 91}, 
+        {TokenType::FloatKeyword, 90}, {TokenType::IntegerKeyword, 90}, 
+        {TokenType::None, 112}});
+
+    m_parsingTable[NonTerminal::FParams] 
+        = new ParsingTableEntry({{TokenType::ID, 92}, {TokenType::CloseParanthese, 93}, 
+        {TokenType::None, 114}});
+
+    m_parsingTable[NonTerminal::AParams] 
+        = new ParsingTableEntry({{TokenType::Minus, 94}, {TokenType::Plus, 94}, 
+        {TokenType::ID, 94}, {TokenType::IntegerLiteral, 94}, {TokenType::CloseParanthese, 95}, 
+        {TokenType::OpenParanthese, 94}, {TokenType::Not, 94}, {TokenType::FloatLiteral, 94}, 
+        {TokenType::None, 118}});
+
+    m_parsingTable[NonTerminal::FParamsTail] 
+        = new ParsingTableEntry({{TokenType::Comma, 96}, {TokenType::CloseParanthese, 97}, 
+        {TokenType::None, 112}});
+    
+    m_parsingTable[NonTerminal::AParamsTail] 
+        = new ParsingTableEntry({{TokenType::Comma, 98}, {TokenType::CloseParanthese, 99}, 
+        {TokenType::None, 118}});
+
+    m_parsingTable[NonTerminal::RelOp] 
+        = new ParsingTableEntry({{TokenType::GreaterOrEqual, 105}, 
+        {TokenType::LessOrEqual, 104}, {TokenType::GreaterThan, 103},
+        {TokenType::LessThan, 102}, {TokenType::NotEqual, 101}, {TokenType::Equal, 100}, 
+        {TokenType::None, 121}});
+
+    m_parsingTable[NonTerminal::AddOp] 
+        = new ParsingTableEntry({{TokenType::Or, 108}, {TokenType::Minus, 107}, 
+        {TokenType::Plus, 106}, {TokenType::None, 121}});
+
+    m_parsingTable[NonTerminal::MultOp] 
+        = new ParsingTableEntry({{TokenType::And, 111}, {TokenType::Divide, 110}, 
+        {TokenType::Multiply, 109}, {TokenType::None, 121}});
+}
+
+// ErrorData //////////////////////////////////////////////////////////
+ParsingErrorData::ParsingErrorData(const Token& token, const StackableItem& top, ErrorID id) 
+    : m_token(token), m_top(top), m_id(id) { }
+
+const StackableItem& ParsingErrorData::GetTop() const { return m_top; }
+const Token& ParsingErrorData::GetToken() const { return m_token; }
+ErrorID ParsingErrorData::GetID() const { return m_id; }
+
+std::ostream& operator<<(std::ostream& stream, const ParsingErrorData& data)
+{
+    const Token& token = data.GetToken();
+    stream << "Unexpected token \"" << token.GetLexeme() << "\". Expected " 
+        << data.GetTop() << " at line " << token.GetLine() << ": \"" 
+        << token.GetStrOfLine() << "\""; 
+    return stream;
+}
+
+std::string ErrorIDToStr(ErrorID id)
+{
+    switch (id)
+    {
+    case ErrorID::Default:
+        return "Default";
+
+    case ErrorID::InvalidTypeSpecifier:
+        return "InvalidTypeSpecifier";
+
+    case ErrorID::InvalidFunctionHead:
+        return "InvalidFunctionHead";
+
+    case ErrorID::InvalidArgumentDefinition:
+        return "InvalidArgumentDefinition";
+
+    case ErrorID::InvalidArgumentProvided:
+        return "InvalidArgumentProvided";
+
+    case ErrorID::InvalidArithExpr:
+        return "InvalidArithExpr";
+
+    case ErrorID::ErroneousTokenAtFuncDef:
+        return "ErroneousTokenAtFuncDef";
+
+    case ErrorID::InvalidStatement:
+        return "InvalidStatement";
+
+    case ErrorID::InvalidArraySize:
+        return "InvalidArraySize";
+
+    case ErrorID::InvalidRelExpr:
+        return "InvalidRelExpr";
+
+    case ErrorID::InvalidOperator:
+        return "InvalidOperator";
+
+    default:
+        DEBUG_BREAK();
+        return "";
+    }
+}
+
+std::string SemanticActionToStr(SemanticAction action)
+{
+    switch (action)
+    {
+    case SemanticAction::PushStopNode:
+        return "PushStopNode";
+
+    case SemanticAction::PushUnspecifiedDimensionNode:
+        return "PushUnspecifiedDimensionNode";
+
+    case SemanticAction::ConstructIntLiteral:
+        return "ConstructIntLiteral";
+
+    case SemanticAction::ConstructFloatLiteral:
+        return "ConstructFloatLiteral";
+
+    case SemanticAction::ConstructVisibility:
+        return "ConstructVisibility";
+
+    case SemanticAction::ConstructDefaultVisibility:
+        return "ConstructDefaultVisibility";
+
+    case SemanticAction::ConstructAssignStat:
+        return "ConstructAssignStat";
+
+    case SemanticAction::PushID:
+        return "PushID";
+
+    case SemanticAction::PushSign:
+        return "PushSign";
+
+    case SemanticAction::PushNot:
+        return "PushNot";
+
+    case SemanticAction::PushOp:
+        return "PushOp";
+
+    case SemanticAction::PushType:
+        return "PushType";
+
+    case SemanticAction::PushFreeFuncMarker:
+        return "PushFreeFuncMarker";
+
+    case SemanticAction::PushMemFuncMarker:
+        return "PushMemFuncMarker";
+
+    case SemanticAction::PushConstructorMarker:
+        return "PushConstructorMarker";
+
+    case SemanticAction::EncounteredDot:
+        return "EncounteredDot";
+
+    case SemanticAction::ConstructExpr:
+        return "ConstructExpr";
+
+    case SemanticAction::ConstructModifiedExpr:
+        return "ConstructModifiedExpr";
+
+    case SemanticAction::ConstructSign:
+        return "ConstructSign";
+
+    case SemanticAction::ConstructAddOp:
+        return "ConstructAddOp";
+
+    case SemanticAction::ConstructMultOp:
+        return "ConstructMultOp";
+
+    case SemanticAction::ConstructRelOp:
+        return "ConstructRelOp";
+
+    case SemanticAction::ConstructDimensions:
+        return "ConstructDimensions";
+
+    case SemanticAction::ConstructVariable:
+        return "ConstructVariable";
+
+    case SemanticAction::ConstructVarDecl:
+        return "ConstructVarDecl";
+
+    case SemanticAction::ConstructStatBlock:
+        return "ConstructStatBlock";
+
+    case SemanticAction::ConstructFParam:
+        return "ConstructFParam";
+
+    case SemanticAction::ConstructFParams:
+        return "ConstructFParams";
+
+    case SemanticAction::ConstructAParams:
+        return "ConstructAParams";
+
+    case SemanticAction::ConstructFuncDef:
+        return "ConstructFuncDef";
+
+    case SemanticAction::ConstructFuncCall:
+        return "ConstructFuncCall";
+
+    case SemanticAction::ConstructIfStat:
+        return "ConstructIfStat";
+
+    case SemanticAction::ConstructWhileStat:
+        return "ConstructWhileStat";
+
+    case SemanticAction::ConstructReadStat:
+        return "ConstructReadStat";
+
+    case SemanticAction::ConstructWriteStat:
+        return "ConstructWriteStat";
+
+    case SemanticAction::ConstructReturnStat:
+        return "ConstructReturnStat";
+
+    case SemanticAction::ConstructDotNode:
+        return "ConstructDotNode";
+
+    case SemanticAction::ConstructEncounteredDots:
+        return "ConstructEncounteredDots";
+
+    case SemanticAction::ConstructClass:
+        return "ConstructClass";
+
+    case SemanticAction::ConstructMemVar:
+        return "ConstructMemVar";
+
+    case SemanticAction::ConstructMemFuncDecl:
+        return "ConstructMemFuncDecl";
+
+    case SemanticAction::ConstructConstructorDecl:
+        return "ConstructConstructorDecl";
+
+    case SemanticAction::ConstructInheritanceList:
+        return "ConstructInheritanceList";
+
+    default:
+        DEBUG_BREAK();
+        return "";
+    }
+}
+
+// ParsingErrorManager ////////////////////////////////////////////////////////
+
+void ParsingErrorManager::WriteErrorToFile(std::ofstream& file, const ParsingErrorData& error)
+{
+    switch(error.GetID())
+    {
+    case ErrorID::Default:
+        DefaultError(file, error);
+        break;
+
+    case ErrorID::InvalidTypeSpecifier:
+        InvalidTypeSpecifierError(file, error);
+        break;
+    
+    case ErrorID::InvalidFunctionHead:
+        InvalidFunctionHeadError(file, error);
+        break;
+
+    case ErrorID::InvalidArgumentDefinition:
+        InvalidArgumentDefinitionError(file, error);
+        break;
+
+    case ErrorID::InvalidArgumentProvided:
+        InvalidArgumentProvidedError(file, error);
+        break;
+
+    case ErrorID::InvalidArithExpr:
+        InvalidArithExprError(file, error);
+        break;
+
+    case ErrorID::ErroneousTokenAtFuncDef:
+        ErroneousTokenAtFuncDefError(file, error);
+        break;
+
+    case ErrorID::InvalidStatement:
+        InvalidStatementError(file, error);
+        break;
+
+    case ErrorID::InvalidArraySize:
+        InvalidArraySizeError(file, error);
+        break;
+
+    case ErrorID::InvalidRelExpr:
+        InvalidRelExprError(file, error);
+        break;
+
+    case ErrorID::InvalidOperator:
+        InvalidOperatorError(file, error);
+        break;
+
+    default:
+        DEBUG_BREAK();
+        break;
+    }
+    file << "\n";
+}
+
+ParsingErrorManager::ParsingErrorManager() { }
+ParsingErrorManager::~ParsingErrorManager() { }
+
+void ParsingErrorManager::ReportError(std::ofstream& file, const ParsingErrorData& error, 
+    const std::string& message)
+{
+    size_t line = error.GetToken().GetLine();
+    file << message;
+    MessagePrinter::AddMessage(line, message);
+    JsonLinesSink::Write("syntax error", ErrorIDToStr(error.GetID()), line, message);
+}
+
+void ParsingErrorManager::DefaultError(std::ofstream& file, const ParsingErrorData& error)
+{
+    const Token& token = error.GetToken();
+    std::stringstream ss;
+    ss << "Unexpected token \"" << token.GetLexeme() << "\". Expected " 
+        << error.GetTop() << " at line " << token.GetLine() << ": \"" 
+        << token.GetStrOfLine() << "\""; 
+
+    ReportError(file, error, ss.str());
+}
+
+void ParsingErrorManager::InvalidTypeSpecifierError(std::ofstream& file, 
+    const ParsingErrorData& error)
+{
+    const Token& token = error.GetToken();
+    std::stringstream ss;
+    ss << "Invalid type specifier \"" << token.GetLexeme() << "\" found at line " 
+        << token.GetLine() << ": \"" << token.GetStrOfLine() << "\"" ; 
+
+    ReportError(file, error, ss.str());
+}
+
+void ParsingErrorManager::InvalidFunctionHeadError(std::ofstream& file, 
+    const ParsingErrorData& error)
+{
+    const Token& token = error.GetToken();
+    std::stringstream ss;
+    ss << "Invalid function head found at line " << token.GetLine() 
+        << ": \"" << token.GetStrOfLine() << "\". Unexpected token \"" 
+        << token.GetLexeme() << "\" encountered"; 
+
+    ReportError(file, error, ss.str());
+}
+
+void ParsingErrorManager::InvalidArgumentDefinitionError(std::ofstream& file, 
+        const ParsingErrorData& error)
+{
+    const Token& token = error.GetToken();
+    std::stringstream ss;
+    ss << "Invalid argument definition encountered at line " << token.GetLine() 
+        << ": \"" << token.GetStrOfLine() << "\". Unexpected token \"" 
+        << token.GetLexeme() << "\" encountered"; 
+
+    ReportError(file, error, ss.str());
+}
+
+void ParsingErrorManager::InvalidArgumentProvidedError(std::ofstream& file, 
+    const ParsingErrorData& error)
+{
+    const Token& token = error.GetToken();
+    std::stringstream ss;
+    ss << "Invalid argument provided at line " << token.GetLine() 
+        << ": \"" << token.GetStrOfLine() << "\". Unexpected token \"" 
+        << token.GetLexeme() << "\" encountered";
+
+    ReportError(file, error, ss.str());
+}
+
+void ParsingErrorManager::InvalidArithExprError(std::ofstream& file, 
+        const ParsingErrorData& error)
+{
+    const Token& token = error.GetToken();
+    std::stringstream ss;
+    ss << "Invalid arithmetic expresion provided at line " << token.GetLine() 
+        << ": \"" << token.GetStrOfLine() << "\". Unexpected token \"" 
+        << token.GetLexeme() << "\" encountered";
+
+    ReportError(file, error, ss.str());
+}
+
+void ParsingErrorManager::ErroneousTokenAtFuncDefError(std::ofstream& file, 
+    const ParsingErrorData& error)
+{
+    const Token& token = error.GetToken();
+    std::stringstream ss;
+    ss << "Erroneous token found at line " << token.GetLine() 
+        << ": \"" << token.GetStrOfLine() << "\". Expected a function definition but found: \""
+        << token.GetLexeme() << "\""; 
+
+    ReportError(file, error, ss.str());
+}
+
+void ParsingErrorManager::InvalidStatementError(std::ofstream& file, 
+        const ParsingErrorData& error)
+{
+    const Token& token = error.GetToken();
+    std::stringstream ss;
+    ss << "Invalid statement found at line " << token.GetLine() 
+        << ": \"" << token.GetStrOfLine() << "\". Unexpected token \"" 
+        << token.GetLexeme() << "\" encountered";
+
+    ReportError(file, error, ss.str());
+}
 
 void ParsingErrorManager::InvalidArraySizeError(std::ofstream& file, 
     const ParsingErrorData& error)
@@ -1402,8 +1914,7 @@ void ParsingErrorManager::InvalidArraySizeError(std::ofstream& file,
         << ": \"" << token.GetStrOfLine() << "\". Unexpected token \"" 
         << token.GetLexeme() << "\" encountered";
 
-    file << ss.str();
-    MessagePrinter::AddMessage(token.GetLine(), ss.str());
+    ReportError(file, error, ss.str());
 }
 
 void ParsingErrorManager::InvalidRelExprError(std::ofstream& file, 
@@ -1415,8 +1926,7 @@ void ParsingErrorManager::InvalidRelExprError(std::ofstream& file,
         << ": \"" << token.GetStrOfLine() << "\". Unexpected token \"" 
         << token.GetLexeme() << "\" encountered";
 
-    file << ss.str();
-    MessagePrinter::AddMessage(token.GetLine(), ss.str());
+    ReportError(file, error, ss.str());
 }
 
 void ParsingErrorManager::InvalidOperatorError(std::ofstream& file, 
@@ -1428,8 +1938,7 @@ void ParsingErrorManager::InvalidOperatorError(std::ofstream& file,
         << token.GetLine() << ": \"" << token.GetStrOfLine() <<"\". The provided operator " 
         << "is either unknown or invalid in this context.";
 
-    file << ss.str();
-    MessagePrinter::AddMessage(token.GetLine(), ss.str());
+    ReportError(file, error, ss.str());
 }
 
 ParsingErrorManager& ParsingErrorManager::GetInstance()
@@ -1438,407 +1947,592 @@ ParsingErrorManager& ParsingErrorManager::GetInstance()
     return manager;
 }
 
+// SemanticStackItem ////////////////////////////////
+SemanticStackItem::SemanticStackItem(ASTNode* node) 
+    : m_node(node), m_marker(SemanticMarker::None) { }
+
+SemanticStackItem::SemanticStackItem(SemanticMarker marker) 
+    : m_node(nullptr), m_marker(marker) { }
+
+ASTNode* SemanticStackItem::GetNode() const { return m_node; }
+SemanticMarker SemanticStackItem::GetMarker() const { return m_marker; }
+bool SemanticStackItem::IsMarker() const { return m_marker != SemanticMarker::None; }
+
 // Parser ////////////////////////////////////////////
 ProgramNode* Parser::Parse(const std::string& filepath)
 {
     Reset(filepath);
 
     Parser& p = GetInstance();
-    p.m_parsingStack.push_front(TokenType::EndOfFile);
-    p.m_parsingStack.push_front(NonTerminal::Start);
+    std::vector<Token> tokens;
 
-    Token currToken = GetNextToken();
-    p.m_currProgramRoot = new ProgramNode();
-    
-    while (!(p.m_parsingStack.front().GetType() == StackableType::TerminalItem 
-        && p.m_parsingStack.front().GetTerminal() == TokenType::EndOfFile))
+    if (s_parallel || s_incremental)
     {
-        const StackableItem& top = p.m_parsingStack.front();
-
-        if (top.GetType() == StackableType::TerminalItem)
+        Token currToken = GetNextToken();
+        while (currToken.GetTokenType() != TokenType::EndOfFile)
         {
-            if (currToken.GetTokenType() == top.GetTerminal())
-            {
-                p.m_parsingStack.pop_front();
-                p.m_prevToken = currToken;
-                if (currToken.GetTokenType() == TokenType::Constructor)
-                {
-                    p.m_lastConstructorToken = currToken;
-                }
-                currToken = GetNextToken();
-                p.m_derivationFile << "\n"; // skip line since we read a terminal
-            }
-            else
-            {
-                // use default error rule
-                RuleManager::GetRule(NullRule)->Apply(top, currToken);
-                p.m_errorFound = true;
-                if (currToken.GetTokenType() == TokenType::EndOfFile)
-                {
-                    break;
-                }
-                currToken = p.SkipError(currToken, top);
-            }
+            tokens.push_back(currToken);
+            currToken = GetNextToken();
         }
-        else if (top.GetType() == StackableType::NonTerminalItem)
+        p.m_endToken = currToken;
+
+        if (ErrorLimit::IsReached())
         {
-            RuleID rule = p.m_parsingTable[top.GetNonTerminal()]->GetRule(currToken);
-            if (!RuleManager::IsError(rule))
-            {
-                NonTerminal topSymbol = top.GetNonTerminal();
-                p.PopNonTerminal();
-                RuleManager::GetRule(rule)->Apply(topSymbol, currToken);
-                p.WriteDerivationToFile();
-            }
-            else
-            {
-                p.m_errorFound = true;
-                RuleManager::GetRule(rule)->Apply(top, currToken);
-                currToken = p.SkipError(currToken, top);
-            }
+            p.CloseOutputFiles();
+            return nullptr;
         }
-        else if (top.GetType() == StackableType::SemanticActionItem)
+
+        std::vector<ParsedDefinition> definitions = s_incremental 
+            ? p.ParseIncrementally(filepath, tokens, p.m_endToken) 
+            : ParseDefinitions(tokens, FindTopLevelDefinitions(tokens), p.m_endToken, true);
+        ProgramNode* program = SpliceDefinitions(definitions);
+        if (program != nullptr)
         {
-            p.ProcessSemanticAction(top.GetAction());
+            p.WriteDerivationToFile(definitions);
+            program->WriteToStream(p.m_astOutFile);
+            p.CloseOutputFiles();
+            return program;
         }
 
+        // parse the tokens again sequentially so the errors and the derivation are reported
+        p.m_tokens = &tokens;
+        p.m_nextTokenIndex = 0;
+        p.m_tokensEnd = tokens.size();
     }
 
+    Token currToken = GetNextToken();
+    p.m_currProgramRoot = new ProgramNode();
+    
+    currToken = p.ParseProgram(currToken);
+
     p.WriteErrorsToFile();
+    p.m_tokens = nullptr;
 
     if (currToken.GetTokenType() != TokenType::EndOfFile || p.m_errorFound)
     {
         delete p.m_currProgramRoot;
         p.m_currProgramRoot = nullptr;
+        p.CloseOutputFiles();
         return nullptr;
     }
 
-    p.m_astOutFile << p.m_currProgramRoot->ToString();
+    p.m_currProgramRoot->WriteToStream(p.m_astOutFile);
 
     // update derivation to remove all epsilon derivations
     p.RemoveNonTerminalsFromDerivation();
     p.WriteDerivationToFile();
+    p.CloseOutputFiles();
     
     ProgramNode* finalProgramRoot = p.m_currProgramRoot;
     p.m_currProgramRoot = nullptr;
     return finalProgramRoot;
 }
 
-Parser::Parser() : m_currProgramRoot(nullptr)
-{ 
-    InitializeParsingTable(); 
-}
+void Parser::SetParallel(bool parallel) { s_parallel = parallel; }
+bool Parser::IsParallel() { return s_parallel; }
+void Parser::SetIncremental(bool incremental) { s_incremental = incremental; }
+bool Parser::IsIncremental() { return s_incremental; }
+void Parser::SetBackend(ParserBackend backend) { s_backend = backend; }
+ParserBackend Parser::GetBackend() { return s_backend; }
 
-Parser::~Parser()
+void Parser::RetainDefinitionCaches(const std::vector<std::string>& filepaths)
 {
-    for (auto& pair : m_parsingTable)
-    {
-        delete pair.second;
-    }
-
-    for (ASTNode* node : m_semanticStack)
+    GetInstance().m_definitionCaches.remove_if([&filepaths](const auto& fileCache)
     {
-        delete node;
-    }
-}
-
-Parser& Parser::GetInstance()
-{
-    static Parser p;
-    return p;
+        return std::find(filepaths.begin(), filepaths.end(), fileCache.first) 
+            == filepaths.end();
+    });
 }
 
-void Parser::Reset(const std::string& filepath)
+void Parser::InitializeTables()
 {
-    Lexer::SetInputFile(filepath);
-
-    Parser& p = GetInstance();
-    p.m_parsingStack.clear();
-    p.m_errorFound = false;
-
-    std::string simpleName = SimplifyFilename(filepath);
-
-    p.m_derivationFile.close();
-    p.m_errorFile.close();
-    p.m_astOutFile.close();
-    p.m_derivationFile = std::ofstream(simpleName + ".outderivation");
-    p.m_errorFile = std::ofstream(simpleName + ".outsyntaxerrors");
-    p.m_astOutFile = std::ofstream(simpleName + ".astout");
-    p.m_derivationFile << NonTerminal::Start << "\n";
-
-    p.m_errors.clear();
-    p.m_derivation.clear();
-    p.m_derivation.emplace_back(NonTerminal::Start);
-    p.m_derivation.emplace_back(TokenType::EndOfFile);
-    p.m_nextNonTerminalIndex = 0;
-    p.m_numDotsEncountered = 0;
+    // the tables, the rules and the sets are built by the first query made to them
+    GetInstance();
+    ParsingTableManager::GetRule(NonTerminal::Start, Token());
+    RuleManager::GetRule(NullRule);
+    SetManager::IsInFirstSet(NonTerminal::Start, TokenType::None);
 }
 
-Token Parser::GetNextToken()
+std::vector<Parser::ParsedDefinition> Parser::ParseIncrementally(const std::string& filepath,
+    const std::vector<Token>& tokens, const Token& endToken)
 {
-    Token nextToken = Lexer::GetNextToken();
-    while (TokenIsIgnored(nextToken.GetTokenType()) || nextToken.IsError())
+    // the kept definitions refer to the names of the name table
+    if (m_definitionCachesGeneration != NameTable::GetGeneration())
     {
-        nextToken = Lexer::GetNextToken();
+        m_definitionCaches.clear();
+        m_definitionCachesGeneration = NameTable::GetGeneration();
     }
-    return nextToken;
-}
-
-bool Parser::TokenIsIgnored(TokenType type)
-{
-    return type == TokenType::InlineComment 
-        || type == TokenType::MultiLineComment;
-}
-
-void Parser::InitializeParsingTable()
-{
-    m_parsingTable[NonTerminal::Start] = new ParsingTableEntry({{TokenType::EndOfFile, 0}, 
-        {TokenType::Function, 0}, {TokenType::Class, 0}});
-
-    m_parsingTable[NonTerminal::ClassDeclOrFuncDefRepetition] 
-        = new ParsingTableEntry({{TokenType::EndOfFile, 2}, {TokenType::Function, 1}, 
-        {TokenType::Class, 1}});
-
-    m_parsingTable[NonTerminal::ClassDeclOrFuncDef] 
-        = new ParsingTableEntry({{TokenType::Function, 4}, {TokenType::Class, 3}});
-    
-    m_parsingTable[NonTerminal::ClassDecl] = new ParsingTableEntry({{TokenType::Class, 5}});
-    
-    m_parsingTable[NonTerminal::ClassDeclMembDeclRepetition] 
-        = new ParsingTableEntry({{TokenType::CloseCurlyBracket, 7}, 
-        {TokenType::Constructor, 6}, {TokenType::Function, 6}, {TokenType::Attribute, 6}, 
-        {TokenType::Private, 6}, {TokenType::Public, 6}});
-
-    m_parsingTable[NonTerminal::ClassDeclInheritance] 
-        = new ParsingTableEntry({{TokenType::OpenCurlyBracket, 9}, {TokenType::IsA, 8}});
-           
-    m_parsingTable[NonTerminal::ClassDeclInheritanceTail] 
-        = new ParsingTableEntry({{TokenType::Comma, 10}, {TokenType::OpenCurlyBracket, 11}});
-
-    m_parsingTable[NonTerminal::Visibility] 
-        = new ParsingTableEntry({{TokenType::Constructor, 14}, {TokenType::Function, 14}, 
-        {TokenType::Attribute, 14}, {TokenType::Private, 13}, {TokenType::Public, 12}});
 
-    m_parsingTable[NonTerminal::MemberDecl] 
-        = new ParsingTableEntry({{TokenType::Constructor, 15}, 
-        {TokenType::Function, 15}, {TokenType::Attribute, 16}});
+    auto cache = std::find_if(m_definitionCaches.begin(), m_definitionCaches.end(), 
+        [&filepath](const auto& fileCache) { return fileCache.first == filepath; });
+    if (cache == m_definitionCaches.end())
+    {
+        m_definitionCaches.emplace_front(filepath, 
+            std::unordered_map<uint64_t, CachedDefinition>());
+        if (m_definitionCaches.size() > s_maxDefinitionCaches)
+        {
+            m_definitionCaches.pop_back();
+        }
+    }
+    else
+    {
+        m_definitionCaches.splice(m_definitionCaches.begin(), m_definitionCaches, cache);
+    }
 
-    m_parsingTable[NonTerminal::MemberFuncDecl] 
-        = new ParsingTableEntry({{TokenType::Constructor, 18}, {TokenType::Function, 17}});
+    std::unordered_map<uint64_t, CachedDefinition>& prevDefinitions 
+        = m_definitionCaches.front().second;
+    std::vector<TokenRange> ranges = FindTopLevelDefinitions(tokens);
+    std::vector<ParsedDefinition> definitions(ranges.size());
+    std::vector<uint64_t> keys(ranges.size());
+    std::vector<TokenRange> modifiedRanges;
+    std::vector<size_t> modifiedIndices;
+
+    // the derivation of the definitions kept while it was not written was not built
+    bool buildDerivation = OutputFiles::IsEnabled(Artifact::Derivation);
+    auto findReusable = [&](uint64_t key)
+    {
+        auto it = prevDefinitions.find(key);
+        if (it != prevDefinitions.end() && buildDerivation && it->second.m_derivation.empty())
+        {
+            return prevDefinitions.end();
+        }
+        return it;
+    };
 
-    m_parsingTable[NonTerminal::MemberVarDecl] 
-        = new ParsingTableEntry({{TokenType::Attribute, 19}});
+    for (size_t i = 0; i < ranges.size(); i++)
+    {
+        keys[i] = HashTokenRange(tokens, ranges[i]);
+        auto it = findReusable(keys[i]);
+        if (it == prevDefinitions.end())
+        {
+            modifiedRanges.push_back(ranges[i]);
+            modifiedIndices.push_back(i);
+            continue;
+        }
 
-    m_parsingTable[NonTerminal::FuncDef] 
-        = new ParsingTableEntry({{TokenType::Function, 20}});
+        // the kept definition is copied since the compilation modifies its nodes and it may 
+        // have moved since it was kept
+        CachedDefinition& cached = it->second;
+        int64_t lineOffset = (int64_t)GetFirstLine(tokens, ranges[i], endToken) 
+            - (int64_t)cached.m_firstLine;
+        definitions[i].m_program = ASTSerializer::Copy(cached.m_program.get(), lineOffset);
+        if (buildDerivation)
+        {
+            definitions[i].m_derivation = cached.m_derivation;
+            definitions[i].m_derivedTerminals = cached.m_derivedTerminals;
+        }
+    }
 
-    m_parsingTable[NonTerminal::FuncHead] 
-        = new ParsingTableEntry({{TokenType::Function, 21}, {TokenType::None, 113}});
+    std::vector<ParsedDefinition> modifiedDefinitions = ParseDefinitions(tokens, 
+        modifiedRanges, endToken, s_parallel);
+    bool valid = true;
+    for (size_t i = 0; i < modifiedDefinitions.size(); i++)
+    {
+        definitions[modifiedIndices[i]] = std::move(modifiedDefinitions[i]);
+        valid = valid && definitions[modifiedIndices[i]].m_program != nullptr;
+    }
 
-    m_parsingTable[NonTerminal::FuncHead2] 
-        = new ParsingTableEntry({{TokenType::OpenParanthese, 23}, {TokenType::Scope, 22}, 
-        {TokenType::None, 113}, {TokenType::None, 113}});
+    // the cache is only replaced by valid programs so definitions which are temporarily 
+    // invalid while being edited can still be reused once they are restored
+    if (valid)
+    {
+        std::unordered_map<uint64_t, CachedDefinition> currDefinitions;
+        for (size_t i = 0; i < ranges.size(); i++)
+        {
+            if (currDefinitions.count(keys[i]) > 0)
+            {
+                continue;
+            }
 
-    m_parsingTable[NonTerminal::FuncHead3] 
-        = new ParsingTableEntry({{TokenType::ID, 24}, {TokenType::Constructor, 25}, 
-        {TokenType::None, 113}});
+            auto it = findReusable(keys[i]);
+            if (it != prevDefinitions.end())
+            {
+                currDefinitions[keys[i]] = std::move(it->second);
+                continue;
+            }
 
-    m_parsingTable[NonTerminal::FuncBody] 
-        = new ParsingTableEntry({{TokenType::OpenCurlyBracket, 26}, {TokenType::None, 116}});
+            CachedDefinition& cached = currDefinitions[keys[i]];
+            cached.m_program.reset(ASTSerializer::Copy(definitions[i].m_program));
+            cached.m_derivation = definitions[i].m_derivation;
+            cached.m_derivedTerminals = definitions[i].m_derivedTerminals;
+            cached.m_firstLine = GetFirstLine(tokens, ranges[i], endToken);
+        }
+        prevDefinitions = std::move(currDefinitions);
+    }
+    return definitions;
+}
 
-    m_parsingTable[NonTerminal::MemberVarDecl] 
-        = new ParsingTableEntry({{TokenType::Attribute, 19}});
+std::vector<Parser::ParsedDefinition> Parser::ParseDefinitions(const std::vector<Token>& tokens,
+    const std::vector<TokenRange>& ranges, const Token& endToken, bool parallel)
+{
+    std::vector<ParsedDefinition> definitions(ranges.size());
+    std::atomic<size_t> nextDefinition(0);
+    DiagnosticsContext& diagnostics = DiagnosticsContext::GetCurrent();
+    bool buildDerivation = OutputFiles::IsEnabled(Artifact::Derivation);
 
-    m_parsingTable[NonTerminal::LocalVarDeclOrStmtRepetition] 
-        = new ParsingTableEntry({{TokenType::ID, 27}, {TokenType::CloseCurlyBracket, 28}, 
-        {TokenType::Return, 27}, {TokenType::Write, 27}, {TokenType::Read, 27}, 
-        {TokenType::While, 27}, {TokenType::If, 27}, {TokenType::LocalVar, 27}, 
-        {TokenType::None, 117}});
+    auto parseDefinitions = [&]()
+    {
+        Parser worker;
+        worker.m_isWorker = true;
+        worker.m_buildsDerivation = buildDerivation;
+        s_workerParser = &worker;
 
-    m_parsingTable[NonTerminal::LocalVarDeclOrStmt] 
-        = new ParsingTableEntry({{TokenType::ID, 30}, {TokenType::Return, 30}, 
-        {TokenType::Write, 30}, {TokenType::Read, 30}, {TokenType::While, 30}, 
-        {TokenType::If, 30}, {TokenType::LocalVar, 29}});
+        size_t i;
+        while ((i = nextDefinition++) < ranges.size())
+        {
+            definitions[i] = worker.ParseTokenRange(tokens, ranges[i], endToken);
+        }
+        s_workerParser = nullptr;
+    };
+
+    // the hardware threads are shared with the other files compiled at the same time and 
+    // the calling thread is one of the threads parsing the definitions
+    size_t numThreads = parallel ? WorkerThreads::GetNumThreads(ranges.size()) : 1;
+    std::vector<std::thread> threads;
+    for (size_t i = 1; i < numThreads; i++)
+    {
+        // the worker threads report to the diagnostics of the compilation
+        threads.emplace_back([&]()
+        {
+            DiagnosticsContext::SetCurrent(&diagnostics);
+            parseDefinitions();
+        });
+    }
+    if (!ranges.empty())
+    {
+        parseDefinitions();
+    }
 
-    m_parsingTable[NonTerminal::LocalVarDecl] 
-        = new ParsingTableEntry({{TokenType::LocalVar, 31}});
+    for (std::thread& thread : threads)
+    {
+        thread.join();
+    }
+    return definitions;
+}
 
-    m_parsingTable[NonTerminal::LocalVarDecl2] 
-        = new ParsingTableEntry({{TokenType::OpenSquareBracket, 32}, 
-        {TokenType::OpenParanthese, 33}, {TokenType::SemiColon, 32}});
+ProgramNode* Parser::SpliceDefinitions(std::vector<ParsedDefinition>& definitions)
+{
+    ProgramNode* program = new ProgramNode();
+    bool valid = true;
+    for (ParsedDefinition& definition : definitions)
+    {
+        if (definition.m_program == nullptr)
+        {
+            valid = false;
+            continue;
+        }
 
-    m_parsingTable[NonTerminal::Statement] 
-        = new ParsingTableEntry({{TokenType::ID, 34}, {TokenType::Return, 39}, 
-        {TokenType::Write, 38}, {TokenType::Read, 37}, {TokenType::While, 36}, 
-        {TokenType::If, 35}});
+        program->GetClassList()->AppendClasses(definition.m_program->GetClassList());
+        program->GetFunctionList()->AppendFuncs(definition.m_program->GetFunctionList());
+        delete definition.m_program;
+        definition.m_program = nullptr;
+    }
 
-    m_parsingTable[NonTerminal::SimpleStatement] 
-        = new ParsingTableEntry({{TokenType::ID, 40}, {TokenType::None, 117}});
+    if (!valid)
+    {
+        delete program;
+        return nullptr;
+    }
+    return program;
+}
 
-    m_parsingTable[NonTerminal::SimpleStatement2] 
-        = new ParsingTableEntry({{TokenType::OpenSquareBracket, 41}, 
-        {TokenType::Dot, 41}, {TokenType::OpenParanthese, 42}, {TokenType::Assign, 41}});
+std::vector<TokenRange> Parser::FindTopLevelDefinitions(const std::vector<Token>& tokens)
+{
+    // tokens before the first definition are parsed with it so they are still rejected
+    std::vector<TokenRange> ranges = {TokenRange(0, tokens.size())};
+    size_t depth = 0;
+    for (size_t i = 0; i < tokens.size(); i++)
+    {
+        switch (tokens[i].GetTokenType())
+        {
+        case TokenType::OpenCurlyBracket:
+            depth++;
+            break;
 
-    m_parsingTable[NonTerminal::SimpleStatement3] 
-        = new ParsingTableEntry({{TokenType::Dot, 43}, {TokenType::Assign, 44}});
+        case TokenType::CloseCurlyBracket:
+            if (depth > 0)
+            {
+                depth--;
+            }
+            break;
 
-    m_parsingTable[NonTerminal::SimpleStatement4] 
-        = new ParsingTableEntry({{TokenType::Dot, 45}, {TokenType::SemiColon, 46}});
+        case TokenType::Class:
+        case TokenType::Function:
+            if (depth == 0 && i > 0)
+            {
+                ranges.back().second = i;
+                ranges.emplace_back(i, tokens.size());
+            }
+            break;
 
-    m_parsingTable[NonTerminal::StatementRepetition] 
-        = new ParsingTableEntry({{TokenType::ID, 47}, {TokenType::CloseCurlyBracket, 48}, 
-        {TokenType::Return, 47}, {TokenType::Write, 47}, {TokenType::Read, 47}, 
-        {TokenType::While, 47}, {TokenType::If, 47}, {TokenType::None, 117}});
+        default:
+            break;
+        }
+    }
+    return ranges;
+}
 
-    m_parsingTable[NonTerminal::StatBlock] 
-        = new ParsingTableEntry({{TokenType::ID, 50}, {TokenType::OpenCurlyBracket, 49}, 
-        {TokenType::SemiColon, 51}, {TokenType::Return, 50}, {TokenType::Write, 50}, 
-        {TokenType::Read, 50}, {TokenType::While, 50}, {TokenType::Else, 51}, 
-        {TokenType::If, 50}});
+uint64_t Parser::HashTokenRange(const std::vector<Token>& tokens, const TokenRange& range)
+{
+    // FNV-1a over the tokens with their lines relative to the start of the range so 
+    // a definition which only moved keeps the same hash, the ids of the names only change 
+    // when the name table is reset which also drops the kept definitions
+    uint64_t hash = 14695981039346656037ull;
+    auto combine = [&hash](uint64_t value)
+    {
+        hash ^= value;
+        hash *= 1099511628211ull;
+    };
 
-    m_parsingTable[NonTerminal::Expr] 
-        = new ParsingTableEntry({{TokenType::Minus, 52}, {TokenType::Plus, 52}, 
-        {TokenType::ID, 52}, {TokenType::IntegerLiteral, 52}, {TokenType::OpenParanthese, 52}, 
-        {TokenType::Not, 52}, {TokenType::FloatLiteral, 52}});
+    size_t firstLine = range.first < range.second ? tokens[range.first].GetLine() : 0;
+    for (size_t i = range.first; i < range.second; i++)
+    {
+        combine((uint64_t)tokens[i].GetTokenType());
+        NameID lexemeID = tokens[i].GetLexemeID();
+        combine(lexemeID != NameTable::InvalidNameID ? (uint64_t)lexemeID 
+            : (uint64_t)std::hash<std::string>()(tokens[i].GetLexeme()));
+        combine((uint64_t)(tokens[i].GetLine() - firstLine));
+    }
+    return hash;
+}
 
-    m_parsingTable[NonTerminal::Expr2] 
-        = new ParsingTableEntry({{TokenType::GreaterOrEqual, 53}, {TokenType::LessOrEqual, 53}, 
-        {TokenType::GreaterThan, 53}, {TokenType::LessThan, 53}, {TokenType::NotEqual, 53}, 
-        {TokenType::Equal, 53}, {TokenType::Comma, 54}, {TokenType::CloseParanthese, 54}, 
-        {TokenType::SemiColon, 54}, {TokenType::None, 121}});
+size_t Parser::GetFirstLine(const std::vector<Token>& tokens, const TokenRange& range, 
+    const Token& endToken)
+{
+    return range.first < range.second ? tokens[range.first].GetLine() : endToken.GetLine();
+}
 
-    m_parsingTable[NonTerminal::RelExpr] 
-        = new ParsingTableEntry({{TokenType::Minus, 55}, {TokenType::Plus, 55}, 
-        {TokenType::ID, 55}, {TokenType::IntegerLiteral, 55}, {TokenType::OpenParanthese, 55}, 
-        {TokenType::Not, 55}, {TokenType::FloatLiteral, 55}, {TokenType::None, 120}});
+Parser::ParsedDefinition Parser::ParseTokenRange(const std::vector<Token>& tokens, 
+    const TokenRange& range, const Token& endToken)
+{
+    ResetState();
+    m_derivationBuffer.str("");
+    m_tokens = &tokens;
+    m_nextTokenIndex = range.first;
+    m_tokensEnd = range.second;
+    m_endToken = endToken;
 
-    m_parsingTable[NonTerminal::ArithExpr] 
-        = new ParsingTableEntry({{TokenType::Minus, 56}, {TokenType::Plus, 56}, 
-        {TokenType::ID, 56}, {TokenType::IntegerLiteral, 56}, {TokenType::OpenParanthese, 56}, 
-        {TokenType::Not, 56}, {TokenType::FloatLiteral, 56}, {TokenType::None, 115}});
+    m_currProgramRoot = new ProgramNode();
+    Token currToken = GetNextToken();
+    currToken = ParseProgram(currToken);
 
-    m_parsingTable[NonTerminal::ArithExpr2] 
-        = new ParsingTableEntry({{TokenType::Or, 57}, {TokenType::Minus, 57}, 
-        {TokenType::Plus, 57}, {TokenType::GreaterOrEqual, 58}, {TokenType::LessOrEqual, 58}, 
-        {TokenType::GreaterThan, 58}, {TokenType::LessThan, 58}, {TokenType::NotEqual, 58}, 
-        {TokenType::Equal, 58}, {TokenType::Comma, 58}, {TokenType::CloseSquareBracket, 58}, 
-        {TokenType::CloseParanthese, 58}, {TokenType::SemiColon, 58}, 
-        {TokenType::None, 121}});   
+    ParsedDefinition definition{m_currProgramRoot};
+    m_currProgramRoot = nullptr;
+    m_tokens = nullptr;
+    if (currToken.GetTokenType() != TokenType::EndOfFile || m_errorFound)
+    {
+        delete definition.m_program;
+        definition.m_program = nullptr;
+        return definition;
+    }
 
-    m_parsingTable[NonTerminal::Sign] 
-        = new ParsingTableEntry({{TokenType::Minus, 60}, {TokenType::Plus, 59}});
+    if (IsDerivationWritten())
+    {
+        definition.m_derivation = m_derivationBuffer.str();
+        std::ostringstream terminals;
+        for (size_t i = 0; i + 1 < m_derivation.size(); i++)
+        {
+            terminals << m_derivation[i] << " ";
+        }
+        definition.m_derivedTerminals = terminals.str();
+    }
+    return definition;
+}
 
-    m_parsingTable[NonTerminal::Term] 
-        = new ParsingTableEntry({{TokenType::Minus, 61}, {TokenType::Plus, 61}, 
-        {TokenType::ID, 61}, {TokenType::IntegerLiteral, 61}, {TokenType::OpenParanthese, 61}, 
-        {TokenType::Not, 61}, {TokenType::FloatLiteral, 61}}); 
+Token Parser::ParseProgram(Token currToken)
+{
+    if (s_backend == ParserBackend::RecursiveDescent)
+    {
+        return ParseRecursiveDescent(currToken);
+    }
+    return ParseTableDriven(currToken);
+}
 
-    m_parsingTable[NonTerminal::Term2] 
-        = new ParsingTableEntry({{TokenType::And, 62}, {TokenType::Divide, 62}, 
-        {TokenType::Multiply, 62}, {TokenType::Or, 63}, {TokenType::Minus, 63}, 
-        {TokenType::Plus, 63}, {TokenType::GreaterOrEqual, 63}, {TokenType::LessOrEqual, 63}, 
-        {TokenType::GreaterThan, 63}, {TokenType::LessThan, 63}, {TokenType::NotEqual, 63}, 
-        {TokenType::Equal, 63}, {TokenType::Comma, 63}, {TokenType::CloseSquareBracket, 63}, 
-        {TokenType::CloseParanthese, 63}, {TokenType::SemiColon, 63}, 
-        {TokenType::None, 121}});
+Token Parser::ParseTableDriven(Token currToken)
+{
+    m_parsingStack.push_front(TokenType::EndOfFile);
+    m_parsingStack.push_front(NonTerminal::Start);
 
-    m_parsingTable[NonTerminal::Factor] 
-        = new ParsingTableEntry({{TokenType::Minus, 69}, {TokenType::Plus, 69}, 
-        {TokenType::ID, 64}, {TokenType::IntegerLiteral, 65}, {TokenType::OpenParanthese, 67}, 
-        {TokenType::Not, 68}, {TokenType::FloatLiteral, 66}});
+    while (!(m_parsingStack.front().GetType() == StackableType::TerminalItem 
+        && m_parsingStack.front().GetTerminal() == TokenType::EndOfFile))
+    {
+        const StackableItem& top = m_parsingStack.front();
 
-    m_parsingTable[NonTerminal::VarOrFuncCall] 
-        = new ParsingTableEntry({{TokenType::ID, 70}});
+        if (top.GetType() == StackableType::TerminalItem)
+        {
+            if (currToken.GetTokenType() == top.GetTerminal())
+            {
+                m_parsingStack.pop_front();
+                currToken = ConsumeToken(currToken);
+            }
+            else
+            {
+                // use default error rule
+                RuleManager::GetRule(NullRule)->Apply(top, currToken);
+                m_errorFound = true;
+                if (currToken.GetTokenType() == TokenType::EndOfFile || ShouldStopAfterError())
+                {
+                    break;
+                }
 
-    m_parsingTable[NonTerminal::VarOrFuncCall2] 
-        = new ParsingTableEntry({{TokenType::And, 71}, {TokenType::Divide, 71}, 
-        {TokenType::Multiply, 71}, {TokenType::Or, 71}, {TokenType::Minus, 71}, 
-        {TokenType::Plus, 71}, {TokenType::GreaterOrEqual, 71}, {TokenType::LessOrEqual, 71}, 
-        {TokenType::GreaterThan, 71}, {TokenType::LessThan, 71}, {TokenType::NotEqual, 71}, 
-        {TokenType::Equal, 71}, {TokenType::Comma, 71}, {TokenType::CloseSquareBracket, 71}, 
-        {TokenType::OpenSquareBracket, 71}, {TokenType::Dot, 71}, 
-        {TokenType::CloseParanthese, 71}, {TokenType::OpenParanthese, 72}, 
-        {TokenType::SemiColon, 71}});
+                bool popTop;
+                currToken = SkipError(currToken, top, popTop);
+                if (popTop)
+                {
+                    m_parsingStack.pop_front();
+                }
+            }
+        }
+        else if (top.GetType() == StackableType::NonTerminalItem)
+        {
+            RuleID rule = ParsingTableManager::GetRule(top.GetNonTerminal(), currToken);
+            if (!RuleManager::IsError(rule))
+            {
+                NonTerminal topSymbol = top.GetNonTerminal();
+                PopNonTerminal();
+                RuleManager::GetRule(rule)->Apply(topSymbol, currToken);
+                WriteDerivationToFile();
+            }
+            else
+            {
+                m_errorFound = true;
+                RuleManager::GetRule(rule)->Apply(top, currToken);
+                if (ShouldStopAfterError())
+                {
+                    break;
+                }
 
-    m_parsingTable[NonTerminal::VarOrFuncCall3] 
-        = new ParsingTableEntry({{TokenType::And, 74}, {TokenType::Divide, 74}, 
-        {TokenType::Multiply, 74}, {TokenType::Or, 74}, {TokenType::Minus, 74}, 
-        {TokenType::Plus, 74}, {TokenType::GreaterOrEqual, 74}, {TokenType::LessOrEqual, 74}, 
-        {TokenType::GreaterThan, 74}, {TokenType::LessThan, 74}, {TokenType::NotEqual, 74}, 
-        {TokenType::Equal, 74}, {TokenType::Comma, 74}, {TokenType::CloseSquareBracket, 74}, 
-        {TokenType::Dot, 73}, {TokenType::CloseParanthese, 74}, {TokenType::SemiColon, 74}});
+                bool popTop;
+                currToken = SkipError(currToken, top, popTop);
+                if (popTop)
+                {
+                    PopNonTerminal();
+                }
+            }
+        }
+        else if (top.GetType() == StackableType::SemanticActionItem)
+        {
+            SemanticAction action = top.GetAction();
+            m_parsingStack.pop_front();
+            ProcessSemanticAction(action);
+        }
+    }
+    return currToken;
+}
 
-    m_parsingTable[NonTerminal::Variable] 
-        = new ParsingTableEntry({{TokenType::ID, 75}});
+Token Parser::ConsumeToken(const Token& currToken)
+{
+    m_prevToken = currToken;
+    if (currToken.GetTokenType() == TokenType::Constructor)
+    {
+        m_lastConstructorToken = currToken;
+    }
+    if (IsDerivationWritten())
+    {
+        GetDerivationStream() << "\n"; // skip line since we read a terminal
+    }
+    return GetNextToken();
+}
 
-    m_parsingTable[NonTerminal::Variable2] 
-        = new ParsingTableEntry({{TokenType::OpenSquareBracket, 76}, {TokenType::Dot, 76}, 
-        {TokenType::CloseParanthese, 76}, {TokenType::OpenParanthese, 77}});
+thread_local Parser* Parser::s_workerParser = nullptr;
+bool Parser::s_parallel = false;
+bool Parser::s_incremental = false;
+ParserBackend Parser::s_backend = ParserBackend::TableDriven;
 
-    m_parsingTable[NonTerminal::Variable3] 
-        = new ParsingTableEntry({{TokenType::Dot, 78}, {TokenType::CloseParanthese, 79}});
+Parser::Parser() : m_currProgramRoot(nullptr), m_tokens(nullptr), m_nextTokenIndex(0), 
+    m_tokensEnd(0), m_isWorker(false), m_buildsDerivation(false), 
+    m_definitionCachesGeneration(NameTable::GetGeneration())
+{ 
+    m_semanticStack.reserve(s_initialSemanticStackCapacity);
+    m_errors.reserve(s_initialErrorCapacity);
+}
 
-    m_parsingTable[NonTerminal::Indice] 
-        = new ParsingTableEntry({{TokenType::And, 81}, {TokenType::Divide, 81}, 
-        {TokenType::Multiply, 81}, {TokenType::Or, 81}, {TokenType::Minus, 81}, 
-        {TokenType::Plus, 81}, {TokenType::GreaterOrEqual, 81}, {TokenType::LessOrEqual, 81}, 
-        {TokenType::GreaterThan, 81}, {TokenType::LessThan, 81}, {TokenType::NotEqual, 81}, 
-        {TokenType::Equal, 81}, {TokenType::Comma, 81}, {TokenType::CloseSquareBracket, 81}, 
-        {TokenType::OpenSquareBracket, 80}, {TokenType::Dot, 81}, 
-        {TokenType::CloseParanthese, 81}, {TokenType::Assign, 81}, 
-        {TokenType::SemiColon, 81}});
+Parser::~Parser()
+{
+    for (SemanticStackItem& item : m_semanticStack)
+    {
+        delete item.GetNode();
+    }
+}
 
-    m_parsingTable[NonTerminal::ArraySize] 
-        = new ParsingTableEntry({{TokenType::OpenSquareBracket, 82}, {TokenType::None, 119}});
+Parser& Parser::GetInstance()
+{
+    if (s_workerParser != nullptr)
+    {
+        return *s_workerParser;
+    }
 
-    m_parsingTable[NonTerminal::ArraySize2] 
-        = new ParsingTableEntry({{TokenType::CloseSquareBracket, 84}, 
-        {TokenType::IntegerLiteral, 83}, {TokenType::None, 119}});
+    // every thread compiling files has its own parser and its own stack, the parsing table,
+    // the rules, the sets and the error data are built once and only read by the threads
+    static thread_local Parser p;
+    return p;
+}
 
-    m_parsingTable[NonTerminal::ArraySizeRepetition] 
-        = new ParsingTableEntry({{TokenType::Comma, 86}, {TokenType::OpenSquareBracket, 85}, 
-        {TokenType::CloseParanthese, 86}, {TokenType::SemiColon, 86}, {TokenType::None, 119}});
+void Parser::Reset(const std::string& filepath)
+{
+    Lexer::SetInputFile(filepath);
 
-    m_parsingTable[NonTerminal::Type] 
-        = new ParsingTableEntry({{TokenType::ID, 89}, {TokenType::FloatKeyword, 88}, 
-        {TokenType::IntegerKeyword, 87}, {TokenType::None, 112}});
+    Parser& p = GetInstance();
+    p.ResetState();
 
-    m_parsingTable[NonTerminal::ReturnType] 
-        = new ParsingTableEntry({{TokenType::ID, 90}, {TokenType::Void, 91}, 
-        {TokenType::FloatKeyword, 90}, {TokenType::IntegerKeyword, 90}, 
-        {TokenType::None, 112}});
+    p.m_derivationFile.close();
+    p.m_errorFile.close();
+    p.m_astOutFile.close();
+    p.m_derivationFile = OutputFiles::Open(filepath, Artifact::Derivation);
+    p.m_errorFile = OutputFiles::Open(filepath, Artifact::SyntaxErrors);
+    p.m_astOutFile = OutputFiles::Open(filepath, Artifact::AST);
+    p.m_derivationFile << NonTerminal::Start << "\n";
+}
 
-    m_parsingTable[NonTerminal::FParams] 
-        = new ParsingTableEntry({{TokenType::ID, 92}, {TokenType::CloseParanthese, 93}, 
-        {TokenType::None, 114}});
+void Parser::ResetState()
+{
+    m_parsingStack.clear();
+    m_errorFound = false;
 
-    m_parsingTable[NonTerminal::AParams] 
-        = new ParsingTableEntry({{TokenType::Minus, 94}, {TokenType::Plus, 94}, 
-        {TokenType::ID, 94}, {TokenType::IntegerLiteral, 94}, {TokenType::CloseParanthese, 95}, 
-        {TokenType::OpenParanthese, 94}, {TokenType::Not, 94}, {TokenType::FloatLiteral, 94}, 
-        {TokenType::None, 118}});
+    // nodes can be left on the semantic stack if the previous program was invalid
+    for (SemanticStackItem& item : m_semanticStack)
+    {
+        delete item.GetNode();
+    }
+    m_semanticStack.clear();
 
-    m_parsingTable[NonTerminal::FParamsTail] 
-        = new ParsingTableEntry({{TokenType::Comma, 96}, {TokenType::CloseParanthese, 97}, 
-        {TokenType::None, 112}});
-    
-    m_parsingTable[NonTerminal::AParamsTail] 
-        = new ParsingTableEntry({{TokenType::Comma, 98}, {TokenType::CloseParanthese, 99}, 
-        {TokenType::None, 118}});
+    m_errors.clear();
+    m_derivation.clear();
+    m_derivation.emplace_back(NonTerminal::Start);
+    m_derivation.emplace_back(TokenType::EndOfFile);
+    m_nextNonTerminalIndex = 0;
+    m_numDotsEncountered = 0;
+}
 
-    m_parsingTable[NonTerminal::RelOp] 
-        = new ParsingTableEntry({{TokenType::GreaterOrEqual, 105}, 
-        {TokenType::LessOrEqual, 104}, {TokenType::GreaterThan, 103},
-        {TokenType::LessThan, 102}, {TokenType::NotEqual, 101}, {TokenType::Equal, 100}, 
-        {TokenType::None, 121}});
+Token Parser::GetNextToken()
+{
+    Parser& p = GetInstance();
+    if (p.m_tokens != nullptr)
+    {
+        if (p.m_nextTokenIndex < p.m_tokensEnd)
+        {
+            return (*p.m_tokens)[p.m_nextTokenIndex++];
+        }
+        return p.m_endToken;
+    }
 
-    m_parsingTable[NonTerminal::AddOp] 
-        = new ParsingTableEntry({{TokenType::Or, 108}, {TokenType::Minus, 107}, 
-        {TokenType::Plus, 106}, {TokenType::None, 121}});
+    Token nextToken = Lexer::GetNextToken();
+    while (TokenIsIgnored(nextToken.GetTokenType()) || nextToken.IsError())
+    {
+        // stop reading the file once the lexer reached the error limit
+        if (ErrorLimit::IsReached())
+        {
+            return Token("", TokenType::EndOfFile, nextToken.GetLine());
+        }
+        nextToken = Lexer::GetNextToken();
+    }
+    return nextToken;
+}
 
-    m_parsingTable[NonTerminal::MultOp] 
-        = new ParsingTableEntry({{TokenType::And, 111}, {TokenType::Divide, 110}, 
-        {TokenType::Multiply, 109}, {TokenType::None, 121}});
+bool Parser::TokenIsIgnored(TokenType type)
+{
+    return type == TokenType::InlineComment 
+        || type == TokenType::MultiLineComment;
 }
 
 void Parser::PushToStack(const Rule* r)
@@ -1848,7 +2542,17 @@ void Parser::PushToStack(const Rule* r)
     {
         m_parsingStack.push_front(*it);    
     }
+    ExpandDerivation(r);
+}
+
+void Parser::ExpandDerivation(const Rule* r)
+{
+    if (!IsDerivationWritten())
+    {
+        return;
+    }
 
+    const std::list<StackableItem>& rightSide = r->GetRightSide();
     size_t shift = 0;
     for (const StackableItem& item : rightSide)
     {
@@ -1869,12 +2573,82 @@ void Parser::PushToStack(const Rule* r)
 
 void Parser::WriteDerivationToFile()
 {
-    m_derivationFile << "-> ";
+    if (!IsDerivationWritten())
+    {
+        return;
+    }
+
+    std::ostream& stream = GetDerivationStream();
+    stream << "-> ";
     for (StackableItem& item : m_derivation)
     {
-        m_derivationFile << item << " ";
+        stream << item << " ";
+    }
+    stream << "\n";
+}
+
+void Parser::WriteDerivationToFile(const std::vector<ParsedDefinition>& definitions)
+{
+    if (!IsDerivationWritten() || definitions.empty())
+    {
+        return;
+    }
+
+    // every sentential form of a definition is preceded by the terminals derived by the 
+    // definitions before it, only the first definition derives the start of the program 
+    // and only the last one derives the end of the program
+    std::string terminals;
+    std::string_view lastLine;
+    for (size_t i = 0; i < definitions.size(); i++)
+    {
+        std::string_view derivation = definitions[i].m_derivation;
+        size_t begin = i > 0 ? derivation.find('\n') + 1 : 0;
+        size_t end = i + 1 < definitions.size() ? derivation.rfind('\n', derivation.size() - 2) + 1
+            : derivation.size();
+
+        while (begin < end)
+        {
+            size_t lineEnd = derivation.find('\n', begin) + 1;
+            std::string_view line = derivation.substr(begin, lineEnd - begin);
+            if (line.size() > 1)
+            {
+                // skip the arrow
+                m_derivationFile << line.substr(0, 3) << terminals << line.substr(3);
+                lastLine = line;
+            }
+            else
+            {
+                m_derivationFile << line;
+            }
+            begin = lineEnd;
+        }
+
+        if (i + 1 < definitions.size())
+        {
+            terminals += definitions[i].m_derivedTerminals;
+        }
+    }
+
+    // the last sentential form is written again once the derivation is complete
+    m_derivationFile << lastLine.substr(0, 3) << terminals << lastLine.substr(3);
+}
+
+std::ostream& Parser::GetDerivationStream()
+{
+    if (m_isWorker)
+    {
+        return m_derivationBuffer;
+    }
+    return m_derivationFile;
+}
+
+bool Parser::IsDerivationWritten() const
+{
+    if (m_isWorker)
+    {
+        return m_buildsDerivation;
     }
-    m_derivationFile << "\n";
+    return m_derivationFile.is_open();
 }
 
 void Parser::RemoveNonTerminalsFromDerivation()
@@ -1889,35 +2663,30 @@ void Parser::RemoveNonTerminalsFromDerivation()
     }
 }
 
+void Parser::CloseOutputFiles()
+{
+    Lexer::CloseOutputFiles();
+    m_derivationFile.close();
+    m_errorFile.close();
+    m_astOutFile.close();
+}
+
 void Parser::WriteErrorsToFile()
 {
-    for (auto it = m_errors.rbegin(); it != m_errors.rend(); it++)
+    for (const ParsingErrorData& error : m_errors)
     {
-        ParsingErrorManager::WriteErrorToFile(m_errorFile, *it);
+        ParsingErrorManager::WriteErrorToFile(m_errorFile, error);
     }
 }
 
-Token Parser::SkipError(const Token& currToken, const StackableItem& top)
+Token Parser::SkipError(const Token& currToken, const StackableItem& top, bool& outPopTop)
 {
-    if (currToken.GetTokenType() == TokenType::EndOfFile 
-        || SetManager::IsInFollowSet(top, currToken.GetTokenType()))
-    {
-        if (top.GetType() == StackableType::NonTerminalItem)
-        {
-            PopNonTerminal();
-        }
-        else
-        {
-            m_parsingStack.pop_front();
-        }
-    }
-    else
+    outPopTop = currToken.GetTokenType() == TokenType::EndOfFile 
+        || SetManager::IsInFollowSet(top, currToken.GetTokenType());
+    if (!outPopTop)
     {
         Token nextToken = currToken;
-        while((!SetManager::IsInFirstSet(top, nextToken.GetTokenType()) 
-            && (!SetManager::IsInFirstSet(top, TokenType::None) 
-            || !SetManager::IsInFollowSet(top, nextToken.GetTokenType()))) 
-            && nextToken.GetTokenType() != TokenType::EndOfFile)
+        while(!SetManager::IsInSyncSet(top, nextToken.GetTokenType()))
         {
             nextToken = GetNextToken();
         }
@@ -1926,17 +2695,39 @@ Token Parser::SkipError(const Token& currToken, const StackableItem& top)
     return currToken;
 }
 
+void Parser::AddError(const Token& currToken, const StackableItem& top, ErrorID id)
+{
+    // worker parsers do not count their errors since invalid programs are parsed again
+    if (m_isWorker || ErrorLimit::AddError())
+    {
+        m_errors.emplace_back(currToken, top, id);
+    }
+}
+
+bool Parser::ShouldStopAfterError() const
+{
+    // the errors of worker parsers are not reported so they can stop at the first one
+    return m_isWorker || ErrorLimit::IsReached();
+}
+
 void Parser::PopNonTerminal()
 {
     m_parsingStack.pop_front();
+    RemoveNextNonTerminalFromDerivation();
+}
+
+void Parser::RemoveNextNonTerminalFromDerivation()
+{
+    if (!IsDerivationWritten())
+    {
+        return;
+    }
+
     m_derivation.erase(m_derivation.begin() + m_nextNonTerminalIndex);
 }
 
 void Parser::ProcessSemanticAction(SemanticAction action)
 {
-    ASSERT(m_parsingStack.front().GetType() == StackableType::SemanticActionItem);
-    m_parsingStack.pop_front();
-
     // do not process semantic actions for invalid programs
     if (m_errorFound)
     {
@@ -1946,7 +2737,7 @@ void Parser::ProcessSemanticAction(SemanticAction action)
     switch(action)
     {
     case SemanticAction::PushStopNode:
-        Push<StopNode>(); 
+        PushMarker(SemanticMarker::Stop);
         break;
 
     case SemanticAction::PushUnspecifiedDimensionNode:
@@ -1990,15 +2781,15 @@ void Parser::ProcessSemanticAction(SemanticAction action)
         break;
 
     case SemanticAction::PushFreeFuncMarker:
-        Push<FreeFuncMarkerNode>(); 
+        PushMarker(SemanticMarker::FreeFunc);
         break;
 
     case SemanticAction::PushMemFuncMarker:
-        Push<MemFuncMarkerNode>(); 
+        PushMarker(SemanticMarker::MemFunc);
         break;
 
     case SemanticAction::PushConstructorMarker:
-        Push<ConstructorMarkerNode>(); 
+        PushMarker(SemanticMarker::Constructor);
         break;
 
     case SemanticAction::EncounteredDot:
@@ -2122,78 +2913,97 @@ void Parser::ProcessSemanticAction(SemanticAction action)
     }
 }
 
+void Parser::PushNode(ASTNode* node) { m_semanticStack.emplace_back(node); }
+void Parser::PushMarker(SemanticMarker marker) { m_semanticStack.emplace_back(marker); }
+
+ASTNode* Parser::PopNode()
+{
+    ASSERT(!m_semanticStack.empty() && !m_semanticStack.back().IsMarker());
+    ASTNode* node = m_semanticStack.back().GetNode();
+    m_semanticStack.pop_back();
+    return node;
+}
+
+SemanticMarker Parser::PopMarker()
+{
+    ASSERT(!m_semanticStack.empty() && m_semanticStack.back().IsMarker());
+    SemanticMarker marker = m_semanticStack.back().GetMarker();
+    m_semanticStack.pop_back();
+    return marker;
+}
+
+bool Parser::TopIsMarker(SemanticMarker marker) const
+{
+    return !m_semanticStack.empty() && m_semanticStack.back().GetMarker() == marker;
+}
+
 void Parser::ConstructIntLiteralAction()
 {
-    m_semanticStack.push_front(new LiteralNode(new IDNode(m_prevToken), 
+    PushNode(new LiteralNode(new IDNode(m_prevToken), 
         new TypeNode(Token("integer",TokenType::IntegerKeyword, SIZE_MAX))));
 }
 
 void Parser::ConstructFloatLiteralAction()
 {
-    m_semanticStack.push_front(new LiteralNode(new IDNode(m_prevToken), 
+    PushNode(new LiteralNode(new IDNode(m_prevToken), 
         new TypeNode(Token("float", TokenType::FloatKeyword, SIZE_MAX))));
 }
 
 void Parser::ConstructVisibilityAction()
 {
-    m_semanticStack.push_front(new VisibilityNode(m_prevToken.GetLexeme()));
+    PushNode(new VisibilityNode(m_prevToken.GetLexeme()));
 }
 
 void Parser::ConstructDefaultVisibilityAction()
 {
-    m_semanticStack.push_front(new DefaultVisibilityNode());
+    PushNode(new DefaultVisibilityNode());
 }
 
 void Parser::ConstructExprAction()
 {
-    ASTNode* topNode = m_semanticStack.front();
-    m_semanticStack.pop_front();
-    m_semanticStack.push_front(new ExprNode(topNode));
+    ASTNode* topNode = PopNode();
+    PushNode(new ExprNode(topNode));
 }
 
 void Parser::ConstructModifiedExprAction()
 {
-    ASTNode* expr = m_semanticStack.front();
-    m_semanticStack.pop_front();
+    ASTNode* expr = PopNode();
 
-    ASTNode* modifier = m_semanticStack.front();
-    m_semanticStack.pop_front();
+    ASTNode* modifier = PopNode();
 
-    m_semanticStack.push_front(new ModifiedExpr(modifier, expr));
+    PushNode(new ModifiedExpr(modifier, expr));
 }
 
 void Parser::ConstructAssignStatAction()
 {
     ExprNode* right = PopTargetNodeFromSemanticStack<ExprNode>();
 
-    ASTNode* left = m_semanticStack.front();
-    m_semanticStack.pop_front();
+    ASTNode* left = PopNode();
 
-    m_semanticStack.push_front(new AssignStatNode(left, right));
+    PushNode(new AssignStatNode(left, right));
 }
 
 void Parser::ConstructVariableAction()
 {
     DimensionNode* dim = PopTargetNodeFromSemanticStack<DimensionNode>();
     IDNode* id = PopTargetNodeFromSemanticStack<IDNode>();
-    m_semanticStack.push_front(new VariableNode(id, dim));
+    PushNode(new VariableNode(id, dim));
 }
 
 void Parser::ConstructVarDeclAction()
 {
-    ASTNode* lastNode = m_semanticStack.front();
-    m_semanticStack.pop_front();
+    ASTNode* lastNode = PopNode();
 
     TypeNode* type = PopTargetNodeFromSemanticStack<TypeNode>();
     IDNode* id = PopTargetNodeFromSemanticStack<IDNode>();
 
     if (dynamic_cast<DimensionNode*>(lastNode) != nullptr)
     {
-        m_semanticStack.push_front(new VarDeclNode(id, type, (DimensionNode*)lastNode));
+        PushNode(new VarDeclNode(id, type, (DimensionNode*)lastNode));
     }
     else if (dynamic_cast<AParamListNode*>(lastNode) != nullptr)
     {
-        m_semanticStack.push_front(new VarDeclNode(id, type, (AParamListNode*)lastNode));
+        PushNode(new VarDeclNode(id, type, (AParamListNode*)lastNode));
     }
     else
     {
@@ -2207,32 +3017,31 @@ void Parser::ConstructFParamAction()
     TypeNode* type = PopTargetNodeFromSemanticStack<TypeNode>();
     IDNode* id = PopTargetNodeFromSemanticStack<IDNode>();
 
-    m_semanticStack.push_front(new FParamNode(id, type, dimension));
+    PushNode(new FParamNode(id, type, dimension));
 }
 
 void Parser::ConstructFuncDefAction()
 {
     StatBlockNode* body = PopTargetNodeFromSemanticStack<StatBlockNode>();
-    ASTNode* marker = m_semanticStack.front();
-    m_semanticStack.pop_front();
     
-    if (dynamic_cast<FreeFuncMarkerNode*>(marker) != nullptr)
+    switch (PopMarker())
     {
+    case SemanticMarker::FreeFunc:
         ConstructFreeFuncDefAction(body);
-    }
-    else if (dynamic_cast<MemFuncMarkerNode*>(marker) != nullptr)
-    {
+        break;
+
+    case SemanticMarker::MemFunc:
         ConstructMemFuncDefAction(body);
-    }
-    else if (dynamic_cast<ConstructorMarkerNode*>(marker) != nullptr)
-    {
+        break;
+
+    case SemanticMarker::Constructor:
         ConstructConstructorDefAction(body);
-    }
-    else
-    {
+        break;
+
+    default:
         DEBUG_BREAK();
+        break;
     }
-    delete marker;
 }
 
 void Parser::ConstructFreeFuncDefAction(StatBlockNode* body)
@@ -2267,7 +3076,7 @@ void Parser::ConstructFuncCallAction()
 {
     AParamListNode* aparam = PopTargetNodeFromSemanticStack<AParamListNode>();
     IDNode* id = PopTargetNodeFromSemanticStack<IDNode>();
-    m_semanticStack.push_front(new FuncCallNode(id, aparam));
+    PushNode(new FuncCallNode(id, aparam));
 }
 
 void Parser::ConstructIfStatAction()
@@ -2275,33 +3084,32 @@ void Parser::ConstructIfStatAction()
     StatBlockNode* elseBlock = PopTargetNodeFromSemanticStack<StatBlockNode>();
     StatBlockNode* ifBlock = PopTargetNodeFromSemanticStack<StatBlockNode>();
     ExprNode* condition = PopTargetNodeFromSemanticStack<ExprNode>();
-    m_semanticStack.push_front(new IfStatNode(condition, ifBlock, elseBlock));
+    PushNode(new IfStatNode(condition, ifBlock, elseBlock));
 }
 
 void Parser::ConstructWhileStatAction()
 {
     StatBlockNode* loopBlock = PopTargetNodeFromSemanticStack<StatBlockNode>();
     ExprNode* condition = PopTargetNodeFromSemanticStack<ExprNode>();
-    m_semanticStack.push_front(new WhileStatNode(condition, loopBlock));
+    PushNode(new WhileStatNode(condition, loopBlock));
 }
 
 void Parser::ConstructReadStatAction()
 {
-    ASTNode* var = m_semanticStack.front();
-    m_semanticStack.pop_front();
-    m_semanticStack.push_front(new ReadStatNode(var));
+    ASTNode* var = PopNode();
+    PushNode(new ReadStatNode(var));
 }
 
 void Parser::ConstructWriteStatAction()
 {
     ExprNode* expr = PopTargetNodeFromSemanticStack<ExprNode>();
-    m_semanticStack.push_front(new WriteStatNode(expr));
+    PushNode(new WriteStatNode(expr));
 }
 
 void Parser::ConstructReturnStatAction()
 {
     ExprNode* expr = PopTargetNodeFromSemanticStack<ExprNode>();
-    m_semanticStack.push_front(new ReturnStatNode(expr));
+    PushNode(new ReturnStatNode(expr));
 }
 
 void Parser::ConstructClassAction()
@@ -2310,10 +3118,9 @@ void Parser::ConstructClassAction()
     std::list<ConstructorDeclNode*> constructors;
     std::list<MemFuncDeclNode*> memFunc;
 
-    ASTNode* top = m_semanticStack.front();
-    m_semanticStack.pop_front();
-    while(dynamic_cast<StopNode*>(top) == nullptr)
+    while(!TopIsMarker(SemanticMarker::Stop))
     {
+        ASTNode* top = PopNode();
         if (dynamic_cast<MemVarNode*>(top) != nullptr)
         {
             memVar.push_back((MemVarNode*)top);
@@ -2330,11 +3137,8 @@ void Parser::ConstructClassAction()
         {
             DEBUG_BREAK();
         }
-
-        top = m_semanticStack.front();
-        m_semanticStack.pop_front();
     }
-    delete top;
+    PopMarker();
 
     InheritanceListNode* inheritanceList = PopTargetNodeFromSemanticStack
         <InheritanceListNode>();
@@ -2366,7 +3170,7 @@ void Parser::ConstructMemVarAction()
     IDNode* id = PopTargetNodeFromSemanticStack<IDNode>();
     VisibilityNode* visibility = PopTargetNodeFromSemanticStack<VisibilityNode>();
 
-    m_semanticStack.push_front(new MemVarNode(visibility, id, type, dimension));
+    PushNode(new MemVarNode(visibility, id, type, dimension));
 }
 
 void Parser::ConstructMemFuncDeclAction()
@@ -2376,14 +3180,14 @@ void Parser::ConstructMemFuncDeclAction()
     IDNode* id = PopTargetNodeFromSemanticStack<IDNode>();
     VisibilityNode* visibility = PopTargetNodeFromSemanticStack<VisibilityNode>();
 
-    m_semanticStack.push_front(new MemFuncDeclNode(visibility, id, returnType, params));
+    PushNode(new MemFuncDeclNode(visibility, id, returnType, params));
 }
 
 void Parser::ConstructConstructorDeclAction()
 {
     FParamListNode* params = PopTargetNodeFromSemanticStack<FParamListNode>();
     VisibilityNode* visibility = PopTargetNodeFromSemanticStack<VisibilityNode>();
-    m_semanticStack.push_front(new ConstructorDeclNode(visibility, params, 
+    PushNode(new ConstructorDeclNode(visibility, params, 
         m_lastConstructorToken));
 }
 
@@ -2394,13 +3198,11 @@ bool Parser::ConstructDotNodeAction()
         return false;
     }
 
-    ASTNode* right = m_semanticStack.front();
-    m_semanticStack.pop_front();
+    ASTNode* right = PopNode();
 
-    ASTNode* left = m_semanticStack.front();
-    m_semanticStack.pop_front();
+    ASTNode* left = PopNode();
 
-    m_semanticStack.push_front(new DotNode(left, right));
+    PushNode(new DotNode(left, right));
     return true;
 }
 
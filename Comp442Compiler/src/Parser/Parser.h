@@ -5,6 +5,11 @@
 #include <list>
 #include <iostream>
 #include <fstream>
+#include <sstream>
+#include <cstdint>
+#include <utility>
+#include <bitset>
+#include <memory>
 #include <vector>
 
 #include "AST.h"
@@ -13,6 +18,9 @@
 
 
 typedef size_t RuleID;
+
+// [first, last) indices of a range of tokens
+typedef std::pair<size_t, size_t> TokenRange;
 static constexpr RuleID NullRule = SIZE_MAX;
 
 enum class ErrorID
@@ -30,6 +38,8 @@ enum class ErrorID
     InvalidOperator,
 };
 
+std::string ErrorIDToStr(ErrorID id);
+
 enum class SemanticAction
 {
     PushStopNode,
@@ -77,6 +87,8 @@ enum class SemanticAction
     ConstructInheritanceList,
 };
 
+std::string SemanticActionToStr(SemanticAction action);
+
 enum class NonTerminal
 {
     None,
@@ -177,6 +189,9 @@ private:
 
 std::ostream& operator<<(std::ostream& stream, const StackableItem& item);
 
+// set of terminals indexed by TokenType
+typedef std::bitset<(size_t)TokenType::IncompleteMultipleLineComment + 1> TokenSet;
+
 // Uses the TokenType::None as the epsilon token
 class SetManager
 {
@@ -191,6 +206,11 @@ public:
     static bool IsInFollowSet(NonTerminal n, TokenType t);
     static bool IsInFollowSet(const StackableItem& n, TokenType t);
 
+    // returns true if parsing can resume on the provided terminal after an error on the 
+    // provided item, which is the case for its first set, its follow set if it can derive 
+    // epsilon and the end of file
+    static bool IsInSyncSet(const StackableItem& n, TokenType t);
+
 private:
     SetManager();
     static SetManager& GetInstance();
@@ -198,9 +218,17 @@ private:
     void InitializeSets();
     void InitializeFirstSets();
     void InitializeFollowSets();
+    void InitializeSetBitmaps();
+
+    static constexpr size_t s_numNonTerminals = (size_t)NonTerminal::MultOp + 1;
 
     std::unordered_map<NonTerminal, std::list<TokenType>> m_firstSets;
     std::unordered_map<NonTerminal, std::list<TokenType>> m_followSets;
+
+    // bitmaps of the sets above indexed by NonTerminal for constant time lookups
+    std::vector<TokenSet> m_firstSetBitmaps;
+    std::vector<TokenSet> m_followSetBitmaps;
+    std::vector<TokenSet> m_syncSetBitmaps;
 };
 
 class Rule
@@ -221,6 +249,8 @@ public:
     ParsingErrorRule(ErrorID id);
 
     virtual void Apply(const StackableItem& top, const Token& currToken) const override;
+    ErrorID GetErrorID() const;
+
 private:
     ErrorID m_errorID;
 };
@@ -253,10 +283,33 @@ public:
     // returns NullRule if the provided token does not have a valid entry in the 
     // table and if no else clause was specified using TokenType::None
     RuleID GetRule(const Token& t) const;
+    const std::unordered_map<TokenType, RuleID>& GetEntries() const;
+
 private:
     std::unordered_map<TokenType, RuleID> m_entries;
 };
 
+// the parsing table is built once and only read afterwards so the parsers of every thread 
+// share it
+class ParsingTableManager
+{
+public:
+    // returns NullRule if the provided token does not have a valid entry for the non terminal
+    static RuleID GetRule(NonTerminal n, const Token& t);
+
+    // returns nullptr if the non terminal does not have an entry in the table
+    static const ParsingTableEntry* GetEntry(NonTerminal n);
+
+private:
+    ParsingTableManager();
+    ~ParsingTableManager();
+
+    static ParsingTableManager& GetInstance();
+    void InitializeParsingTable();
+
+    std::unordered_map<NonTerminal, ParsingTableEntry*> m_parsingTable;
+};
+
 class ParsingErrorData
 {
 public:
@@ -281,6 +334,10 @@ private:
     ParsingErrorManager();
     ~ParsingErrorManager();
 
+    // writes the message to the error file, the message printer and the JSON Lines sink
+    static void ReportError(std::ofstream& file, const ParsingErrorData& error, 
+        const std::string& message);
+
     // custom error message functions
     static void DefaultError(std::ofstream& file, const ParsingErrorData& error);
     static void InvalidTypeSpecifierError(std::ofstream& file, const ParsingErrorData& error);
@@ -306,29 +363,149 @@ private:
     static ParsingErrorManager& GetInstance();
 };
 
+// markers pushed on the semantic stack to delimit or tag the nodes pushed after them
+enum class SemanticMarker
+{
+    None,
+    Stop,
+    FreeFunc,
+    MemFunc,
+    Constructor
+};
+
+// item of the semantic stack, either an AST node or a marker stored by value
+class SemanticStackItem
+{
+public:
+    SemanticStackItem(ASTNode* node);
+    SemanticStackItem(SemanticMarker marker);
+
+    ASTNode* GetNode() const;
+    SemanticMarker GetMarker() const;
+    bool IsMarker() const;
+
+private:
+    ASTNode* m_node;
+    SemanticMarker m_marker;
+};
+
+// algorithm used by the parsers to parse a program, both use the rules and the parsing table 
+// and build the same AST, derivation and syntax errors
+enum class ParserBackend
+{
+    // loop over an explicit stack of the items of the rules
+    TableDriven,
+
+    // one function per non terminal generated from the rules and the parsing table 
+    // (see ParserGenerator.h)
+    RecursiveDescent
+};
+
 class Parser
 {
     friend class Rule;
     friend class ParsingErrorRule;
+    friend class RecursiveDescentParser;
 public:
     // returns the root program node of the parsed program or nullptr if the program is not valid 
     static ProgramNode* Parse(const std::string& filepath);
+
+    // when enabled the top level classes and functions are parsed on worker threads and 
+    // the derivation of the program is built from the derivation of each of them, 
+    // programs with syntax errors are parsed again sequentially to report the errors
+    static void SetParallel(bool parallel);
+    static bool IsParallel();
+
+    // when enabled the AST and the derivation of every top level definition are kept after 
+    // a file is parsed, the next time the file is parsed its tokens are still read but only 
+    // the definitions whose tokens changed are parsed again and the other ones are copied
+    static void SetIncremental(bool incremental);
+    static bool IsIncremental();
+
+    // the table driven parser is used by default
+    static void SetBackend(ParserBackend backend);
+    static ParserBackend GetBackend();
+
+    // drops the definitions kept by the parser of the calling thread for the files which 
+    // are not provided so only the files still being compiled keep their definitions
+    static void RetainDefinitionCaches(const std::vector<std::string>& filepaths);
+
+    // builds the parser of the calling thread, the parsing table, the rules and the first 
+    // and follow sets ahead of the first file so its parse does not include building them
+    static void InitializeTables();
+
 private:
+    // a top level definition parsed as a whole program
+    struct ParsedDefinition
+    {
+        ProgramNode* m_program; // nullptr if the definition is not valid
+
+        // only built while the derivation is written, the terminals are the last sentential 
+        // form of the derivation without the end of file
+        std::string m_derivation;
+        std::string m_derivedTerminals;
+    };
+
     Parser();
     ~Parser();
     static Parser& GetInstance();
     static void Reset(const std::string& filepath);
+    void ResetState();
     static Token GetNextToken();
     static bool TokenIsIgnored(TokenType type);
 
-    void InitializeParsingTable();
+
+    // parses the program with the selected backend, returns the token on which parsing stopped
+    Token ParseProgram(Token currToken);
+    Token ParseTableDriven(Token currToken);
+
+    // defined in GeneratedParser.cpp
+    Token ParseRecursiveDescent(Token currToken);
+
+    // reuses the definitions which did not change since the file was last parsed
+    std::vector<ParsedDefinition> ParseIncrementally(const std::string& filepath, 
+        const std::vector<Token>& tokens, const Token& endToken);
+
+    // parses every range as its own program
+    static std::vector<ParsedDefinition> ParseDefinitions(const std::vector<Token>& tokens, 
+        const std::vector<TokenRange>& ranges, const Token& endToken, bool parallel);
+
+    // merges the programs of the definitions in order into a single program and deletes 
+    // them, returns nullptr if any of them is nullptr
+    static ProgramNode* SpliceDefinitions(std::vector<ParsedDefinition>& definitions);
+
+    // returns the range of tokens of each top level class or function definition
+    static std::vector<TokenRange> FindTopLevelDefinitions(const std::vector<Token>& tokens);
+    static uint64_t HashTokenRange(const std::vector<Token>& tokens, const TokenRange& range);
+    static size_t GetFirstLine(const std::vector<Token>& tokens, const TokenRange& range, 
+        const Token& endToken);
+
+    // parses the tokens of the range as a program
+    ParsedDefinition ParseTokenRange(const std::vector<Token>& tokens, const TokenRange& range, 
+        const Token& endToken);
+
+    // returns the next token
+    Token ConsumeToken(const Token& currToken);
 
     void PushToStack(const Rule* r);
+    void ExpandDerivation(const Rule* r);
     void WriteDerivationToFile();
+    // writes the derivation of the program made of the definitions
+    void WriteDerivationToFile(const std::vector<ParsedDefinition>& definitions);
+    std::ostream& GetDerivationStream();
+
+    // the derivation is only tracked when it is written to a file
+    bool IsDerivationWritten() const;
     void RemoveNonTerminalsFromDerivation();
     void WriteErrorsToFile();
-    Token SkipError(const Token& currToken, const StackableItem& top);
+    void CloseOutputFiles();
+    // returns the token at which parsing can resume, outPopTop is set to true if the 
+    // erroneous item should be skipped instead of parsed again
+    Token SkipError(const Token& currToken, const StackableItem& top, bool& outPopTop);
+    void AddError(const Token& currToken, const StackableItem& top, ErrorID id);
+    bool ShouldStopAfterError() const;
     void PopNonTerminal();
+    void RemoveNextNonTerminalFromDerivation();
 
     // SemanticAction processing
     void ProcessSemanticAction(SemanticAction action);
@@ -367,48 +544,44 @@ private:
     template<typename NodeType, typename... Args>
     void Push(Args... args)
     {
-        m_semanticStack.push_front(new NodeType(std::forward<Args>(args)...));
+        PushNode(new NodeType(std::forward<Args>(args)...));
     }
 
+    void PushNode(ASTNode* node);
+    void PushMarker(SemanticMarker marker);
+    ASTNode* PopNode();
+    SemanticMarker PopMarker();
+    bool TopIsMarker(SemanticMarker marker) const;
+
     template<typename NodeType>
     void ConstructBinaryOperatorNode()
     {
-        ASTNode* right = m_semanticStack.front();
-        m_semanticStack.pop_front();
+        ASTNode* right = PopNode();
 
-        OperatorNode* op = dynamic_cast<OperatorNode*>(m_semanticStack.front());
-        ASSERT(op != nullptr);
-        m_semanticStack.pop_front();
+        OperatorNode* op = PopTargetNodeFromSemanticStack<OperatorNode>();
 
-        ASTNode* left = m_semanticStack.front();
-        m_semanticStack.pop_front();
+        ASTNode* left = PopNode();
 
-        m_semanticStack.push_front(new NodeType(left, op, right));
+        PushNode(new NodeType(left, op, right));
     }
 
     template<typename NodeType>
     void ConstructLoopingNode()
     {
         NodeType* targetNode = new NodeType();
-        ASTNode* topNode = m_semanticStack.front();
-        m_semanticStack.pop_front();
-        while(dynamic_cast<StopNode*>(topNode) == nullptr)
+        while(!TopIsMarker(SemanticMarker::Stop))
         {
-            targetNode->AddLoopingChild(topNode);
-            topNode = m_semanticStack.front();
-            m_semanticStack.pop_front();
+            targetNode->AddLoopingChild(PopNode());
         }
-        delete topNode;
+        PopMarker();
 
-        m_semanticStack.push_front(targetNode);
+        PushNode(targetNode);
     }
 
     template<typename NodeType>
     NodeType* PopTargetNodeFromSemanticStack()
     {
-        ASTNode* top = m_semanticStack.front();
-        m_semanticStack.pop_front();
-        auto s = top->ToString();
+        ASTNode* top = PopNode();
         NodeType* targetNode = dynamic_cast<NodeType*>(top);
         ASSERT(targetNode != nullptr);
         return targetNode;
@@ -417,19 +590,56 @@ private:
     // returns index of first nonterminal or -1 if none was found
     void UpdateNextNonTerminalIndex();
 
-    std::unordered_map<NonTerminal, ParsingTableEntry*> m_parsingTable;
-
     ProgramNode* m_currProgramRoot;
     Token m_prevToken;
     Token m_lastConstructorToken;
     std::list<StackableItem> m_parsingStack; // front is top of stack
-    std::list<ASTNode*> m_semanticStack;
+    std::vector<SemanticStackItem> m_semanticStack; // back is top of stack
     bool m_errorFound;
     std::ofstream m_derivationFile;
+    std::ostringstream m_derivationBuffer; // derivation built by worker parsers
     std::ofstream m_errorFile;
     std::ofstream m_astOutFile;
     std::vector<StackableItem> m_derivation;
     size_t m_nextNonTerminalIndex;
-    std::list<ParsingErrorData> m_errors;
+    std::vector<ParsingErrorData> m_errors; // in the order they were encountered
     size_t m_numDotsEncountered;
+
+    // set when parsing already lexed tokens instead of reading them from the lexer
+    const std::vector<Token>* m_tokens;
+    size_t m_nextTokenIndex;
+    size_t m_tokensEnd;
+    Token m_endToken;
+    // worker parsers parse part of a program for another parser, they do not write the 
+    // errors and only build the derivation when it is written by the other parser
+    bool m_isWorker;
+    bool m_buildsDerivation;
+
+    // top level definition from a previous parse, its AST is never compiled
+    struct CachedDefinition
+    {
+        std::unique_ptr<ProgramNode> m_program;
+        std::string m_derivation;
+        std::string m_derivedTerminals;
+        size_t m_firstLine;
+    };
+
+    // definitions of the last valid parse of the most recently parsed files keyed by the hash 
+    // of their tokens, the front is the most recently parsed file and the least recently 
+    // parsed file is evicted once there are more than s_maxDefinitionCaches files
+    std::list<std::pair<std::string, std::unordered_map<uint64_t, CachedDefinition>>> 
+        m_definitionCaches;
+    size_t m_definitionCachesGeneration; // generation of the name table of the definitions
+
+    // parser used by the current worker thread, the parser of the thread is used if it is null
+    static thread_local Parser* s_workerParser;
+
+    // the settings are shared by the parsers of every thread
+    static bool s_parallel;
+    static bool s_incremental;
+    static ParserBackend s_backend;
+
+    static constexpr size_t s_initialSemanticStackCapacity = 64;
+    static constexpr size_t s_initialErrorCapacity = 64;
+    static constexpr size_t s_maxDefinitionCaches = 16;
 };
\ No newline at end of file
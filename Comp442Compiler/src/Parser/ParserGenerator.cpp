@@ -0,0 +1,233 @@
+#include "ParserGenerator.h"
+#include "Parser.h"
+
+#include <map>
+#include <vector>
+#include <string>
+#include <sstream>
+#include <algorithm>
+#include <iterator>
+
+std::string NonTerminalToEnumName(NonTerminal n)
+{
+    // the non terminals are printed between angle brackets
+    std::ostringstream ss;
+    ss << n;
+    std::string name = ss.str();
+    return name.substr(1, name.size() - 2);
+}
+
+std::string TokenTypeToEnumName(TokenType t)
+{
+    // the end of file is printed as EOF
+    if (t == TokenType::EndOfFile)
+    {
+        return "EndOfFile";
+    }
+
+    std::ostringstream ss;
+    ss << t;
+    return ss.str();
+}
+
+std::string ParseFunctionName(NonTerminal n)
+{
+    return "Parse" + NonTerminalToEnumName(n);
+}
+
+void WriteRuleComment(std::ostream& stream, NonTerminal n, RuleID rule)
+{
+    stream << "            // " << rule << ": " << n << " ->";
+    const std::list<StackableItem>& rightSide = RuleManager::GetRule(rule)->GetRightSide();
+    if (rightSide.empty())
+    {
+        stream << " epsilon";
+    }
+
+    for (const StackableItem& item : rightSide)
+    {
+        // semantic actions are not printed
+        if (item.GetType() != StackableType::SemanticActionItem)
+        {
+            stream << " " << item;
+        }
+    }
+    stream << "\n";
+}
+
+// the known token is the token of the case when it only has one token, TokenType::None
+// otherwise
+void WriteRuleBody(std::ostream& stream, NonTerminal n, RuleID rule, TokenType knownToken)
+{
+    WriteRuleComment(stream, n, rule);
+    stream << "            p.Expand(" << rule << ");\n";
+
+    const std::list<StackableItem>& rightSide = RuleManager::GetRule(rule)->GetRightSide();
+    for (auto it = rightSide.begin(); it != rightSide.end(); it++)
+    {
+        const StackableItem& item = *it;
+        switch (item.GetType())
+        {
+        case StackableType::TerminalItem:
+            if (item.GetTerminal() == knownToken)
+            {
+                stream << "            p.Consume();\n";
+            }
+            else
+            {
+                stream << "            if (!p.Match(TokenType::"
+                    << TokenTypeToEnumName(item.GetTerminal()) << "))\n"
+                    << "            {\n"
+                    << "                return false;\n"
+                    << "            }\n";
+            }
+            knownToken = TokenType::None;
+            break;
+
+        case StackableType::NonTerminalItem:
+            // the non terminal is parsed again instead of recursing when it ends its own rule
+            if (std::next(it) == rightSide.end())
+            {
+                if (item.GetNonTerminal() == n)
+                {
+                    stream << "            continue;\n";
+                }
+                else
+                {
+                    stream << "            return " << ParseFunctionName(item.GetNonTerminal())
+                        << "(p);\n";
+                }
+                return;
+            }
+
+            stream << "            if (!" << ParseFunctionName(item.GetNonTerminal()) << "(p))\n"
+                << "            {\n"
+                << "                return false;\n"
+                << "            }\n";
+            knownToken = TokenType::None;
+            break;
+
+        case StackableType::SemanticActionItem:
+            stream << "            p.ProcessSemanticAction(SemanticAction::"
+                << SemanticActionToStr(item.GetAction()) << ");\n";
+            break;
+
+        default:
+            DEBUG_BREAK();
+            break;
+        }
+    }
+    stream << "            return true;\n";
+}
+
+void WriteErrorRecovery(std::ostream& stream, NonTerminal n, RuleID rule)
+{
+    const ParsingErrorRule* errorRule
+        = dynamic_cast<const ParsingErrorRule*>(RuleManager::GetRule(rule));
+    ASSERT(errorRule != nullptr);
+
+    stream << "            if (p.RecoverFromError(NonTerminal::" << NonTerminalToEnumName(n)
+        << ", ErrorID::" << ErrorIDToStr(errorRule->GetErrorID()) << "))\n"
+        << "            {\n"
+        << "                continue;\n"
+        << "            }\n"
+        << "            return !p.IsStopped();\n";
+}
+
+void WriteCase(std::ostream& stream, NonTerminal n, RuleID rule, TokenType knownToken)
+{
+    if (RuleManager::IsError(rule))
+    {
+        WriteErrorRecovery(stream, n, rule);
+    }
+    else
+    {
+        WriteRuleBody(stream, n, rule, knownToken);
+    }
+}
+
+void WriteParseFunction(std::ostream& stream, NonTerminal n, const ParsingTableEntry& entry)
+{
+    // the tokens without an entry use the else entry (TokenType::None) or the default error
+    RuleID defaultRule = NullRule;
+    auto defaultIt = entry.GetEntries().find(TokenType::None);
+    if (defaultIt != entry.GetEntries().end())
+    {
+        defaultRule = defaultIt->second;
+    }
+
+    // tokens sharing a rule share a case, the tokens using the default rule are left to
+    // the default case, ordered by rule and token so the file does not change between runs
+    std::map<RuleID, std::vector<TokenType>> cases;
+    for (auto& pair : entry.GetEntries())
+    {
+        if (pair.first != TokenType::None && pair.second != defaultRule)
+        {
+            cases[pair.second].push_back(pair.first);
+        }
+    }
+
+    stream << "// " << n << "\n"
+        << "static bool " << ParseFunctionName(n) << "(RecursiveDescentParser& p)\n"
+        << "{\n"
+        << "    while (true)\n"
+        << "    {\n"
+        << "        switch (p.GetTokenType())\n"
+        << "        {\n";
+
+    for (auto& pair : cases)
+    {
+        std::vector<TokenType>& tokens = pair.second;
+        std::sort(tokens.begin(), tokens.end());
+        for (TokenType t : tokens)
+        {
+            stream << "        case TokenType::" << TokenTypeToEnumName(t) << ":\n";
+        }
+        WriteCase(stream, n, pair.first, tokens.size() == 1 ? tokens[0] : TokenType::None);
+        stream << "\n";
+    }
+
+    stream << "        default:\n";
+    WriteCase(stream, n, defaultRule, TokenType::None);
+    stream << "        }\n"
+        << "    }\n"
+        << "}\n";
+}
+
+void WriteRecursiveDescentParser(std::ostream& stream)
+{
+    std::vector<NonTerminal> nonTerminals;
+    for (size_t i = (size_t)NonTerminal::Start; i <= (size_t)NonTerminal::MultOp; i++)
+    {
+        if (ParsingTableManager::GetEntry((NonTerminal)i) != nullptr)
+        {
+            nonTerminals.push_back((NonTerminal)i);
+        }
+    }
+
+    stream << "// Generated by ParserGenerator.cpp from the rules and the parsing table of "
+        << "Parser.cpp,\n"
+        << "// generate it again with --generate-parser instead of editing it\n"
+        << "\n"
+        << "#include \"RecursiveDescentParser.h\"\n"
+        << "\n";
+
+    for (NonTerminal n : nonTerminals)
+    {
+        stream << "static bool " << ParseFunctionName(n) << "(RecursiveDescentParser& p);\n";
+    }
+    stream << "\n";
+
+    for (NonTerminal n : nonTerminals)
+    {
+        WriteParseFunction(stream, n, *ParsingTableManager::GetEntry(n));
+        stream << "\n";
+    }
+
+    stream << "Token Parser::ParseRecursiveDescent(Token currToken)\n"
+        << "{\n"
+        << "    RecursiveDescentParser parser(*this, currToken);\n"
+        << "    " << ParseFunctionName(NonTerminal::Start) << "(parser);\n"
+        << "    return parser.GetCurrToken();\n"
+        << "}\n";
+}
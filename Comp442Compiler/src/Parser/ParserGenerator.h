@@ -0,0 +1,8 @@
+#pragma once
+#include <ostream>
+
+// writes the source of GeneratedParser.cpp, the recursive descent parser made of one function
+// per non terminal of the parsing table, every case of a function parses the right side of the
+// rule of its tokens or recovers from the error of its error rule, the file has to be
+// generated again whenever the rules or the parsing table change
+void WriteRecursiveDescentParser(std::ostream& stream);
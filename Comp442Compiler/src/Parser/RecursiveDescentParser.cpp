@@ -0,0 +1,56 @@
+#include "RecursiveDescentParser.h"
+
+RecursiveDescentParser::RecursiveDescentParser(Parser& parser, const Token& currToken)
+    : m_parser(parser), m_currToken(currToken), m_isStopped(false),
+    m_writesDerivation(parser.IsDerivationWritten()) { }
+
+bool RecursiveDescentParser::RecoverFromError(NonTerminal nonTerminal, ErrorID id)
+{
+    StackableItem top(nonTerminal);
+    m_parser.m_errorFound = true;
+    m_parser.AddError(m_currToken, top, id);
+    if (m_parser.ShouldStopAfterError())
+    {
+        m_isStopped = true;
+        return false;
+    }
+
+    bool skipTop;
+    m_currToken = m_parser.SkipError(m_currToken, top, skipTop);
+    if (skipTop)
+    {
+        m_parser.RemoveNextNonTerminalFromDerivation();
+        return false;
+    }
+    return true;
+}
+
+void RecursiveDescentParser::ExpandDerivation(RuleID rule)
+{
+    m_parser.RemoveNextNonTerminalFromDerivation();
+    m_parser.ExpandDerivation(RuleManager::GetRule(rule));
+    m_parser.WriteDerivationToFile();
+}
+
+bool RecursiveDescentParser::MatchAfterError(TokenType terminal)
+{
+    StackableItem top(terminal);
+    while (m_currToken.GetTokenType() != terminal)
+    {
+        m_parser.m_errorFound = true;
+        m_parser.AddError(m_currToken, top, ErrorID::Default);
+        if (m_currToken.GetTokenType() == TokenType::EndOfFile
+            || m_parser.ShouldStopAfterError())
+        {
+            m_isStopped = true;
+            return false;
+        }
+
+        // a terminal is only skipped at the end of file so the tokens are skipped until
+        // the terminal or the end of file is found
+        bool skipTop;
+        m_currToken = m_parser.SkipError(m_currToken, top, skipTop);
+        ASSERT(!skipTop);
+    }
+    return true;
+}
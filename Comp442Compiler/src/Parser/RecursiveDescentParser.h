@@ -0,0 +1,61 @@
+#pragma once
+#include "Parser.h"
+
+// state of a program parsed by the recursive descent parser of GeneratedParser.cpp, each
+// non terminal is parsed by a generated function which returns false once parsing stopped,
+// the derivation, the errors and the semantic actions are processed in the same order as
+// the table driven parser
+class RecursiveDescentParser
+{
+public:
+    RecursiveDescentParser(Parser& parser, const Token& currToken);
+
+    // the functions called for every token are defined here so the generated functions
+    // inline them
+    TokenType GetTokenType() const { return m_currToken.GetTokenType(); }
+    const Token& GetCurrToken() const { return m_currToken; }
+
+    // true once an error stopped parsing
+    bool IsStopped() const { return m_isStopped; }
+
+    void Consume() { m_currToken = m_parser.ConsumeToken(m_currToken); }
+
+    // consumes the terminal, returns false if parsing stopped before it could be matched
+    bool Match(TokenType terminal)
+    {
+        if (m_currToken.GetTokenType() != terminal && !MatchAfterError(terminal))
+        {
+            return false;
+        }
+        Consume();
+        return true;
+    }
+
+    // replaces the non terminal being parsed by the right side of the rule in the derivation
+    void Expand(RuleID rule)
+    {
+        if (m_writesDerivation)
+        {
+            ExpandDerivation(rule);
+        }
+    }
+
+    void ProcessSemanticAction(SemanticAction action) { m_parser.ProcessSemanticAction(action); }
+
+    // reports the error of the non terminal and skips the tokens which cannot follow it,
+    // returns true if the non terminal should be parsed again and false if it is skipped or
+    // if parsing stopped
+    bool RecoverFromError(NonTerminal nonTerminal, ErrorID id);
+
+private:
+    void ExpandDerivation(RuleID rule);
+
+    // reports the errors and skips tokens until the terminal is found, returns false if
+    // parsing stopped before
+    bool MatchAfterError(TokenType terminal);
+
+    Parser& m_parser;
+    Token m_currToken;
+    bool m_isStopped;
+    bool m_writesDerivation;
+};
@@ -1,6 +1,10 @@
 #include "SemanticErrors.h"
 #include "../Parser/AST.h"
 #include "../Core/MessagePrinter.h"
+#include "../Core/ErrorLimit.h"
+#include "../Core/DiagnosticsContext.h"
+#include "../Core/JsonLinesSink.h"
+#include "../Core/Core.h"
 
 #include <sstream>
 #include <fstream>
@@ -24,10 +28,114 @@ std::string AParamToTypeList(AParamListNode* param)
     return ss.str();
 }
 
+std::string SemanticErrorCodeToStr(SemanticErrorCode code)
+{
+    switch (code)
+    {
+    case SemanticErrorCode::UndeclaredSymbol:
+        return "UndeclaredSymbol";
+
+    case SemanticErrorCode::DuplicateSymbolName:
+        return "DuplicateSymbolName";
+
+    case SemanticErrorCode::ConstructorDeclNotFound:
+        return "ConstructorDeclNotFound";
+
+    case SemanticErrorCode::MemberFunctionDeclNotFound:
+        return "MemberFunctionDeclNotFound";
+
+    case SemanticErrorCode::MemFuncDefNotFound:
+        return "MemFuncDefNotFound";
+
+    case SemanticErrorCode::ConstructorDefNotFound:
+        return "ConstructorDefNotFound";
+
+    case SemanticErrorCode::CircularInheritanceDependency:
+        return "CircularInheritanceDependency";
+
+    case SemanticErrorCode::CircularClassMemberDependency:
+        return "CircularClassMemberDependency";
+
+    case SemanticErrorCode::InvalidOperandForOperator:
+        return "InvalidOperandForOperator";
+
+    case SemanticErrorCode::InvalidTypeMatchupForAssign:
+        return "InvalidTypeMatchupForAssign";
+
+    case SemanticErrorCode::IncorrectParametersProvidedToFuncCall:
+        return "IncorrectParametersProvidedToFuncCall";
+
+    case SemanticErrorCode::UnknownMember:
+        return "UnknownMember";
+
+    case SemanticErrorCode::IncorrectReturnType:
+        return "IncorrectReturnType";
+
+    case SemanticErrorCode::MissingReturnStat:
+        return "MissingReturnStat";
+
+    case SemanticErrorCode::IncorrectNumberOfMainFunc:
+        return "IncorrectNumberOfMainFunc";
+
+    case SemanticErrorCode::OperationOnArray:
+        return "OperationOnArray";
+
+    case SemanticErrorCode::ArrayIndexingType:
+        return "ArrayIndexingType";
+
+    case SemanticErrorCode::InvalidDotOperatorUsage:
+        return "InvalidDotOperatorUsage";
+
+    case SemanticErrorCode::ProhibitedAccessToPrivateMember:
+        return "ProhibitedAccessToPrivateMember";
+
+    case SemanticErrorCode::IncorrectArrayDimensionUsed:
+        return "IncorrectArrayDimensionUsed";
+
+    default:
+        DEBUG_BREAK();
+        return "";
+    }
+}
+
+std::string SemanticWarningCodeToStr(SemanticWarningCode code)
+{
+    switch (code)
+    {
+    case SemanticWarningCode::OverloadedFreeFunc:
+        return "OverloadedFreeFunc";
+
+    case SemanticWarningCode::OverloadedMemFunc:
+        return "OverloadedMemFunc";
+
+    case SemanticWarningCode::OverloadedConstructor:
+        return "OverloadedConstructor";
+
+    case SemanticWarningCode::MemOverShadowingMem:
+        return "MemOverShadowingMem";
+
+    case SemanticWarningCode::LocalVarOverShadowingMem:
+        return "LocalVarOverShadowingMem";
+
+    case SemanticWarningCode::MainHasParameters:
+        return "MainHasParameters";
+
+    case SemanticWarningCode::OverridenFunc:
+        return "OverridenFunc";
+
+    default:
+        DEBUG_BREAK();
+        return "";
+    }
+}
+
+// SemanticMessage ///////////////////////////////////////////////////////////
+void SemanticMessage::SendToMessagePrinter() { MessagePrinter::AddMessage(GetLine(), this); }
+
 // SemanticWarning ///////////////////////////////////////////////////////////
 SemanticWarning::SemanticWarning(SemanticWarningCode code) : m_warningCode(code) { }
 SemanticWarningCode SemanticWarning::GetWarningCode() const { return m_warningCode; }
-std::string SemanticWarning::ToString() const
+std::string SemanticWarning::Format() const
 {
     std::stringstream ss;
     ss << "Warning: " << GetMessage();
@@ -39,9 +147,9 @@ TokenBasedWarning::TokenBasedWarning(SemanticWarningCode code, const Token& t)
     : SemanticWarning(code), m_token(t) { }
 const Token& TokenBasedWarning::GetToken() const { return m_token; }
 
-void TokenBasedWarning::SendToMessagePrinter()
+size_t TokenBasedWarning::GetLine() const
 {
-    MessagePrinter::AddMessage(GetToken().GetLine(), ToString());
+    return GetToken().GetLine();
 }
 
 // TokenPairBasedWarning ////////////////////////////////////////////////////////////
@@ -78,9 +186,9 @@ std::string OverloadedMemFuncWarn::GetMessage() const
     return ss.str();
 }
 
-void OverloadedMemFuncWarn::SendToMessagePrinter()
+size_t OverloadedMemFuncWarn::GetLine() const
 {
-    MessagePrinter::AddMessage(GetToken1().GetLine(), ToString());
+    return GetToken1().GetLine();
 }
 
 // OverloadedConstructorWarn ///////////////////////////////////////////////////
@@ -112,9 +220,9 @@ std::string MemOverShadowingMemWarn::GetMessage() const
     return ss.str();
 }
 
-void MemOverShadowingMemWarn::SendToMessagePrinter()
+size_t MemOverShadowingMemWarn::GetLine() const
 {
-    MessagePrinter::AddMessage(GetToken2().GetLine(), ToString());
+    return GetToken2().GetLine();
 }
 
 // LocalVarOverShadowingMem ////////////////////////////////////////////////
@@ -135,9 +243,9 @@ std::string LocalVarOverShadowingMem::GetMessage() const
     return ss.str();
 }
 
-void LocalVarOverShadowingMem::SendToMessagePrinter()
+size_t LocalVarOverShadowingMem::GetLine() const
 {
-    MessagePrinter::AddMessage(GetToken2().GetLine(), ToString());
+    return GetToken2().GetLine();
 }
 
 // MainHasParametersWarn /////////////////////////////////////////////////
@@ -152,10 +260,10 @@ std::string MainHasParametersWarn::GetMessage() const
     return ss.str();
 }
 
-void MainHasParametersWarn::SendToMessagePrinter()
+size_t MainHasParametersWarn::GetLine() const
 {
-    // add at the end of all messages
-    MessagePrinter::AddMessage(SIZE_MAX, ToString());
+    // printed after all the other messages
+    return SIZE_MAX;
 }
 
 // OverridenFuncWarn /////////////////////////////////////////////////////////
@@ -177,7 +285,7 @@ std::string OverridenFuncWarn::GetMessage() const
 // SemanticError //////////////////////////////////////////////////////////////
 SemanticError::SemanticError(SemanticErrorCode errorCode) : m_errorCode(errorCode) { }
 SemanticErrorCode SemanticError::GetErrorCode() const { return m_errorCode; }
-std::string SemanticError::ToString() const
+std::string SemanticError::Format() const
 {
     std::stringstream ss;
     ss << "Error: " << GetMessage();
@@ -190,9 +298,9 @@ TokenBasedError::TokenBasedError(SemanticErrorCode errorCode, const Token& token
     
 const Token& TokenBasedError::GetToken() const { return m_token; }
 
-void TokenBasedError::SendToMessagePrinter()
+size_t TokenBasedError::GetLine() const
 {
-    MessagePrinter::AddMessage(GetToken().GetLine(), ToString());
+    return GetToken().GetLine();
 }
 
 // UndeclaredSymbolError ///////////////////////////////////////////////////////////
@@ -234,9 +342,9 @@ std::string DuplicateSymbolError::GetMessage() const
     return ss.str();
 }
 
-void DuplicateSymbolError::SendToMessagePrinter()
+size_t DuplicateSymbolError::GetLine() const
 {
-    MessagePrinter::AddMessage(m_duplicateToken.GetLine(), ToString());
+    return m_duplicateToken.GetLine();
 }
 
 // ConstructorDeclNotFound ////////////////////////////////////////////////////////
@@ -270,9 +378,9 @@ std::string MemberFunctionDeclNotFound::GetMessage() const
     return ss.str();
 }
 
-void MemberFunctionDeclNotFound::SendToMessagePrinter()
+size_t MemberFunctionDeclNotFound::GetLine() const
 {
-    MessagePrinter::AddMessage(m_funcNameToken.GetLine(), ToString());
+    return m_funcNameToken.GetLine();
 }
 
 // MemFuncDefNotFoundError ////////////////////////////////////////////////////////
@@ -291,9 +399,9 @@ std::string MemFuncDefNotFoundError::GetMessage() const
     return ss.str();
 }
 
-void MemFuncDefNotFoundError::SendToMessagePrinter()
+size_t MemFuncDefNotFoundError::GetLine() const
 {
-    MessagePrinter::AddMessage(m_funcDecl.GetLine(), ToString());
+    return m_funcDecl.GetLine();
 }
 
 // ConstructorDefNotFoundError ////////////////////////////////////////////////////
@@ -313,9 +421,9 @@ std::string ConstructorDefNotFoundError::GetMessage() const
     return ss.str(); 
 }
 
-void ConstructorDefNotFoundError::SendToMessagePrinter()
+size_t ConstructorDefNotFoundError::GetLine() const
 {
-    MessagePrinter::AddMessage(m_constructor.GetLine(), ToString());
+    return m_constructor.GetLine();
 }
 
 // CircularInheritanceDependencyError ////////////////////////////////////////////////
@@ -382,9 +490,9 @@ std::string InvalidOperandForOperatorError::GetMessage() const
     return ss.str(); 
 }
 
-void InvalidOperandForOperatorError::SendToMessagePrinter()
+size_t InvalidOperandForOperatorError::GetLine() const
 {
-    MessagePrinter::AddMessage(m_node->GetOperator()->GetOperator().GetLine(), ToString());
+    return m_node->GetOperator()->GetOperator().GetLine();
 }
 
 // InvalidTypeMatchupForAssignError ////////////////////////////////////////////////
@@ -420,9 +528,9 @@ std::string InvalidTypeMatchupForAssignError::GetMessage() const
     return ss.str();
 }
 
-void InvalidTypeMatchupForAssignError::SendToMessagePrinter()
+size_t InvalidTypeMatchupForAssignError::GetLine() const
 {
-    MessagePrinter::AddMessage(m_node->GetLeft()->GetFirstToken().GetLine(), ToString());
+    return m_node->GetLeft()->GetFirstToken().GetLine();
 }
 
 // IncorrectParametersProvidedToFuncCallError /////////////////////////////////
@@ -473,18 +581,13 @@ std::string IncorrectParametersProvidedToFuncCallError::GetMessage() const
     return ss.str();
 }
 
-void IncorrectParametersProvidedToFuncCallError::SendToMessagePrinter()
+size_t IncorrectParametersProvidedToFuncCallError::GetLine() const
 {
-    size_t line;
     if (m_node == nullptr)
     {
-        line = m_type->GetType().GetLine();
+        return m_type->GetType().GetLine();
     }
-    else
-    {
-        line = m_node->GetID()->GetID().GetLine();
-    }
-    MessagePrinter::AddMessage(line, ToString());
+    return m_node->GetID()->GetID().GetLine();
 }
 
 // UnknownMemberError ///////////////////////////////////////////////////////////
@@ -550,10 +653,10 @@ std::string IncorrectNumberOfMainFuncError::GetMessage() const
     return ss.str();
 }
 
-void IncorrectNumberOfMainFuncError::SendToMessagePrinter()
+size_t IncorrectNumberOfMainFuncError::GetLine() const
 {
-    // put at the end of the list of messages
-    MessagePrinter::AddMessage(SIZE_MAX, ToString());
+    // printed after all the other messages
+    return SIZE_MAX;
 }
 
 // OperationOnArrayError ///////////////////////////////////////////////////////
@@ -619,62 +722,110 @@ std::string IncorrectArrayDimensionUsedError::GetMessage() const
     return ss.str();
 }
 
+// SemanticMessageBuffer ///////////////////////////////////////////////////////
+SemanticMessageBuffer::SemanticMessageBuffer() : m_numErrors(0) { }
+
+SemanticMessageBuffer::~SemanticMessageBuffer()
+{
+    for (std::pair<SemanticError*, SemanticWarning*>& message : m_messages)
+    {
+        delete message.first;
+        delete message.second;
+    }
+}
+
+size_t SemanticMessageBuffer::GetNumErrors() const { return m_numErrors; }
+
 // SemanticErrorManager ////////////////////////////////////////////////////////
+thread_local SemanticMessageBuffer* SemanticErrorManager::s_threadBuffer = nullptr;
+
 void SemanticErrorManager::AddError(SemanticError* error)
 {
+    if (s_threadBuffer != nullptr)
+    {
+        s_threadBuffer->m_messages.emplace_back(error, nullptr);
+        s_threadBuffer->m_numErrors++;
+        return;
+    }
+
+    if (!ErrorLimit::AddError())
+    {
+        // errors past the limit are dropped before their message is formatted
+        delete error;
+        return;
+    }
+
     error->SendToMessagePrinter();
-    GetInstance().m_errors.push_back(error);
+    JsonLinesSink::Write("semantic error", SemanticErrorCodeToStr(error->GetErrorCode()), 
+        error->GetLine(), error);
+    DiagnosticsContext::GetCurrent().m_semanticErrors.push_back(error);
 }
 
 void SemanticErrorManager::AddWarning(SemanticWarning* warning)
 {
+    if (s_threadBuffer != nullptr)
+    {
+        s_threadBuffer->m_messages.emplace_back(nullptr, warning);
+        return;
+    }
+
     warning->SendToMessagePrinter();
-    GetInstance().m_warnings.push_back(warning);
+    JsonLinesSink::Write("semantic warning", 
+        SemanticWarningCodeToStr(warning->GetWarningCode()), warning->GetLine(), warning);
+    DiagnosticsContext::GetCurrent().m_semanticWarnings.push_back(warning);
 }
 
-bool SemanticErrorManager::HasError() { return GetInstance().m_errors.size() > 0; }
+bool SemanticErrorManager::HasError() 
+{ 
+    return DiagnosticsContext::GetCurrent().m_semanticErrors.size() > 0; 
+}
 
 void SemanticErrorManager::LogData() 
 {
-    SemanticErrorManager& manager = GetInstance();
-    std::ofstream outFile = std::ofstream(manager.m_filepath, std::ios_base::trunc);
-    for (SemanticWarning* warning : manager.m_warnings)
+    DiagnosticsContext& diagnostics = DiagnosticsContext::GetCurrent();
+    if (diagnostics.m_semanticErrorFilepath.empty())
     {
-        outFile << warning->ToString() << "\n";
+        return;
     }
 
-    for (SemanticError* error : manager.m_errors)
+    std::ofstream outFile = std::ofstream(diagnostics.m_semanticErrorFilepath, 
+        std::ios_base::trunc);
+    for (SemanticWarning* warning : diagnostics.m_semanticWarnings)
     {
-        outFile << error->ToString() << "\n";
+        outFile << warning->GetText() << "\n";
+    }
+
+    for (SemanticError* error : diagnostics.m_semanticErrors)
+    {
+        outFile << error->GetText() << "\n";
     }
 }
 
-void SemanticErrorManager::SetFilePath(const std::string& filepath)
-{
-    GetInstance().m_filepath = filepath;
+void SemanticErrorManager::SetThreadBuffer(SemanticMessageBuffer* buffer) 
+{ 
+    s_threadBuffer = buffer; 
 }
 
-void SemanticErrorManager::Clear()
+void SemanticErrorManager::AddBufferedMessages(SemanticMessageBuffer& buffer)
 {
-    SemanticErrorManager& manager = GetInstance();
-    for (SemanticError* error : manager.m_errors)
-    {
-        delete error;
-    }
-    manager.m_errors.clear();
-
-    for (SemanticWarning* warning : manager.m_warnings)
+    for (std::pair<SemanticError*, SemanticWarning*>& message : buffer.m_messages)
     {
-        delete warning;
+        if (message.first != nullptr)
+        {
+            AddError(message.first);
+        }
+        else
+        {
+            AddWarning(message.second);
+        }
     }
-    manager.m_warnings.clear();
+    buffer.m_messages.clear();
+    buffer.m_numErrors = 0;
 }
 
-SemanticErrorManager::SemanticErrorManager() { }
-SemanticErrorManager::~SemanticErrorManager() { Clear(); }
-
-SemanticErrorManager& SemanticErrorManager::GetInstance()
+void SemanticErrorManager::SetFilePath(const std::string& filepath)
 {
-    static SemanticErrorManager manager;
-    return manager;
-}
\ No newline at end of file
+    DiagnosticsContext::GetCurrent().m_semanticErrorFilepath = filepath;
+}
+
+SemanticErrorManager::SemanticErrorManager() { }
\ No newline at end of file
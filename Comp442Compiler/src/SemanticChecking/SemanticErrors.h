@@ -1,8 +1,12 @@
 #pragma once
 #include "../Core/Token.h"
+#include "../Core/MessagePrinter.h"
 
 #include <string>
 #include <list>
+#include <vector>
+#include <utility>
+#include <atomic>
 
 class BaseBinaryOperator;
 class AssignStatNode;
@@ -46,10 +50,16 @@ enum class SemanticWarningCode
     OverridenFunc,
 };
 
-class SemanticMessage
+std::string SemanticErrorCodeToStr(SemanticErrorCode code);
+std::string SemanticWarningCodeToStr(SemanticWarningCode code);
+
+// the messages are stored with their tokens and only formatted when they are printed
+class SemanticMessage : public LazyMessage
 {
 public:
-    virtual void SendToMessagePrinter() = 0;
+    // line at which the message is sorted when printed
+    virtual size_t GetLine() const = 0;
+    void SendToMessagePrinter();
 };
 
 // Warnings ////////////////////////////////////////////////////////////////////////
@@ -57,9 +67,12 @@ class SemanticWarning : public SemanticMessage
 {
 public:
     SemanticWarning(SemanticWarningCode code);
+    virtual ~SemanticWarning() = default;
     SemanticWarningCode GetWarningCode() const;
     virtual std::string GetMessage() const = 0;
-    std::string ToString() const;
+
+protected:
+    virtual std::string Format() const override;
 
 private:
     SemanticWarningCode m_warningCode;
@@ -71,7 +84,7 @@ public:
     TokenBasedWarning(SemanticWarningCode code, const Token& t);
     const Token& GetToken() const;
 
-    virtual void SendToMessagePrinter() override;
+    virtual size_t GetLine() const override;
 
 private:
     Token m_token;
@@ -101,7 +114,7 @@ class OverloadedMemFuncWarn : public TokenPairBasedWarning
 public:
     OverloadedMemFuncWarn(const Token& classID, const Token& funcName);
     virtual std::string GetMessage() const override;
-    virtual void SendToMessagePrinter() override;
+    virtual size_t GetLine() const override;
 };
 
 class OverloadedConstructorWarn : public TokenBasedWarning
@@ -116,7 +129,7 @@ class MemOverShadowingMemWarn : public TokenPairBasedWarning
 public:
     MemOverShadowingMemWarn(const Token& classID, const Token& member);
     virtual std::string GetMessage() const override;
-    virtual void SendToMessagePrinter() override;
+    virtual size_t GetLine() const override;
 };
 
 class LocalVarOverShadowingMem : public TokenPairBasedWarning
@@ -124,7 +137,7 @@ class LocalVarOverShadowingMem : public TokenPairBasedWarning
 public:
     LocalVarOverShadowingMem(const Token& classID, const Token& localVar);
     virtual std::string GetMessage() const override;
-    virtual void SendToMessagePrinter() override;
+    virtual size_t GetLine() const override;
 };
 
 class MainHasParametersWarn : public SemanticWarning
@@ -132,7 +145,7 @@ class MainHasParametersWarn : public SemanticWarning
 public:
     MainHasParametersWarn();
     virtual std::string GetMessage() const override;
-    virtual void SendToMessagePrinter() override;
+    virtual size_t GetLine() const override;
 };
 
 class OverridenFuncWarn : public TokenBasedWarning
@@ -153,9 +166,12 @@ class SemanticError : public SemanticMessage
 {
 public:
     SemanticError(SemanticErrorCode errorCode);
+    virtual ~SemanticError() = default;
     SemanticErrorCode GetErrorCode() const;
     virtual std::string GetMessage() const = 0;
-    std::string ToString() const;
+
+protected:
+    virtual std::string Format() const override;
 
 private:
     SemanticErrorCode m_errorCode;
@@ -167,7 +183,7 @@ public:
     TokenBasedError(SemanticErrorCode errorCode, const Token& token);
     
     const Token& GetToken() const;
-    virtual void SendToMessagePrinter() override;
+    virtual size_t GetLine() const override;
 private:
     Token m_token;
 };
@@ -184,7 +200,7 @@ class DuplicateSymbolError : public SemanticError
 public:
     DuplicateSymbolError(const Token& token1, const Token& token2);
     virtual std::string GetMessage() const override; 
-    virtual void SendToMessagePrinter() override;
+    virtual size_t GetLine() const override;
 private:
     Token m_originalToken;
     Token m_duplicateToken;
@@ -204,7 +220,7 @@ public:
     MemberFunctionDeclNotFound(const Token& classID, const Token& funcName);
     virtual std::string GetMessage() const override;
 
-    virtual void SendToMessagePrinter() override;
+    virtual size_t GetLine() const override;
 
 private:
     Token m_classIDToken;
@@ -216,7 +232,7 @@ class MemFuncDefNotFoundError : public SemanticError
 public:
     MemFuncDefNotFoundError(const Token& classID, const Token& funcName);
     virtual std::string GetMessage() const override;
-    virtual void SendToMessagePrinter() override;
+    virtual size_t GetLine() const override;
 
 private:
     Token m_classID;
@@ -228,7 +244,7 @@ class ConstructorDefNotFoundError : public SemanticError
 public:
     ConstructorDefNotFoundError(const Token& classID, const Token& constructorToken);
     virtual std::string GetMessage() const override;
-    virtual void SendToMessagePrinter() override;
+    virtual size_t GetLine() const override;
 
 private:
     Token m_classID;
@@ -259,7 +275,7 @@ class InvalidOperandForOperatorError : public SemanticError
 public:
     InvalidOperandForOperatorError(BaseBinaryOperator* operatorNode);
     virtual std::string GetMessage() const override;
-    virtual void SendToMessagePrinter() override;
+    virtual size_t GetLine() const override;
 
 private:
     BaseBinaryOperator* m_node;
@@ -270,7 +286,7 @@ class InvalidTypeMatchupForAssignError : public SemanticError
 public:
     InvalidTypeMatchupForAssignError(AssignStatNode* assignNode);
     virtual std::string GetMessage() const override;
-    virtual void SendToMessagePrinter() override;
+    virtual size_t GetLine() const override;
 
 private:
     AssignStatNode* m_node;
@@ -282,7 +298,7 @@ public:
     IncorrectParametersProvidedToFuncCallError(FuncCallNode* funcCall);
     IncorrectParametersProvidedToFuncCallError(TypeNode* classType, AParamListNode* params);
     virtual std::string GetMessage() const override;
-    virtual void SendToMessagePrinter() override;
+    virtual size_t GetLine() const override;
 
 private:
     FuncCallNode* m_node;
@@ -333,7 +349,7 @@ class IncorrectNumberOfMainFuncError : public SemanticError
 public:
     IncorrectNumberOfMainFuncError();
     virtual std::string GetMessage() const override;
-    virtual void SendToMessagePrinter() override;
+    virtual size_t GetLine() const override;
 };
 
 class ArrayIndexingTypeError : public TokenBasedError
@@ -365,6 +381,26 @@ public:
     virtual std::string GetMessage() const override;
 };
 
+// keeps the errors and warnings found on a thread so they can be added 
+// to the SemanticErrorManager later in a deterministic order
+class SemanticMessageBuffer
+{
+    friend class SemanticErrorManager;
+public:
+    SemanticMessageBuffer();
+    SemanticMessageBuffer(const SemanticMessageBuffer&) = delete;
+    ~SemanticMessageBuffer();
+
+    // can be read while another thread adds messages to the buffer
+    size_t GetNumErrors() const;
+
+private:
+    // only one of the error or the warning is set for each message
+    std::vector<std::pair<SemanticError*, SemanticWarning*>> m_messages;
+    std::atomic<size_t> m_numErrors;
+};
+
+// keeps the errors and warnings in the current DiagnosticsContext
 class SemanticErrorManager
 {
 public:
@@ -372,17 +408,18 @@ public:
     static void AddWarning(SemanticWarning* warning);
     static bool HasError();
     static void LogData();
+    // the messages are only logged if a file path was set
     static void SetFilePath(const std::string& filepath);
-    static void Clear();
+
+    // while a buffer is set for the calling thread, the errors and warnings 
+    // it adds are kept in the buffer instead
+    static void SetThreadBuffer(SemanticMessageBuffer* buffer);
+
+    // adds the messages of the buffer in the order they were found and empties it
+    static void AddBufferedMessages(SemanticMessageBuffer& buffer);
 
 private:
     SemanticErrorManager();
-    ~SemanticErrorManager();
-    
-
-    static SemanticErrorManager& GetInstance();
 
-    std::list<SemanticError*> m_errors;
-    std::list<SemanticWarning*> m_warnings;
-    std::string m_filepath;
+    static thread_local SemanticMessageBuffer* s_threadBuffer;
 };
\ No newline at end of file
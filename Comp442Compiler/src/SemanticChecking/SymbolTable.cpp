@@ -4,6 +4,8 @@
 #include "../Core/Core.h"
 #include "../CodeGeneration/CodeGeneration.h"
 
+#include <unordered_set>
+
 // SymbolTableEntryKind ////////////////////////////////////////////////////////
 
 std::ostream& operator<<(std::ostream& stream, SymbolTableEntryKind kind)
@@ -64,15 +66,19 @@ std::ostream& operator<<(std::ostream& stream, SymbolTableEntryKind kind)
 // SymbolTableEntry //////////////////////////////////////////
 
 SymbolTableEntry::SymbolTableEntry(SymbolTableEntryKind kind) 
-    : m_kind(kind), m_parentTable(nullptr), m_size(InvalidSize) { }
+    : m_name(NameTable::EmptyNameID), m_kind(kind), m_parentTable(nullptr), 
+    m_size(InvalidSize) { }
 
 SymbolTableEntry::~SymbolTableEntry() { }
 
-const std::string& SymbolTableEntry::GetName() const { return m_name; }
+const std::string& SymbolTableEntry::GetName() const { return NameTable::GetStr(m_name); }
+NameID SymbolTableEntry::GetNameID() const { return m_name; }
+
+TypeID SymbolTableEntry::GetEvaluatedTypeID() const { return TypeTable::GetInvalidType(); }
 
-std::string SymbolTableEntry::GetEvaluatedType() const
+const std::string& SymbolTableEntry::GetEvaluatedType() const
 {
-    return ASTNode::InvalidType;
+    return TypeTable::GetTypeStr(GetEvaluatedTypeID());
 }
 
 SymbolTableEntryKind SymbolTableEntry::GetKind() const { return m_kind; }
@@ -84,11 +90,20 @@ void SymbolTableEntry::SetSize(size_t size) { m_size = size; }
 int SymbolTableEntry::GetOffset() const { return m_offset; }
 void SymbolTableEntry::SetOffset(int offset) { m_offset = offset; }
 
-void SymbolTableEntry::SetName(const std::string& name) { m_name = name; }
+void SymbolTableEntry::SetName(const std::string& name) 
+{ 
+    NameID newName = NameTable::GetID(name);
+    if (m_parentTable != nullptr)
+    {
+        m_parentTable->RenameEntry(this, newName);
+        return;
+    }
+    m_name = newName;
+}
 
 // VarSymbolTableEntry /////////////////////////////////////////////////////////////////
-VarSymbolTableEntry::VarSymbolTableEntry(VarDeclNode* node, const std::string& typeStr,
-    SymbolTableEntryKind kind) : SymbolTableEntry(kind), m_node(node), m_typeStr(typeStr)
+VarSymbolTableEntry::VarSymbolTableEntry(VarDeclNode* node, TypeID type,
+    SymbolTableEntryKind kind) : SymbolTableEntry(kind), m_node(node), m_type(type)
 {
     SetName(m_node->GetID()->GetID().GetLexeme());
 }
@@ -96,10 +111,10 @@ VarSymbolTableEntry::VarSymbolTableEntry(VarDeclNode* node, const std::string& t
 
 const std::string& VarSymbolTableEntry::GetType() const 
 { 
-    return m_typeStr; 
+    return TypeTable::GetTypeStr(m_type); 
 }
 
-std::string VarSymbolTableEntry::GetEvaluatedType() const { return GetType(); }
+TypeID VarSymbolTableEntry::GetEvaluatedTypeID() const { return m_type; }
 
 SymbolTable* VarSymbolTableEntry::GetSubTable() { return nullptr; }
 
@@ -128,7 +143,8 @@ void TagTableEntry::SetTag(const std::string& tag) { m_tag = tag; }
 FreeFuncTableEntry::FreeFuncTableEntry(FunctionDefNode* node, 
     const std::string& parametersType, SymbolTable* subTable) 
     : TagTableEntry(SymbolTableEntryKind::FreeFunction), m_subTable(subTable),
-    m_paramTypes(parametersType), m_funcNode(node)
+    m_paramTypes(parametersType), m_paramListID(TypeTable::GetParamListID(parametersType)), 
+    m_funcNode(node)
 {
     SetName(node->GetID()->GetID().GetLexeme());
     m_subTable->SetParentEntry(this);
@@ -142,8 +158,12 @@ const std::string& FreeFuncTableEntry::GetReturnType() const
 }
 
 const std::string& FreeFuncTableEntry::GetParamTypes() const { return m_paramTypes; }
+ParamListID FreeFuncTableEntry::GetParamListID() const { return m_paramListID; }
 
-std::string FreeFuncTableEntry::GetEvaluatedType() const { return GetReturnType(); }
+TypeID FreeFuncTableEntry::GetEvaluatedTypeID() const 
+{ 
+    return m_funcNode->GetReturnType()->GetEvaluatedTypeID(); 
+}
 
 SymbolTable* FreeFuncTableEntry::GetSubTable() { return m_subTable; }
 
@@ -172,9 +192,9 @@ ClassTableEntry::~ClassTableEntry()
     delete m_subTable;
 }
 
-std::string ClassTableEntry::GetEvaluatedType() const
+TypeID ClassTableEntry::GetEvaluatedTypeID() const
 {
-    return m_classNode->GetID()->GetID().GetLexeme();
+    return TypeTable::GetNamedType(m_classNode->GetID()->GetID().GetLexemeID());
 }
 
 SymbolTable* ClassTableEntry::GetSubTable() { return m_subTable; }
@@ -243,8 +263,8 @@ InheritanceListNode* InheritanceListEntry::GetNonConstNode() const
 
 // MemVarTableEntry /////////////////////////////////////////////////////////////////
 
-MemVarTableEntry::MemVarTableEntry(MemVarNode* node, const std::string& typeStr) 
-    : VarSymbolTableEntry(node, typeStr, SymbolTableEntryKind::MemVar) { }
+MemVarTableEntry::MemVarTableEntry(MemVarNode* node, TypeID type) 
+    : VarSymbolTableEntry(node, type, SymbolTableEntryKind::MemVar) { }
 
 const std::string& MemVarTableEntry::GetClassID() const
 {
@@ -275,7 +295,8 @@ MemVarNode* MemVarTableEntry::GetMemVarNode() const
 MemFuncTableEntry::MemFuncTableEntry(MemFuncDeclNode* node, 
     const std::string& parameterTypes) : TagTableEntry(SymbolTableEntryKind::MemFuncDecl),
     m_declaration(node), m_definition(nullptr), 
-    m_definitionSubTable(nullptr), m_parameterTypes(parameterTypes)
+    m_definitionSubTable(nullptr), m_parameterTypes(parameterTypes), 
+    m_paramListID(TypeTable::GetParamListID(parameterTypes))
 {
     SetName(node->GetID()->GetID().GetLexeme());
 }
@@ -305,7 +326,12 @@ const std::string& MemFuncTableEntry::GetParamTypes() const
     return m_parameterTypes;
 }
 
-std::string MemFuncTableEntry::GetEvaluatedType() const { return GetReturnType(); }
+ParamListID MemFuncTableEntry::GetParamListID() const { return m_paramListID; }
+
+TypeID MemFuncTableEntry::GetEvaluatedTypeID() const 
+{ 
+    return m_declaration->GetReturnType()->GetEvaluatedTypeID(); 
+}
 
 void MemFuncTableEntry::SetDefinition(MemFuncDefEntry* defEntry)
 {
@@ -337,7 +363,8 @@ std::string MemFuncTableEntry::ToString()
 
 MemFuncDefEntry::MemFuncDefEntry(MemFuncDefNode* def, const std::string& parameterTypes, 
     SymbolTable* subTable) : SymbolTableEntry(SymbolTableEntryKind::MemFuncDef), 
-    m_defNode(def), m_subTable(subTable), m_parameterTypes(parameterTypes)
+    m_defNode(def), m_subTable(subTable), m_parameterTypes(parameterTypes),
+    m_paramListID(TypeTable::GetParamListID(parameterTypes))
 {
     SetName(def->GetID()->GetID().GetLexeme());
 }
@@ -358,6 +385,7 @@ const std::string& MemFuncDefEntry::GetReturnType() const
 }
 
 const std::string& MemFuncDefEntry::GetParamTypes() const { return m_parameterTypes; }
+ParamListID MemFuncDefEntry::GetParamListID() const { return m_paramListID; }
 
 ASTNode* MemFuncDefEntry::GetNode() { return m_defNode; }
 SymbolTable* MemFuncDefEntry::GetSubTable() { return m_subTable; }
@@ -373,7 +401,7 @@ ConstructorTableEntry::ConstructorTableEntry(ConstructorDeclNode* node,
     const std::string& parameterTypes) 
     : TagTableEntry(SymbolTableEntryKind::ConstructorDecl), m_declaration(node),
     m_definition(nullptr), m_definitionSubTable(nullptr), 
-    m_parameterTypes(parameterTypes) 
+    m_parameterTypes(parameterTypes), m_paramListID(TypeTable::GetParamListID(parameterTypes))
 {
     SetName(GetClassID() + "::constructor");
 }
@@ -399,8 +427,13 @@ const std::string& ConstructorTableEntry::GetReturnType() const
 }
 
 const std::string& ConstructorTableEntry::GetParamTypes() const { return m_parameterTypes; }
+ParamListID ConstructorTableEntry::GetParamListID() const { return m_paramListID; }
 
-std::string ConstructorTableEntry::GetEvaluatedType() const { return GetReturnType(); }
+TypeID ConstructorTableEntry::GetEvaluatedTypeID() const 
+{ 
+    return TypeTable::GetNamedType(
+        ((ClassDefNode*)m_declaration->GetParent())->GetID()->GetID().GetLexemeID()); 
+}
 
 void ConstructorTableEntry::SetDefinition(ConstructorDefEntry* defEntry)
 {
@@ -438,7 +471,8 @@ std::string ConstructorTableEntry::ToString()
 ConstructorDefEntry::ConstructorDefEntry(ConstructorDefNode* node, 
     const std::string& parameterTypes, SymbolTable* subTable) 
     : SymbolTableEntry(SymbolTableEntryKind::ConstructorDef), m_defNode(node), 
-    m_parameterTypes(parameterTypes), m_subTable(subTable) 
+    m_parameterTypes(parameterTypes), m_paramListID(TypeTable::GetParamListID(parameterTypes)), 
+    m_subTable(subTable) 
 {
     SetName(node->GetID()->GetID().GetLexeme());
 }
@@ -459,6 +493,7 @@ const std::string& ConstructorDefEntry::GetReturnType() const
 }
 
 const std::string& ConstructorDefEntry::GetParamTypes() const { return m_parameterTypes; }
+ParamListID ConstructorDefEntry::GetParamListID() const { return m_paramListID; }
 ASTNode* ConstructorDefEntry::GetNode() { return m_defNode; }
 SymbolTable* ConstructorDefEntry::GetSubTable() { return m_subTable; }
 std::string ConstructorDefEntry::ToString() 
@@ -468,8 +503,8 @@ std::string ConstructorDefEntry::ToString()
 }
 
 // TempVarEntry /////////////////////////////////////////////////////////////////
-TempVarEntry::TempVarEntry(const std::string& typeStr, size_t size) 
-    : SymbolTableEntry(SymbolTableEntryKind::TempVar), m_type(typeStr)
+TempVarEntry::TempVarEntry(TypeID type, size_t size) 
+    : SymbolTableEntry(SymbolTableEntryKind::TempVar), m_type(type)
 {
     SetSize(size);
 }
@@ -485,18 +520,15 @@ void TempVarEntry::SetName(const std::string& name)
 std::string TempVarEntry::ToString()
 {
     std::stringstream ss;
-    ss << GetKind() << s_seperator << GetName() << s_seperator << m_type << s_seperator 
-        << GetSize() << s_seperator << GetOffset();
+    ss << GetKind() << s_seperator << GetName() << s_seperator << TypeTable::GetTypeStr(m_type) 
+        << s_seperator << GetSize() << s_seperator << GetOffset();
     return ss.str();
 }
 
 // RefEntry ///////////////////////////////////////////////////////////////
-RefEntry::RefEntry(size_t size) : TempVarEntry("reference", size) { }
+RefEntry::RefEntry(size_t size) : TempVarEntry(TypeTable::GetReferenceType(), size) { }
 
-std::string RefEntry::GetEvaluatedType() const
-{
-    return "reference";
-}
+TypeID RefEntry::GetEvaluatedTypeID() const { return TypeTable::GetReferenceType(); }
 
 // ReturnAddressEntry ///////////////////////////////////////////////////////
 ReturnAddressEntry::ReturnAddressEntry() : SymbolTableEntry(SymbolTableEntryKind::ReturnAddress) 
@@ -505,7 +537,7 @@ ReturnAddressEntry::ReturnAddressEntry() : SymbolTableEntry(SymbolTableEntryKind
     SetSize(PlatformSpecifications::GetAddressSize());
 }
 
-std::string ReturnAddressEntry::GetEvaluatedType() const { return "integer"; }
+TypeID ReturnAddressEntry::GetEvaluatedTypeID() const { return TypeTable::GetIntegerType(); }
 ASTNode* ReturnAddressEntry::GetNode() { return nullptr; }
 SymbolTable* ReturnAddressEntry::GetSubTable() { return nullptr; }
 
@@ -525,7 +557,10 @@ ReturnValueEntry::ReturnValueEntry(TagTableEntry* funcEntry) : SymbolTableEntry(
     SetName("returnValue");
 }
 
-std::string ReturnValueEntry::GetEvaluatedType() const { return m_funcEntry->GetEvaluatedType(); }
+TypeID ReturnValueEntry::GetEvaluatedTypeID() const 
+{ 
+    return m_funcEntry->GetEvaluatedTypeID(); 
+}
 ASTNode* ReturnValueEntry::GetNode() { return nullptr;  }
 SymbolTable* ReturnValueEntry::GetSubTable() { return nullptr; }
 
@@ -539,7 +574,27 @@ std::string ReturnValueEntry::ToString()
 
 // SymbolTable ////////////////////////////////////////////////////////////////////
 
-SymbolTable::SymbolTable(const std::string& name) : m_name(name), m_parentEntry(nullptr), m_nameGen(nullptr) { }
+// returns false if the entry cannot be called with parameters
+bool GetOverloadParamList(SymbolTableEntry* entry, ParamListID& outParamList)
+{
+    switch (entry->GetKind())
+    {
+    case SymbolTableEntryKind::FreeFunction:
+        outParamList = ((FreeFuncTableEntry*)entry)->GetParamListID();
+        return true;
+    case SymbolTableEntryKind::MemFuncDecl:
+        outParamList = ((MemFuncTableEntry*)entry)->GetParamListID();
+        return true;
+    case SymbolTableEntryKind::ConstructorDecl:
+        outParamList = ((ConstructorTableEntry*)entry)->GetParamListID();
+        return true;
+    default:
+        return false;
+    }
+}
+
+SymbolTable::SymbolTable(const std::string& name) : m_name(name), m_isLinearized(false), 
+    m_parentEntry(nullptr), m_nameGen(nullptr) { }
 
 SymbolTable::~SymbolTable()
 {
@@ -564,12 +619,21 @@ SymbolTableEntry* SymbolTable::AddEntry(SymbolTableEntry* entry)
         }
     }
 
+    // temporary entries are named before being indexed
+    if (dynamic_cast<TempVarEntry*>(entry) != nullptr)
+    {
+        entry->SetName(GenerateName());
+    }
+
     m_entries.push_back(entry);
+    m_index[entry->GetNameID()].push_back(entry);
     entry->m_parentTable = this;
 
-    if (dynamic_cast<TempVarEntry*>(entry) != nullptr)
+    ParamListID paramList;
+    if (GetOverloadParamList(entry, paramList))
     {
-        entry->SetName(GenerateName());
+        // emplace keeps the earlier entry with the same signature
+        m_overloads[entry->GetNameID()].emplace(paramList, entry);
     }
 
     return nullptr;
@@ -586,7 +650,15 @@ SymbolTableEntry* SymbolTable::AddEntryFirst(SymbolTableEntry* entry)
     }
 
     m_entries.push_front(entry);
+    std::vector<SymbolTableEntry*>& sameNameEntries = m_index[entry->GetNameID()];
+    sameNameEntries.insert(sameNameEntries.begin(), entry);
     entry->m_parentTable = this;
+
+    ParamListID paramList;
+    if (GetOverloadParamList(entry, paramList))
+    {
+        m_overloads[entry->GetNameID()][paramList] = entry;
+    }
     return nullptr;
 }
 
@@ -604,18 +676,63 @@ void SymbolTable::SetParentEntry(SymbolTableEntry* entry) { m_parentEntry = entr
 
 SymbolTableEntry* SymbolTable::FindEntryInTable(const std::string& name)
 {
-    for (SymbolTableEntry* entry : m_entries)
+    // a name that was never interned cannot be the name of an entry
+    NameID id = NameTable::FindID(name);
+    if (id == NameTable::InvalidNameID)
     {
-        if (entry->GetName() == name)
-        {
-            return entry;
-        }
+        return nullptr;
     }
+    return FindEntryInTable(id);
+}
 
-    return nullptr;
+SymbolTableEntry* SymbolTable::FindEntryInTable(NameID name)
+{
+    auto it = m_index.find(name);
+    if (it == m_index.end() || it->second.empty())
+    {
+        return nullptr;
+    }
+    return it->second.front();
+}
+
+const std::vector<SymbolTableEntry*>& SymbolTable::FindAllEntriesInTable(NameID name)
+{
+    static const std::vector<SymbolTableEntry*> noEntries;
+    auto it = m_index.find(name);
+    if (it == m_index.end())
+    {
+        return noEntries;
+    }
+    return it->second;
+}
+
+SymbolTableEntry* SymbolTable::FindOverloadInTable(NameID name, ParamListID paramList)
+{
+    auto it = m_overloads.find(name);
+    if (it == m_overloads.end())
+    {
+        return nullptr;
+    }
+
+    auto overloadIt = it->second.find(paramList);
+    if (overloadIt == it->second.end())
+    {
+        return nullptr;
+    }
+    return overloadIt->second;
 }
 
 SymbolTableEntry* SymbolTable::FindEntryInScope(const std::string& name)
+{
+    NameID id = NameTable::FindID(name);
+    if (id == NameTable::InvalidNameID)
+    {
+        return nullptr;
+    }
+    return FindEntryInScope(id);
+}
+
+SymbolTableEntry* SymbolTable::FindEntryInScope(NameID name)
 {
     {
         SymbolTableEntry* entry = FindEntryInTable(name);
@@ -637,7 +754,7 @@ SymbolTableEntry* SymbolTable::FindEntryInScope(const std::string& name)
                 return entry;
             }
         }
-        else if (parentEntry->GetName() == name)
+        else if (parentEntry->GetNameID() == name)
         {
             return parentEntry;
         }
@@ -667,7 +784,7 @@ SymbolTable::TableIterator SymbolTable::end() { return m_entries.end(); }
 
 SymbolTableEntry* SymbolTable::FindExistingEntry(SymbolTableEntry* entry)
 {
-    SymbolTableEntry* originalEntry = FindEntryInTable(entry->GetName());
+    SymbolTableEntry* originalEntry = FindEntryInTable(entry->GetNameID());
     if (originalEntry == nullptr)
     {
         return nullptr;
@@ -679,7 +796,7 @@ SymbolTableEntry* SymbolTable::FindExistingEntry(SymbolTableEntry* entry)
         ConstructorTableEntry* originalConstructor = (ConstructorTableEntry*)originalEntry;
 
         ASSERT(entryConstructor->GetClassID() == originalConstructor->GetClassID());
-        if (entryConstructor->GetParamTypes() == originalConstructor->GetParamTypes())
+        if (entryConstructor->GetParamListID() == originalConstructor->GetParamListID())
         {
             return originalEntry;
         }
@@ -691,7 +808,7 @@ SymbolTableEntry* SymbolTable::FindExistingEntry(SymbolTableEntry* entry)
         FreeFuncTableEntry* func = (FreeFuncTableEntry*)entry;
         FreeFuncTableEntry* originalFunc = (FreeFuncTableEntry*)originalEntry;
 
-        if (func->GetParamTypes() == originalFunc->GetParamTypes())
+        if (func->GetParamListID() == originalFunc->GetParamListID())
         {
             return originalEntry;
         }
@@ -704,7 +821,7 @@ SymbolTableEntry* SymbolTable::FindExistingEntry(SymbolTableEntry* entry)
         MemFuncTableEntry* originalFunc = (MemFuncTableEntry*)originalEntry;
 
         ASSERT(func->GetClassID() == originalFunc->GetClassID());
-        if (func->GetParamTypes() == originalFunc->GetParamTypes())
+        if (func->GetParamListID() == originalFunc->GetParamListID())
         {
             return originalEntry;
         }
@@ -714,57 +831,123 @@ SymbolTableEntry* SymbolTable::FindExistingEntry(SymbolTableEntry* entry)
     return originalEntry;
 }
 
-SymbolTableEntry* SymbolTable::FindInInheritanceScope(const std::string& name)
+void SymbolTable::LinearizeInheritance()
 {
     ASSERT(GetParentEntry()->GetKind() == SymbolTableEntryKind::Class);
-    SymbolTable* globalTable = GetParentEntry()->GetParentTable();
-
-    std::list<ClassDefNode*> visitedClasses;
-    std::list<ClassDefNode*> stack;
-
-    visitedClasses.push_front((ClassDefNode*)GetParentEntry()->GetNode());
-    stack.push_front((ClassDefNode*)GetParentEntry()->GetNode());
+    m_inheritedMembers.clear();
+    for (SymbolTable* classTable : ComputeInheritanceOrder())
+    {
+        for (SymbolTableEntry* entry : *classTable)
+        {
+            // emplace keeps the first entry found for each name
+            m_inheritedMembers.emplace(entry->GetNameID(), classTable->
+                FindEntryInTable(entry->GetNameID()));
+        }
+    }
+    m_isLinearized = true;
+}
 
-    while (stack.size() > 0)
+SymbolTableEntry* SymbolTable::FindInInheritanceScope(NameID name)
+{
+    if (m_isLinearized)
     {
-        ClassDefNode* currClass = stack.front();
-        stack.pop_front();
+        auto it = m_inheritedMembers.find(name);
+        return it == m_inheritedMembers.end() ? nullptr : it->second;
+    }
 
-        SymbolTableEntry* entry = currClass->GetSymbolTable()->FindEntryInTable(name);
+    for (SymbolTable* classTable : ComputeInheritanceOrder())
+    {
+        SymbolTableEntry* entry = classTable->FindEntryInTable(name);
         if (entry != nullptr)
         {
             return entry;
         }
+    }
+    return nullptr;
+}
+
+std::vector<SymbolTable*> SymbolTable::ComputeInheritanceOrder()
+{
+    ASSERT(GetParentEntry()->GetKind() == SymbolTableEntryKind::Class);
+    SymbolTable* globalTable = GetParentEntry()->GetParentTable();
+
+    std::vector<SymbolTable*> order;
+    std::unordered_set<ClassDefNode*> visitedClasses;
+    std::vector<ClassDefNode*> stack;
+
+    visitedClasses.insert((ClassDefNode*)GetParentEntry()->GetNode());
+    stack.push_back((ClassDefNode*)GetParentEntry()->GetNode());
+
+    // depth first, the last base class of a class is searched first
+    while (stack.size() > 0)
+    {
+        ClassDefNode* currClass = stack.back();
+        stack.pop_back();
+        order.push_back(currClass->GetSymbolTable());
 
-        // push on stack other classes
         for (ASTNode* baseNode : currClass->GetInheritanceList()->GetChildren())
         {
             IDNode* id = (IDNode*) baseNode;
             SymbolTableEntry* classEntry = globalTable->
-                FindEntryInTable(id->GetID().GetLexeme());
+                FindEntryInTable(id->GetID().GetLexemeID());
 
-            ClassDefNode* classDef = (ClassDefNode*)classEntry->GetNode();
-
-            bool found = false;
-
-            for (ClassDefNode* classNode : visitedClasses)
+            // undefined base classes are reported by the semantic checker
+            if (classEntry == nullptr || classEntry->GetKind() != SymbolTableEntryKind::Class)
             {
-                if (classNode == classDef)
-                {
-                    found = true;
-                    break;
-                }
+                continue;
             }
 
-            if (!found)
+            ClassDefNode* classDef = (ClassDefNode*)classEntry->GetNode();
+            if (visitedClasses.insert(classDef).second)
             { 
-                visitedClasses.push_front(classDef);
-                stack.push_front(classDef);
+                stack.push_back(classDef);
             }
         }
     }
 
-    return nullptr;
+    return order;
+}
+
+void SymbolTable::RenameEntry(SymbolTableEntry* entry, NameID newName)
+{
+    NameID oldName = entry->GetNameID();
+    std::vector<SymbolTableEntry*>& oldNameEntries = m_index[oldName];
+    for (auto it = oldNameEntries.begin(); it != oldNameEntries.end(); it++)
+    {
+        if (*it == entry)
+        {
+            oldNameEntries.erase(it);
+            break;
+        }
+    }
+    entry->m_name = newName;
+
+    // renaming is rare so the entries with the new name are collected again in table order
+    std::vector<SymbolTableEntry*>& newNameEntries = m_index[newName];
+    newNameEntries.clear();
+    for (SymbolTableEntry* curr : m_entries)
+    {
+        if (curr->GetNameID() == newName)
+        {
+            newNameEntries.push_back(curr);
+        }
+    }
+
+    ReindexOverloads(oldName);
+    ReindexOverloads(newName);
+}
+
+void SymbolTable::ReindexOverloads(NameID name)
+{
+    m_overloads.erase(name);
+    for (SymbolTableEntry* entry : FindAllEntriesInTable(name))
+    {
+        ParamListID paramList;
+        if (GetOverloadParamList(entry, paramList))
+        {
+            m_overloads[name].emplace(paramList, entry);
+        }
+    }
 }
 
 std::string SymbolTable::GenerateName()
@@ -1,8 +1,12 @@
 #pragma once
 #include "../Core/Util.h"
+#include "../Core/NameTable.h"
+#include "TypeTable.h"
 
 #include <string>
 #include <list>
+#include <vector>
+#include <unordered_map>
 #include <iostream>
 
 class ASTNode;
@@ -49,7 +53,10 @@ public:
     virtual ~SymbolTableEntry();
 
     const std::string& GetName() const;
-    virtual std::string GetEvaluatedType() const;
+    NameID GetNameID() const;
+    // computed from the type ids of the nodes, GetEvaluatedType returns its string
+    virtual TypeID GetEvaluatedTypeID() const;
+    const std::string& GetEvaluatedType() const;
     SymbolTableEntryKind GetKind() const;
     SymbolTable* GetParentTable();
     virtual ASTNode* GetNode() = 0;
@@ -66,7 +73,7 @@ protected:
 
     void SetName(const std::string& name);
 private:
-    std::string m_name;
+    NameID m_name;
     SymbolTableEntryKind m_kind;
     SymbolTable* m_parentTable;
     size_t m_size;
@@ -76,11 +83,10 @@ private:
 class VarSymbolTableEntry : public SymbolTableEntry
 {
 public:
-    VarSymbolTableEntry(VarDeclNode* node, const std::string& typeStr, 
-        SymbolTableEntryKind kind);
+    VarSymbolTableEntry(VarDeclNode* node, TypeID type, SymbolTableEntryKind kind);
 
     const std::string& GetType() const;
-    virtual std::string GetEvaluatedType() const;
+    virtual TypeID GetEvaluatedTypeID() const override;
     virtual SymbolTable* GetSubTable() override;
     virtual ASTNode* GetNode() override;
     
@@ -88,7 +94,7 @@ public:
 
 private:
     VarDeclNode* m_node;
-    std::string m_typeStr;
+    TypeID m_type;
 };
 
 class ScopeTableEntry : public SymbolTableEntry
@@ -120,7 +126,8 @@ public:
 
     const std::string& GetReturnType() const;
     const std::string& GetParamTypes() const;
-    virtual std::string GetEvaluatedType() const;
+    ParamListID GetParamListID() const;
+    virtual TypeID GetEvaluatedTypeID() const override;
 
     virtual SymbolTable* GetSubTable() override;
     virtual ASTNode* GetNode() override;
@@ -130,6 +137,7 @@ private:
     SymbolTable* m_subTable;
     FunctionDefNode* m_funcNode;
     std::string m_paramTypes;
+    ParamListID m_paramListID;
 };
 
 class ClassTableEntry : public SymbolTableEntry
@@ -138,7 +146,7 @@ public:
     ClassTableEntry(ClassDefNode* node, SymbolTable* subTable);
     ~ClassTableEntry();
 
-    virtual std::string GetEvaluatedType() const;
+    virtual TypeID GetEvaluatedTypeID() const override;
     virtual SymbolTable* GetSubTable() override;
     
     virtual ASTNode* GetNode() override;
@@ -171,7 +179,7 @@ private:
 class MemVarTableEntry : public VarSymbolTableEntry
 {
 public:
-    MemVarTableEntry(MemVarNode* node, const std::string& typeStr);
+    MemVarTableEntry(MemVarNode* node, TypeID type);
     const std::string& GetClassID() const;
     const std::string& GetVisibility() const;
     virtual std::string ToString() override;
@@ -190,7 +198,8 @@ public:
     const std::string& GetVisibility() const;
     const std::string& GetReturnType() const;
     const std::string& GetParamTypes() const;
-    virtual std::string GetEvaluatedType() const;
+    ParamListID GetParamListID() const;
+    virtual TypeID GetEvaluatedTypeID() const override;
 
     void SetDefinition(MemFuncDefEntry* defEntry);
 
@@ -203,6 +212,7 @@ public:
 
 private:
     std::string m_parameterTypes;
+    ParamListID m_paramListID;
     MemFuncDeclNode* m_declaration;
     MemFuncDefNode* m_definition;
     SymbolTable* m_definitionSubTable;
@@ -220,6 +230,7 @@ public:
     const std::string& GetClassID() const;
     const std::string& GetReturnType() const;
     const std::string& GetParamTypes() const;
+    ParamListID GetParamListID() const;
 
     virtual ASTNode* GetNode() override;
     virtual SymbolTable* GetSubTable() override;
@@ -229,6 +240,7 @@ private:
     MemFuncDefNode* m_defNode;
     SymbolTable* m_subTable;
     std::string m_parameterTypes;
+    ParamListID m_paramListID;
 };
 
 class ConstructorTableEntry : public TagTableEntry
@@ -241,7 +253,8 @@ public:
     const std::string& GetVisibility() const;
     const std::string& GetReturnType() const;
     const std::string& GetParamTypes() const;
-    virtual std::string GetEvaluatedType() const;
+    ParamListID GetParamListID() const;
+    virtual TypeID GetEvaluatedTypeID() const override;
 
     void SetDefinition(ConstructorDefEntry* defEntry);
 
@@ -254,6 +267,7 @@ public:
 
 private:
     std::string m_parameterTypes;
+    ParamListID m_paramListID;
     ConstructorDeclNode* m_declaration;
     ConstructorDefNode* m_definition;
     SymbolTable* m_definitionSubTable;
@@ -271,6 +285,7 @@ public:
     const std::string& GetClassID() const;
     const std::string& GetReturnType() const;
     const std::string& GetParamTypes() const;
+    ParamListID GetParamListID() const;
 
     virtual ASTNode* GetNode() override;
     virtual SymbolTable* GetSubTable() override;
@@ -279,13 +294,14 @@ public:
 private:
     ConstructorDefNode* m_defNode;
     SymbolTable* m_subTable;
-    std::string m_parameterTypes;  
+    std::string m_parameterTypes;
+    ParamListID m_paramListID;
 };
 
 class TempVarEntry : public SymbolTableEntry
 {
 public:
-    TempVarEntry(const std::string& typeStr, size_t size);
+    TempVarEntry(TypeID type, size_t size);
     virtual ASTNode* GetNode() override;
     virtual SymbolTable* GetSubTable() override;
 
@@ -294,21 +310,21 @@ public:
     virtual std::string ToString() override;
 
 private:
-    std::string m_type;
+    TypeID m_type;
 };
 
 class RefEntry : public TempVarEntry
 {
 public:
     RefEntry(size_t size);
-    virtual std::string GetEvaluatedType() const override;
+    virtual TypeID GetEvaluatedTypeID() const override;
 };
 
 class ReturnAddressEntry : public SymbolTableEntry
 {
 public:
     ReturnAddressEntry();
-    virtual std::string GetEvaluatedType() const;
+    virtual TypeID GetEvaluatedTypeID() const override;
     virtual ASTNode* GetNode() override;
     virtual SymbolTable* GetSubTable() override;
 
@@ -319,7 +335,7 @@ class ReturnValueEntry : public SymbolTableEntry
 {
 public:
     ReturnValueEntry(TagTableEntry* funcEntry);
-    virtual std::string GetEvaluatedType() const;
+    virtual TypeID GetEvaluatedTypeID() const override;
     virtual ASTNode* GetNode() override;
     virtual SymbolTable* GetSubTable() override;
 
@@ -331,6 +347,7 @@ private:
 
 class SymbolTable
 {
+    friend class SymbolTableEntry;
 public:
     using TableList = std::list<SymbolTableEntry*>;
     using TableIterator = TableList::iterator;
@@ -351,7 +368,21 @@ public:
     // returns the entry with the provided name if it exists in the scope/ table 
     // or nullptr if it could not be found
     SymbolTableEntry* FindEntryInTable(const std::string& name);
+    SymbolTableEntry* FindEntryInTable(NameID name);
     SymbolTableEntry* FindEntryInScope(const std::string& name);
+    SymbolTableEntry* FindEntryInScope(NameID name);
+
+    // returns every entry of the table with the provided name in the order of the table
+    const std::vector<SymbolTableEntry*>& FindAllEntriesInTable(NameID name);
+
+    // returns the first free function, member function or constructor declaration of the 
+    // table with the provided name and parameter types or nullptr if there is none
+    SymbolTableEntry* FindOverloadInTable(NameID name, ParamListID paramList);
+
+    // for class tables, computes once the order in which the inherited classes are searched 
+    // and the members visible through inheritance, must be called once every class table 
+    // of the program is complete
+    void LinearizeInheritance();
 
     bool TableContainsName(const std::string& name);
     bool ScopeContainsName(const std::string& name);
@@ -364,12 +395,35 @@ private:
     // if such an entry already exists in the table or nullptr otherwise
     SymbolTableEntry* FindExistingEntry(SymbolTableEntry* entry);
 
-    SymbolTableEntry* FindInInheritanceScope(const std::string& name);
+    SymbolTableEntry* FindInInheritanceScope(NameID name);
+
+    // returns the class tables in the order they are searched for members, 
+    // starting with this table
+    std::vector<SymbolTable*> ComputeInheritanceOrder();
 
     std::string GenerateName();
 
+    // keeps the index up to date when an entry of the table is renamed
+    void RenameEntry(SymbolTableEntry* entry, NameID newName);
+
+    // collects again the overloads with the provided name from the name index
+    void ReindexOverloads(NameID name);
+
     std::string m_name;
     TableList m_entries;
+
+    // entries with the same name are kept in the order of m_entries, which is 
+    // the order used to display the table
+    std::unordered_map<NameID, std::vector<SymbolTableEntry*>> m_index;
+
+    // functions and constructors by name and parameter types, 
+    // only the first entry in table order is kept for each signature
+    std::unordered_map<NameID, std::unordered_map<ParamListID, SymbolTableEntry*>> m_overloads;
+
+    // first entry found for each name in the inheritance order, 
+    // only used once m_isLinearized is set
+    std::unordered_map<NameID, SymbolTableEntry*> m_inheritedMembers;
+    bool m_isLinearized;
     SymbolTableEntry* m_parentEntry;
     TagGenerator* m_nameGen;
 };
@@ -0,0 +1,289 @@
+#include "TypeTable.h"
+#include "../Core/Core.h"
+
+#include <cstdlib>
+#include <mutex>
+
+// TypeInfo ////////////////////////////////////////////////////////
+TypeInfo::TypeInfo(const std::string& typeStr, TypeID baseType,
+    const std::vector<size_t>& dimensions) : m_typeStr(typeStr),
+    m_baseType(baseType), m_dimensions(dimensions) { }
+
+const std::string& TypeInfo::GetTypeStr() const { return m_typeStr; }
+TypeID TypeInfo::GetBaseType() const { return m_baseType; }
+const std::vector<size_t>& TypeInfo::GetDimensions() const { return m_dimensions; }
+bool TypeInfo::IsArray() const { return m_dimensions.size() > 0; }
+
+// TypeTable ///////////////////////////////////////////////////////
+TypeID TypeTable::GetTypeID(const std::string& typeStr)
+{
+    TypeTable& table = GetInstance();
+    {
+        std::shared_lock<std::shared_mutex> readLock(table.m_mutex);
+        auto it = table.m_typeIDs.find(typeStr);
+        if (it != table.m_typeIDs.end())
+        {
+            return it->second;
+        }
+    }
+
+    std::unique_lock<std::shared_mutex> writeLock(table.m_mutex);
+    return table.FindOrAddType(typeStr);
+}
+
+const TypeInfo& TypeTable::GetTypeInfo(TypeID type)
+{
+    TypeTable& table = GetInstance();
+    std::shared_lock<std::shared_mutex> readLock(table.m_mutex);
+    ASSERT(type < table.m_types.size());
+    return table.m_types[type];
+}
+
+TypeID TypeTable::GetNamedType(NameID name)
+{
+    TypeTable& table = GetInstance();
+    {
+        std::shared_lock<std::shared_mutex> readLock(table.m_mutex);
+        auto it = table.m_namedTypeIDs.find(name);
+        if (it != table.m_namedTypeIDs.end())
+        {
+            return it->second;
+        }
+    }
+
+    const std::string& typeStr = NameTable::GetStr(name);
+    std::unique_lock<std::shared_mutex> writeLock(table.m_mutex);
+    TypeID id = table.FindOrAddType(typeStr);
+    table.m_namedTypeIDs[name] = id;
+    return id;
+}
+
+TypeID TypeTable::GetArrayType(TypeID baseType, const std::vector<size_t>& dimensions)
+{
+    if (dimensions.empty())
+    {
+        return baseType;
+    }
+
+    TypeTable& table = GetInstance();
+    {
+        std::shared_lock<std::shared_mutex> readLock(table.m_mutex);
+        auto baseIt = table.m_arrayTypeIDs.find(baseType);
+        if (baseIt != table.m_arrayTypeIDs.end())
+        {
+            auto it = baseIt->second.find(dimensions);
+            if (it != baseIt->second.end())
+            {
+                return it->second;
+            }
+        }
+    }
+
+    std::unique_lock<std::shared_mutex> writeLock(table.m_mutex);
+    return table.FindOrAddArrayType(baseType, dimensions);
+}
+
+TypeID TypeTable::GetIndexedType(TypeID arrayType, size_t numIndices)
+{
+    if (numIndices == 0)
+    {
+        return arrayType;
+    }
+
+    const TypeInfo& info = GetTypeInfo(arrayType);
+    const std::vector<size_t>& dimensions = info.GetDimensions();
+    if (numIndices > dimensions.size())
+    {
+        return s_invalidType;
+    }
+    
+    std::vector<size_t> remainingDimensions(dimensions.begin() + numIndices, dimensions.end());
+    return GetArrayType(info.GetBaseType(), remainingDimensions);
+}
+
+const std::string& TypeTable::GetTypeStr(TypeID type) { return GetTypeInfo(type).GetTypeStr(); }
+TypeID TypeTable::GetBaseType(TypeID type) { return GetTypeInfo(type).GetBaseType(); }
+bool TypeTable::IsArray(TypeID type) { return GetTypeInfo(type).IsArray(); }
+
+ParamListID TypeTable::GetParamListID(const std::string& paramTypesStr)
+{
+    TypeTable& table = GetInstance();
+    {
+        std::shared_lock<std::shared_mutex> readLock(table.m_mutex);
+        auto it = table.m_paramListIDs.find(paramTypesStr);
+        if (it != table.m_paramListIDs.end())
+        {
+            return it->second;
+        }
+    }
+
+    std::vector<TypeID> paramTypes;
+    size_t start = 0;
+    while (start < paramTypesStr.length())
+    {
+        size_t end = paramTypesStr.find(", ", start);
+        if (end == std::string::npos)
+        {
+            end = paramTypesStr.length();
+        }
+        paramTypes.push_back(GetTypeID(paramTypesStr.substr(start, end - start)));
+        start = end + 2;
+    }
+
+    // another thread may have added the same param list while the types were looked up
+    std::unique_lock<std::shared_mutex> writeLock(table.m_mutex);
+    auto it = table.m_paramListIDs.find(paramTypesStr);
+    if (it != table.m_paramListIDs.end())
+    {
+        return it->second;
+    }
+
+    auto typesIt = table.m_paramListIDsByTypes.find(paramTypes);
+    if (typesIt != table.m_paramListIDsByTypes.end())
+    {
+        table.m_paramListIDs[paramTypesStr] = typesIt->second;
+        return typesIt->second;
+    }
+
+    ParamListID id = table.m_paramLists.size();
+    table.m_paramLists.push_back(paramTypes);
+    table.m_paramListIDs[paramTypesStr] = id;
+    table.m_paramListIDsByTypes[paramTypes] = id;
+    return id;
+}
+
+const std::vector<TypeID>& TypeTable::GetParamTypes(ParamListID paramList)
+{
+    TypeTable& table = GetInstance();
+    std::shared_lock<std::shared_mutex> readLock(table.m_mutex);
+    ASSERT(paramList < table.m_paramLists.size());
+    return table.m_paramLists[paramList];
+}
+
+ParamListID TypeTable::FindParamListID(const std::vector<TypeID>& paramTypes)
+{
+    TypeTable& table = GetInstance();
+    std::shared_lock<std::shared_mutex> readLock(table.m_mutex);
+    auto it = table.m_paramListIDsByTypes.find(paramTypes);
+    if (it == table.m_paramListIDsByTypes.end())
+    {
+        return InvalidParamListID;
+    }
+    return it->second;
+}
+
+void TypeTable::Reset()
+{
+    TypeTable& table = GetInstance();
+    std::unique_lock<std::shared_mutex> writeLock(table.m_mutex);
+    table.m_typeIDs.clear();
+    table.m_types.clear();
+    table.m_namedTypeIDs.clear();
+    table.m_arrayTypeIDs.clear();
+    table.m_paramListIDsByTypes.clear();
+    table.m_paramListIDs.clear();
+    table.m_paramLists.clear();
+    table.AddBuiltInTypes();
+}
+
+TypeTable::TypeTable()
+{
+    AddBuiltInTypes();
+}
+
+TypeTable& TypeTable::GetInstance()
+{
+    static TypeTable table;
+    return table;
+}
+
+void TypeTable::AddBuiltInTypes()
+{
+    AddType("");
+    AddType("integer");
+    AddType("float");
+    AddType("void");
+    AddType("reference");
+    ASSERT(m_typeIDs[""] == s_invalidType && m_typeIDs["integer"] == s_integerType
+        && m_typeIDs["float"] == s_floatType && m_typeIDs["void"] == s_voidType
+        && m_typeIDs["reference"] == s_referenceType);
+}
+
+TypeID TypeTable::FindOrAddType(const std::string& typeStr)
+{
+    auto it = m_typeIDs.find(typeStr);
+    if (it != m_typeIDs.end())
+    {
+        return it->second;
+    }
+    return AddType(typeStr);
+}
+
+TypeID TypeTable::AddType(const std::string& typeStr)
+{
+    size_t bracketPos = typeStr.find('[');
+    TypeID baseType;
+    std::vector<size_t> dimensions;
+
+    if (bracketPos == std::string::npos)
+    {
+        // a non array type is its own base type
+        baseType = m_types.size();
+    }
+    else
+    {
+        baseType = FindOrAddType(typeStr.substr(0, bracketPos));
+        while (bracketPos != std::string::npos)
+        {
+            size_t closingPos = typeStr.find(']', bracketPos);
+            ASSERT(closingPos != std::string::npos);
+            if (closingPos == bracketPos + 1)
+            {
+                dimensions.push_back(UnspecifiedDimension);
+            }
+            else
+            {
+                dimensions.push_back((size_t)std::strtoull(typeStr.c_str() + bracketPos + 1,
+                    nullptr, 10));
+            }
+            bracketPos = typeStr.find('[', closingPos);
+        }
+    }
+
+    TypeID id = m_types.size();
+    if (!dimensions.empty())
+    {
+        m_arrayTypeIDs[baseType].emplace(dimensions, id);
+    }
+    m_types.emplace_back(typeStr, baseType, dimensions);
+    m_typeIDs[typeStr] = id;
+    return id;
+}
+
+TypeID TypeTable::FindOrAddArrayType(TypeID baseType, const std::vector<size_t>& dimensions)
+{
+    auto baseIt = m_arrayTypeIDs.find(baseType);
+    if (baseIt != m_arrayTypeIDs.end())
+    {
+        auto it = baseIt->second.find(dimensions);
+        if (it != baseIt->second.end())
+        {
+            return it->second;
+        }
+    }
+
+    ASSERT(baseType < m_types.size());
+    std::string typeStr = m_types[baseType].GetTypeStr();
+    for (size_t dimension : dimensions)
+    {
+        if (dimension == UnspecifiedDimension)
+        {
+            typeStr += "[]";
+        }
+        else
+        {
+            typeStr += "[" + std::to_string(dimension) + "]";
+        }
+    }
+    return FindOrAddType(typeStr);
+}
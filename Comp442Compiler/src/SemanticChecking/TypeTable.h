@@ -0,0 +1,117 @@
+#pragma once
+#include <string>
+#include <vector>
+#include <deque>
+#include <unordered_map>
+#include <map>
+#include <shared_mutex>
+#include <cstdint>
+
+#include "../Core/NameTable.h"
+
+typedef size_t TypeID;
+typedef size_t ParamListID;
+
+constexpr ParamListID InvalidParamListID = SIZE_MAX;
+
+// dimension used for arrays declared without a size (ex: integer[]), distinct from 
+// the size 0 so "integer[]" and "integer[0]" stay different types
+constexpr size_t UnspecifiedDimension = SIZE_MAX;
+
+class TypeInfo
+{
+public:
+    TypeInfo(const std::string& typeStr, TypeID baseType, const std::vector<size_t>& dimensions);
+
+    const std::string& GetTypeStr() const;
+    TypeID GetBaseType() const;
+    const std::vector<size_t>& GetDimensions() const;
+    bool IsArray() const;
+
+private:
+    std::string m_typeStr;
+    TypeID m_baseType;
+    std::vector<size_t> m_dimensions;
+};
+
+// interns every type string ("integer", "float[3][]", class names, ...) so types can be
+// compared and queried without manipulating strings, the table can be used from 
+// several threads
+class TypeTable
+{
+public:
+    // returns the id of the provided type string, adding it to the table if needed
+    static TypeID GetTypeID(const std::string& typeStr);
+    static const TypeInfo& GetTypeInfo(TypeID type);
+
+    // returns the id of the type named by an interned name (ex: "integer" or a class name) 
+    // without hashing its string once the name was seen
+    static TypeID GetNamedType(NameID name);
+
+    // returns the id of the array of baseType with the provided dimensions 
+    // or baseType itself if there is no dimension
+    static TypeID GetArrayType(TypeID baseType, const std::vector<size_t>& dimensions);
+
+    // returns the type of the elements of the array once its first numIndices dimensions 
+    // are indexed or the invalid type if the array has fewer dimensions
+    static TypeID GetIndexedType(TypeID arrayType, size_t numIndices);
+
+    static const std::string& GetTypeStr(TypeID type);
+    static TypeID GetBaseType(TypeID type);
+    static bool IsArray(TypeID type);
+
+    // param lists are strings of the form "integer, float[3]"
+    static ParamListID GetParamListID(const std::string& paramTypesStr);
+    static const std::vector<TypeID>& GetParamTypes(ParamListID paramList);
+
+    // returns the id of the param list made of the provided types or InvalidParamListID 
+    // if no param list with these types was ever added
+    static ParamListID FindParamListID(const std::vector<TypeID>& paramTypes);
+
+    // removes every type and param list except the built in types so a long running 
+    // process does not keep the types of the files it compiled, no compilation can be running 
+    // and the name table must be reset at the same time
+    static void Reset();
+
+    static constexpr TypeID GetInvalidType() { return s_invalidType; }
+    static constexpr TypeID GetIntegerType() { return s_integerType; }
+    static constexpr TypeID GetFloatType() { return s_floatType; }
+    static constexpr TypeID GetVoidType() { return s_voidType; }
+
+    // type of the temp vars holding the address of another variable
+    static constexpr TypeID GetReferenceType() { return s_referenceType; }
+
+private:
+    TypeTable();
+
+    static TypeTable& GetInstance();
+
+    // the write lock must be held
+    TypeID FindOrAddType(const std::string& typeStr);
+    TypeID AddType(const std::string& typeStr);
+    TypeID FindOrAddArrayType(TypeID baseType, const std::vector<size_t>& dimensions);
+    void AddBuiltInTypes();
+
+    static constexpr TypeID s_invalidType = 0;
+    static constexpr TypeID s_integerType = 1;
+    static constexpr TypeID s_floatType = 2;
+    static constexpr TypeID s_voidType = 3;
+    static constexpr TypeID s_referenceType = 4;
+
+    // deques are used so references to the stored types stay valid when new types are added
+    std::deque<TypeInfo> m_types;
+    std::unordered_map<std::string, TypeID> m_typeIDs;
+
+    // the same types indexed by their structure so nodes and symbol entries 
+    // never build a type string to find their type
+    std::unordered_map<NameID, TypeID> m_namedTypeIDs;
+    std::unordered_map<TypeID, std::map<std::vector<size_t>, TypeID>> m_arrayTypeIDs;
+
+    std::deque<std::vector<TypeID>> m_paramLists;
+    std::unordered_map<std::string, ParamListID> m_paramListIDs;
+
+    // every param list string with the same types maps to the same id
+    std::map<std::vector<TypeID>, ParamListID> m_paramListIDsByTypes;
+
+    std::shared_mutex m_mutex;
+};
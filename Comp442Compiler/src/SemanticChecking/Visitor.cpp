@@ -3,8 +3,15 @@
 #include "../Parser/AST.h"
 #include "../Parser/ASTUtil.h"
 #include "../Core/Core.h"
+#include "../Core/ErrorLimit.h"
+#include "../Core/DiagnosticsContext.h"
+#include "../Core/WorkerThreads.h"
 
 #include <sstream>
+#include <algorithm>
+#include <unordered_map>
+#include <thread>
+#include <atomic>
 
 // Helpers /////////////////////////////////////////////////////
 
@@ -82,6 +89,7 @@ SymbolTableEntry* FindEntryInInheritanceTree(SymbolTable* globalTable,
         return nullptr;
     }
 
+    ParamListID paramList = TypeTable::GetParamListID(params);
     std::list<std::string> classesVerified;
     std::list<IDNode*> queue;
     {
@@ -101,7 +109,7 @@ SymbolTableEntry* FindEntryInInheritanceTree(SymbolTable* globalTable,
         IDNode* currClassID = queue.front();
         queue.pop_front();
         SymbolTable* currClassTable = globalTable->FindEntryInTable(
-            currClassID->GetID().GetLexeme())->GetSubTable();
+            currClassID->GetID().GetLexemeID())->GetSubTable();
         
         // check in current class if we find a member of the given kind and name
         {
@@ -114,14 +122,14 @@ SymbolTableEntry* FindEntryInInheritanceTree(SymbolTable* globalTable,
                     return entry;
                 
                 case SymbolTableEntryKind::MemFuncDecl:
-                    if (params == ((MemFuncTableEntry*)entry)->GetParamTypes())
+                    if (paramList == ((MemFuncTableEntry*)entry)->GetParamListID())
                     {
                         return entry;
                     }
                     break;
 
                 case SymbolTableEntryKind::ConstructorDecl:
-                    if (params == ((ConstructorTableEntry*)entry)->GetParamTypes())
+                    if (paramList == ((ConstructorTableEntry*)entry)->GetParamListID())
                     {
                         return entry;
                     }
@@ -159,8 +167,119 @@ SymbolTableEntry* FindEntryInInheritanceTree(SymbolTable* globalTable,
     return nullptr;
 }
 
+// edge of the graph of class dependencies, the member is nullptr for an inherited class
+struct ClassDependency
+{
+    size_t m_class;
+    SymbolTableEntry* m_member;
+};
+
+// returns the index of the strongly connected component of every vertex of the graph 
+// using an iterative version of Tarjan's algorithm
+std::vector<size_t> FindStronglyConnectedComponents(
+    const std::vector<std::vector<size_t>>& successors)
+{
+    constexpr size_t unvisited = SIZE_MAX;
+    std::vector<size_t> indices(successors.size(), unvisited);
+    std::vector<size_t> lowLinks(successors.size(), 0);
+    std::vector<size_t> components(successors.size(), unvisited);
+    std::vector<size_t> componentStack;
+
+    // vertex and index of its next successor to visit
+    std::vector<std::pair<size_t, size_t>> callStack;
+    size_t nextIndex = 0;
+    size_t nextComponent = 0;
+
+    for (size_t root = 0; root < successors.size(); root++)
+    {
+        if (indices[root] != unvisited)
+        {
+            continue;
+        }
+
+        indices[root] = lowLinks[root] = nextIndex++;
+        componentStack.push_back(root);
+        callStack.emplace_back(root, 0);
+
+        while (!callStack.empty())
+        {
+            size_t vertex = callStack.back().first;
+            size_t successorIndex = callStack.back().second;
+
+            if (successorIndex < successors[vertex].size())
+            {
+                callStack.back().second++;
+                size_t successor = successors[vertex][successorIndex];
+                if (indices[successor] == unvisited)
+                {
+                    indices[successor] = lowLinks[successor] = nextIndex++;
+                    componentStack.push_back(successor);
+                    callStack.emplace_back(successor, 0);
+                }
+                else if (components[successor] == unvisited)
+                {
+                    // the successor is still on the component stack
+                    lowLinks[vertex] = std::min(lowLinks[vertex], indices[successor]);
+                }
+                continue;
+            }
+
+            callStack.pop_back();
+            if (lowLinks[vertex] == indices[vertex])
+            {
+                size_t member;
+                do
+                {
+                    member = componentStack.back();
+                    componentStack.pop_back();
+                    components[member] = nextComponent;
+                } while (member != vertex);
+                nextComponent++;
+            }
+
+            if (!callStack.empty())
+            {
+                size_t caller = callStack.back().first;
+                lowLinks[caller] = std::min(lowLinks[caller], lowLinks[vertex]);
+            }
+        }
+    }
+
+    return components;
+}
+
+// returns, for each component, true if it contains more than one vertex or a vertex 
+// which is its own successor
+std::vector<bool> FindCyclicComponents(const std::vector<std::vector<size_t>>& successors, 
+    const std::vector<size_t>& components)
+{
+    std::vector<size_t> componentSizes(successors.size(), 0);
+    std::vector<bool> isCyclic(successors.size(), false);
+    for (size_t vertex = 0; vertex < successors.size(); vertex++)
+    {
+        componentSizes[components[vertex]]++;
+        for (size_t successor : successors[vertex])
+        {
+            if (successor == vertex)
+            {
+                isCyclic[components[vertex]] = true;
+            }
+        }
+    }
+
+    for (size_t component = 0; component < componentSizes.size(); component++)
+    {
+        if (componentSizes[component] > 1)
+        {
+            isCyclic[component] = true;
+        }
+    }
+    return isCyclic;
+}
+
 // SymbolTableAssembler ////////////////////////////////////////
-SymbolTableAssembler::SymbolTableAssembler() : m_globalScopeTable(nullptr) { }
+SymbolTableAssembler::SymbolTableAssembler() : m_globalScopeTable(nullptr), 
+    m_isGlobalEntriesReversed(false), m_isClassIndexOutdated(false) { }
 
 SymbolTableAssembler::~SymbolTableAssembler()
 {
@@ -168,12 +287,20 @@ SymbolTableAssembler::~SymbolTableAssembler()
     {
         delete entry;
     }
+    for (SymbolTableEntry* entry : m_globalEntries)
+    {
+        delete entry;
+    }
+    for (SymbolTableEntry* entry : m_unmatchedDefinitions)
+    {
+        delete entry;
+    }
     delete m_globalScopeTable;
 }
 
 void SymbolTableAssembler::Visit(VarDeclNode* element)
 {
-    SymbolTableEntry* entry = new VarSymbolTableEntry(element, VarDeclToTypeStr(element),
+    SymbolTableEntry* entry = new VarSymbolTableEntry(element, VarDeclToTypeID(element),
         SymbolTableEntryKind::LocalVariable);
 
     m_workingList.push_front(entry);
@@ -181,7 +308,7 @@ void SymbolTableAssembler::Visit(VarDeclNode* element)
 
 void SymbolTableAssembler::Visit(FParamNode* element)
 {
-    SymbolTableEntry* entry = new VarSymbolTableEntry(element, VarDeclToTypeStr(element),
+    SymbolTableEntry* entry = new VarSymbolTableEntry(element, VarDeclToTypeID(element),
         SymbolTableEntryKind::Parameter);
 
     m_workingList.push_front(entry);
@@ -190,33 +317,27 @@ void SymbolTableAssembler::Visit(FParamNode* element)
 void SymbolTableAssembler::Visit(FunctionDefNode* element)
 {
     SymbolTable* functionTable = new SymbolTable(element->GetID()->GetID().GetLexeme());
-    std::list<SymbolTableEntry*> entriesToKeep;
+    // the parameters and local variables of the function are the last entries visited
     std::list<SymbolTableEntry*> toDelete;
-    for (SymbolTableEntry* entry : m_workingList)
+    while (!m_workingList.empty() 
+        && (m_workingList.front()->GetKind() == SymbolTableEntryKind::LocalVariable 
+        || m_workingList.front()->GetKind() == SymbolTableEntryKind::Parameter))
     {
-        if (entry->GetKind() == SymbolTableEntryKind::LocalVariable 
-            || entry->GetKind() == SymbolTableEntryKind::Parameter)
-        {
-            SymbolTableEntry* originalEntry = functionTable->AddEntryFirst(entry);
-            if (originalEntry != nullptr)
-            {
-                VarDeclNode* originalNode = (VarDeclNode*)originalEntry->GetNode();
-                VarDeclNode* errorNode = (VarDeclNode*)entry->GetNode();
-                SemanticErrorManager::AddError(
-                    new DuplicateSymbolError(originalNode->GetID()->GetID(), 
-                    errorNode->GetID()->GetID()));
-                toDelete.push_front(entry);
-            }
-        }
-        else
+        SymbolTableEntry* entry = m_workingList.front();
+        m_workingList.pop_front();
+
+        SymbolTableEntry* originalEntry = functionTable->AddEntryFirst(entry);
+        if (originalEntry != nullptr)
         {
-            entriesToKeep.push_back(entry);
+            VarDeclNode* originalNode = (VarDeclNode*)originalEntry->GetNode();
+            VarDeclNode* errorNode = (VarDeclNode*)entry->GetNode();
+            SemanticErrorManager::AddError(
+                new DuplicateSymbolError(originalNode->GetID()->GetID(), 
+                errorNode->GetID()->GetID()));
+            toDelete.push_front(entry);
         }
     }
 
-    m_workingList.clear();
-    m_workingList = entriesToKeep;
-
     for (SymbolTableEntry* entry : toDelete)
     {
         delete entry;
@@ -227,12 +348,12 @@ void SymbolTableAssembler::Visit(FunctionDefNode* element)
 
     element->SetSymbolTable(functionTable);
 
-    m_workingList.push_front(entry);
+    PushGlobalEntry(entry);
 }
 
 void SymbolTableAssembler::Visit(MemVarNode* element)
 {
-    MemVarTableEntry* entry = new MemVarTableEntry(element, VarDeclToTypeStr(element));
+    MemVarTableEntry* entry = new MemVarTableEntry(element, VarDeclToTypeID(element));
     m_workingList.push_front(entry);
 }
 
@@ -240,27 +361,11 @@ void SymbolTableAssembler::Visit(MemFuncDeclNode* element)
 {
     // delete all parameters for this node since we will use 
     // the entries from the definition node
-    std::list<SymbolTableEntry*> entriesToDelete;
-    std::list<SymbolTableEntry*> entriesToKeep;
-    
-    for (SymbolTableEntry* entry : m_workingList)
-    {
-        if (entry->GetKind() == SymbolTableEntryKind::Parameter)
-        {
-            entriesToDelete.push_front(entry);
-        }
-        else
-        {
-            entriesToKeep.push_back(entry);
-        }
-    }
-
-    m_workingList.clear();
-    m_workingList = entriesToKeep;
-
-    for (SymbolTableEntry* entry : entriesToDelete)
+    while (!m_workingList.empty() 
+        && m_workingList.front()->GetKind() == SymbolTableEntryKind::Parameter)
     {
-        delete entry;
+        delete m_workingList.front();
+        m_workingList.pop_front();
     }
 
     MemFuncTableEntry* entry = new MemFuncTableEntry(element, 
@@ -278,33 +383,27 @@ void SymbolTableAssembler::Visit(MemFuncDefNode* element)
             + element->GetID()->GetID().GetLexeme());
     }
 
-    std::list<SymbolTableEntry*> entriesToKeep;
+    // the parameters and local variables of the function are the last entries visited
     std::list<SymbolTableEntry*> toDelete;
-    for (SymbolTableEntry* entry : m_workingList)
+    while (!m_workingList.empty() 
+        && (m_workingList.front()->GetKind() == SymbolTableEntryKind::LocalVariable 
+        || m_workingList.front()->GetKind() == SymbolTableEntryKind::Parameter))
     {
-        if (entry->GetKind() == SymbolTableEntryKind::LocalVariable 
-            || entry->GetKind() == SymbolTableEntryKind::Parameter)
-        {
-            SymbolTableEntry* originalEntry = functionTable->AddEntryFirst(entry);
-            if (originalEntry != nullptr)
-            {
-                VarDeclNode* originalNode = (VarDeclNode*)originalEntry->GetNode();
-                VarDeclNode* errorNode = (VarDeclNode*)entry->GetNode();
-                SemanticErrorManager::AddError(
-                    new DuplicateSymbolError(originalNode->GetID()->GetID(), 
-                    errorNode->GetID()->GetID()));
-                toDelete.push_front(entry);
-            }
-        }
-        else
+        SymbolTableEntry* entry = m_workingList.front();
+        m_workingList.pop_front();
+
+        SymbolTableEntry* originalEntry = functionTable->AddEntryFirst(entry);
+        if (originalEntry != nullptr)
         {
-            entriesToKeep.push_back(entry);
+            VarDeclNode* originalNode = (VarDeclNode*)originalEntry->GetNode();
+            VarDeclNode* errorNode = (VarDeclNode*)entry->GetNode();
+            SemanticErrorManager::AddError(
+                new DuplicateSymbolError(originalNode->GetID()->GetID(), 
+                errorNode->GetID()->GetID()));
+            toDelete.push_front(entry);
         }
     }
 
-    m_workingList.clear();
-    m_workingList = entriesToKeep;
-
     for (SymbolTableEntry* entry : toDelete)
     {
         delete entry;
@@ -315,8 +414,13 @@ void SymbolTableAssembler::Visit(MemFuncDefNode* element)
     
     element->SetSymbolTable(functionTable);
 
-    if (!TryMatchMemFuncDeclAndDef(entry))
+    if (TryMatchMemFuncDeclAndDef(entry))
     {
+        delete entry;
+    }
+    else
+    {
+        m_unmatchedDefinitions.push_back(entry);
         SemanticErrorManager::AddError(new MemberFunctionDeclNotFound(
             element->GetClassID()->GetID(), 
             element->GetID()->GetID()));
@@ -327,27 +431,11 @@ void SymbolTableAssembler::Visit(ConstructorDeclNode* element)
 {
     // delete all parameters for this node since we will use 
     // the entries from the definition node
-    std::list<SymbolTableEntry*> entriesToDelete;
-    std::list<SymbolTableEntry*> entriesToKeep;
-    
-    for (SymbolTableEntry* entry : m_workingList)
-    {
-        if (entry->GetKind() == SymbolTableEntryKind::Parameter)
-        {
-            entriesToDelete.push_front(entry);
-        }
-        else
-        {
-            entriesToKeep.push_back(entry);
-        }
-    }
-
-    m_workingList.clear();
-    m_workingList = entriesToKeep;
-
-    for (SymbolTableEntry* entry : entriesToDelete)
+    while (!m_workingList.empty() 
+        && m_workingList.front()->GetKind() == SymbolTableEntryKind::Parameter)
     {
-        delete entry;
+        delete m_workingList.front();
+        m_workingList.pop_front();
     }
 
     ConstructorTableEntry* entry = new ConstructorTableEntry(element, 
@@ -364,33 +452,27 @@ void SymbolTableAssembler::Visit(ConstructorDefNode* element)
         functionTable = new SymbolTable(className + "::constructor");
     }
 
-    std::list<SymbolTableEntry*> entriesToKeep;
+    // the parameters and local variables of the function are the last entries visited
     std::list<SymbolTableEntry*> toDelete;
-    for (SymbolTableEntry* entry : m_workingList)
+    while (!m_workingList.empty() 
+        && (m_workingList.front()->GetKind() == SymbolTableEntryKind::LocalVariable 
+        || m_workingList.front()->GetKind() == SymbolTableEntryKind::Parameter))
     {
-        if (entry->GetKind() == SymbolTableEntryKind::LocalVariable 
-            || entry->GetKind() == SymbolTableEntryKind::Parameter)
-        {
-            SymbolTableEntry* originalEntry = functionTable->AddEntryFirst(entry);
-            if (originalEntry != nullptr)
-            {
-                VarDeclNode* originalNode = (VarDeclNode*)originalEntry->GetNode();
-                VarDeclNode* errorNode = (VarDeclNode*)entry->GetNode();
-                SemanticErrorManager::AddError(
-                    new DuplicateSymbolError(originalNode->GetID()->GetID(), 
-                    errorNode->GetID()->GetID()));
-                toDelete.push_front(entry);
-            }
-        }
-        else
+        SymbolTableEntry* entry = m_workingList.front();
+        m_workingList.pop_front();
+
+        SymbolTableEntry* originalEntry = functionTable->AddEntryFirst(entry);
+        if (originalEntry != nullptr)
         {
-            entriesToKeep.push_back(entry);
+            VarDeclNode* originalNode = (VarDeclNode*)originalEntry->GetNode();
+            VarDeclNode* errorNode = (VarDeclNode*)entry->GetNode();
+            SemanticErrorManager::AddError(
+                new DuplicateSymbolError(originalNode->GetID()->GetID(), 
+                errorNode->GetID()->GetID()));
+            toDelete.push_front(entry);
         }
     }
 
-    m_workingList.clear();
-    m_workingList = entriesToKeep;
-
     for (SymbolTableEntry* entry : toDelete)
     {
         delete entry;
@@ -401,8 +483,13 @@ void SymbolTableAssembler::Visit(ConstructorDefNode* element)
     
     element->SetSymbolTable(functionTable);
 
-    if (!TryMatchMemFuncDeclAndDef(entry))
+    if (TryMatchMemFuncDeclAndDef(entry))
+    {
+        delete entry;
+    }
+    else
     {
+        m_unmatchedDefinitions.push_back(entry);
         SemanticErrorManager::AddError(new ConstructorDeclNotFound(element->GetID()->GetID()));
     }
 }
@@ -423,67 +510,38 @@ void SymbolTableAssembler::Visit(ClassDefNode* element)
     std::list<MemFuncTableEntry*> memFuncEntries;
     std::list<ConstructorTableEntry*> constructorEntries;
 
-    std::list<SymbolTableEntry*> entriesToKeep;
-    for (SymbolTableEntry* entry : m_workingList)
+    // the members of the class are the last entries visited
+    while (!m_workingList.empty())
     {
-        if (entry->GetKind() == SymbolTableEntryKind::MemVar)
+        SymbolTableEntry* entry = m_workingList.front();
+        if (entry->GetKind() == SymbolTableEntryKind::MemVar 
+            && ((MemVarTableEntry*)entry)->GetClassID() == className)
         {
-            MemVarTableEntry* memVarEntry = (MemVarTableEntry*)entry;
-            if (memVarEntry->GetClassID() == className)
-            {
-                memVarEntries.push_front(memVarEntry);
-            }
-            else
-            {
-                entriesToKeep.push_front(entry);
-            }
+            memVarEntries.push_front((MemVarTableEntry*)entry);
         }
-        else if (entry->GetKind() == SymbolTableEntryKind::InheritanceList)
+        else if (entry->GetKind() == SymbolTableEntryKind::InheritanceList 
+            && ((InheritanceListEntry*)entry)->GetClassID() == className)
         {
-            InheritanceListEntry* currInheritanceList = (InheritanceListEntry*)entry;
-            if (currInheritanceList->GetClassID() == className)
-            {
-                ASSERT(inheritanceList == nullptr);
-                inheritanceList = currInheritanceList;
-            }
-            else
-            {
-                entriesToKeep.push_front(entry);
-            }
+            ASSERT(inheritanceList == nullptr);
+            inheritanceList = (InheritanceListEntry*)entry;
         }
-        else if (entry->GetKind() == SymbolTableEntryKind::MemFuncDecl)
+        else if (entry->GetKind() == SymbolTableEntryKind::MemFuncDecl 
+            && ((MemFuncTableEntry*)entry)->GetClassID() == className)
         {
-            MemFuncTableEntry* memFunc = (MemFuncTableEntry*)entry;
-            if (memFunc->GetClassID() == className)
-            {
-                memFuncEntries.push_front(memFunc);
-            }
-            else
-            {
-                entriesToKeep.push_front(entry);
-            }
+            memFuncEntries.push_front((MemFuncTableEntry*)entry);
         }
-        else if (entry->GetKind() == SymbolTableEntryKind::ConstructorDecl)
+        else if (entry->GetKind() == SymbolTableEntryKind::ConstructorDecl 
+            && ((ConstructorTableEntry*)entry)->GetClassID() == className)
         {
-            ConstructorTableEntry* constructor = (ConstructorTableEntry*)entry;
-            if (constructor->GetClassID() == className)
-            {
-                constructorEntries.push_front(constructor);
-            }
-            else
-            {
-                entriesToKeep.push_front(entry);
-            }
+            constructorEntries.push_front((ConstructorTableEntry*)entry);
         }
-        else 
+        else
         {
-            entriesToKeep.push_front(entry);
+            break;
         }
+        m_workingList.pop_front();
     }
 
-    m_workingList.clear();
-    m_workingList = entriesToKeep;
-
     classTable->AddEntry(inheritanceList);
 
     std::list<SymbolTableEntry*> toDelete;
@@ -539,7 +597,11 @@ void SymbolTableAssembler::Visit(ClassDefNode* element)
 
     element->SetSymbolTable(classTable);
 
-    m_workingList.push_front(classEntry);
+    // every class definition reverses the order of the entries visited before it, 
+    // which is the order in which they are added to the global table
+    m_isGlobalEntriesReversed = !m_isGlobalEntriesReversed;
+    PushGlobalEntry(classEntry);
+    m_isClassIndexOutdated = true;
 }
 
 void SymbolTableAssembler::Visit(ProgramNode* element)
@@ -547,7 +609,7 @@ void SymbolTableAssembler::Visit(ProgramNode* element)
     m_globalScopeTable = new SymbolTable("Global");
 
     std::list<SymbolTableEntry*> toDelete;
-    for (SymbolTableEntry* entry : m_workingList)
+    for (SymbolTableEntry* entry : GetGlobalEntries())
     {
         SymbolTableEntry* originalEntry = m_globalScopeTable->AddEntry(entry);
         if (originalEntry != nullptr)
@@ -557,7 +619,7 @@ void SymbolTableAssembler::Visit(ProgramNode* element)
             {
                 FreeFuncTableEntry* funcEntry = (FreeFuncTableEntry*)entry;
                 FreeFuncTableEntry* originalFuncEntry = (FreeFuncTableEntry*)originalEntry;
-                if (funcEntry->GetParamTypes() == originalFuncEntry->GetParamTypes())
+                if (funcEntry->GetParamListID() == originalFuncEntry->GetParamListID())
                 {
                     IDNode* originalNode = GetIDFromEntry(originalEntry);
                     IDNode* errorNode = GetIDFromEntry(entry);
@@ -585,56 +647,130 @@ void SymbolTableAssembler::Visit(ProgramNode* element)
         delete entry;
     }
 
+    // every class table is complete so member lookups through inheritance can be precomputed
+    for (SymbolTableEntry* entry : *m_globalScopeTable)
+    {
+        if (entry->GetKind() == SymbolTableEntryKind::Class)
+        {
+            entry->GetSubTable()->LinearizeInheritance();
+        }
+    }
+
     element->SetSymbolTable(m_globalScopeTable);
     m_workingList.clear();
+    m_globalEntries.clear();
+    m_classEntries.clear();
 }
 
+bool SymbolTableAssembler::ShouldStopVisiting() { return ErrorLimit::IsReached(); }
+
 SymbolTable* SymbolTableAssembler::GetGlobalSymbolTable() { return m_globalScopeTable; }
 
 bool SymbolTableAssembler::TryMatchMemFuncDeclAndDef(MemFuncDefEntry* def)
 {
-    for (SymbolTableEntry* entry : m_workingList)
+    ClassTableEntry* classDefEntry = FindClassEntry(def->GetClassID());
+    if (classDefEntry == nullptr)
     {
-        ClassTableEntry* classDefEntry = dynamic_cast<ClassTableEntry*>(entry);
-        if (classDefEntry != nullptr && classDefEntry->GetName() == def->GetClassID())
+        return false;
+    }
+
+    SymbolTable* classTable = classDefEntry->GetSubTable();
+    SymbolTableEntry* decl = classTable->FindOverloadInTable(def->GetNameID(), 
+        def->GetParamListID());
+    if (decl == nullptr)
+    {
+        return false;
+    }
+    
+    if (((MemFuncTableEntry*)decl)->GetReturnType() != def->GetReturnType())
+    {
+        // the same parameters can be declared again with another return type
+        decl = nullptr;
+        for (SymbolTableEntry* entry : classTable->FindAllEntriesInTable(def->GetNameID()))
         {
-            for (SymbolTableEntry* classEntry : *classDefEntry->GetSubTable())
+            MemFuncTableEntry* memFunc = dynamic_cast<MemFuncTableEntry*>(entry);
+            if (memFunc != nullptr && memFunc->GetParamListID() == def->GetParamListID() 
+                && memFunc->GetReturnType() == def->GetReturnType())
             {
-                MemFuncTableEntry* decl = dynamic_cast<MemFuncTableEntry*>(classEntry);
-                if (decl != nullptr && decl->GetName() == def->GetName() 
-                    && decl->GetParamTypes() == def->GetParamTypes() 
-                    && decl->GetReturnType() == def->GetReturnType())
-                {
-                    decl->SetDefinition(def);
-                    return true;
-                }
+                decl = memFunc;
+                break;
             }
-            break;
+        }
+
+        if (decl == nullptr)
+        {
+            return false;
         }
     }
-    return false;
+
+    ((MemFuncTableEntry*)decl)->SetDefinition(def);
+    return true;
 }
 
 bool SymbolTableAssembler::TryMatchMemFuncDeclAndDef(ConstructorDefEntry* def)
 {
-    for (SymbolTableEntry* entry : m_workingList)
+    ClassTableEntry* classDefEntry = FindClassEntry(def->GetClassID());
+    NameID constructorName = NameTable::FindID(def->GetClassID() + "::constructor");
+    if (classDefEntry == nullptr || constructorName == NameTable::InvalidNameID)
+    {
+        return false;
+    }
+
+    SymbolTableEntry* decl = classDefEntry->GetSubTable()->FindOverloadInTable(constructorName, 
+        def->GetParamListID());
+    if (decl == nullptr)
+    {
+        return false;
+    }
+
+    ((ConstructorTableEntry*)decl)->SetDefinition(def);
+    return true;
+}
+
+void SymbolTableAssembler::PushGlobalEntry(SymbolTableEntry* entry)
+{
+    if (m_isGlobalEntriesReversed)
     {
-        ClassTableEntry* classDefEntry = dynamic_cast<ClassTableEntry*>(entry);
-        if (classDefEntry != nullptr && classDefEntry->GetName() == def->GetClassID())
+        m_globalEntries.push_back(entry);
+    }
+    else
+    {
+        m_globalEntries.push_front(entry);
+    }
+}
+
+std::vector<SymbolTableEntry*> SymbolTableAssembler::GetGlobalEntries() const
+{
+    std::vector<SymbolTableEntry*> entries(m_globalEntries.begin(), m_globalEntries.end());
+    if (m_isGlobalEntriesReversed)
+    {
+        std::reverse(entries.begin(), entries.end());
+    }
+    return entries;
+}
+
+ClassTableEntry* SymbolTableAssembler::FindClassEntry(const std::string& className)
+{
+    if (m_isClassIndexOutdated)
+    {
+        // when a name is defined more than once, the first class of the global order is used
+        m_classEntries.clear();
+        for (SymbolTableEntry* entry : GetGlobalEntries())
         {
-            for (SymbolTableEntry* classEntry : *classDefEntry->GetSubTable())
+            if (entry->GetKind() == SymbolTableEntryKind::Class)
             {
-                ConstructorTableEntry* decl = dynamic_cast<ConstructorTableEntry*>(classEntry);
-                if (decl != nullptr && decl->GetParamTypes() == def->GetParamTypes())
-                {
-                    decl->SetDefinition(def);
-                    return true;
-                }
+                m_classEntries.emplace(entry->GetName(), (ClassTableEntry*)entry);
             }
-            break;
         }
+        m_isClassIndexOutdated = false;
     }
-    return false;
+
+    auto it = m_classEntries.find(className);
+    if (it == m_classEntries.end())
+    {
+        return nullptr;
+    }
+    return it->second;
 }
 
 void SymbolTableAssembler::CheckForDeclWithoutDef(ClassTableEntry* classEntry)
@@ -666,8 +802,27 @@ void SymbolTableAssembler::CheckForDeclWithoutDef(ClassTableEntry* classEntry)
 }
 
 // SemanticChecker //////////////////////////////////////////
+bool SemanticChecker::s_isParallel = false;
+
 SemanticChecker::SemanticChecker(SymbolTable* globalTable) 
-    : m_globalTable(globalTable) { }
+    : m_globalTable(globalTable), m_isWorker(false) { }
+
+void SemanticChecker::SetParallel(bool isParallel) { s_isParallel = isParallel; }
+bool SemanticChecker::IsParallel() { return s_isParallel; }
+
+void SemanticChecker::CheckProgram(ProgramNode* program)
+{
+    if (!s_isParallel)
+    {
+        program->AcceptVisit(this);
+        return;
+    }
+
+    // same order as visiting the program, the classes are checked sequentially
+    program->GetClassList()->AcceptVisit(this);
+    CheckFunctionsInParallel(program->GetFunctionList());
+    Visit(program);
+}
     
 void SemanticChecker::Visit(IDNode* element)
 {
@@ -708,22 +863,7 @@ void SemanticChecker::Visit(VarDeclNode* element)
         if (classEntry != nullptr && classEntry->GetKind() == SymbolTableEntryKind::Class)
         {
             SymbolTable* classTable = classEntry->GetSubTable();
-            bool found = false;
-            for (SymbolTableEntry* entry : *classTable)
-            {
-                if (entry->GetKind() == SymbolTableEntryKind::ConstructorDecl)
-                {
-                    ConstructorTableEntry* constructor = (ConstructorTableEntry*)entry;
-                    FParamListNode* fparam = constructor->GetDeclNode()->GetParameters();
-                    if (HasMatchingParameters(fparam, params))
-                    {
-                        found = true;
-                        break;
-                    }
-                }
-            }
-
-            if (!found)
+            if (FindConstructorEntry(classTable, params) == nullptr)
             {
                 SemanticErrorManager::AddError(new 
                     IncorrectParametersProvidedToFuncCallError(element->GetType(), params));
@@ -737,7 +877,7 @@ void SemanticChecker::Visit(DimensionNode* element)
     for (ASTNode* node : element->GetChildren())
     {
         if (dynamic_cast<UnspecificedDimensionNode*>(node) == nullptr 
-            && node->GetEvaluatedType() != "integer")
+            && node->GetEvaluatedTypeID() != TypeTable::GetIntegerType())
         {
             SemanticErrorManager::AddError(
                 new ArrayIndexingTypeError(element->GetFirstToken()));
@@ -759,12 +899,12 @@ void SemanticChecker::Visit(DotNode* element)
 void SemanticChecker::Visit(BaseBinaryOperator* element)
 {
     // check for array type
-    if (IsArrayType(element->GetLeft()->GetEvaluatedType()) 
-        || IsArrayType(element->GetRight()->GetEvaluatedType()))
+    if (TypeTable::IsArray(element->GetLeft()->GetEvaluatedTypeID()) 
+        || TypeTable::IsArray(element->GetRight()->GetEvaluatedTypeID()))
     {
         SemanticErrorManager::AddError(new OperationOnArrayError(element->GetFirstToken()));
     }
-    else if (element->GetEvaluatedType() == ASTNode::InvalidType) 
+    else if (element->GetEvaluatedTypeID() == TypeTable::GetInvalidType()) 
     {
         // check for invalid operands
         SemanticErrorManager::AddError(new InvalidOperandForOperatorError(element));
@@ -775,12 +915,13 @@ void SemanticChecker::Visit(BaseBinaryOperator* element)
 void SemanticChecker::Visit(ReturnStatNode* element)
 {
     SymbolTableEntry* entry = element->GetSymbolTable()->GetParentEntry();
-    if (entry->GetEvaluatedType() 
-        != element->GetExpr()->GetEvaluatedType())
+    TypeID returnType = entry->GetEvaluatedTypeID();
+    TypeID exprType = element->GetExpr()->GetEvaluatedTypeID();
+    if (returnType != exprType)
     {
         SemanticErrorManager::AddError(
             new IncorrectReturnTypeError(element->GetSymbolTable()->GetName(), 
-            entry->GetEvaluatedType(), element->GetExpr()->GetEvaluatedType(), 
+            TypeTable::GetTypeStr(returnType), TypeTable::GetTypeStr(exprType), 
             element->GetFirstToken()));
     }
     else
@@ -798,12 +939,13 @@ void SemanticChecker::Visit(ReturnStatNode* element)
 
 void SemanticChecker::Visit(AssignStatNode* element)
 {
-    if (IsArrayType(element->GetLeft()->GetEvaluatedType()) 
-        || IsArrayType(element->GetRight()->GetEvaluatedType()))
+    TypeID leftType = element->GetLeft()->GetEvaluatedTypeID();
+    TypeID rightType = element->GetRight()->GetEvaluatedTypeID();
+    if (TypeTable::IsArray(leftType) || TypeTable::IsArray(rightType))
     {
         SemanticErrorManager::AddError(new OperationOnArrayError(element->GetFirstToken()));
     }
-    else if (element->GetLeft()->GetEvaluatedType() != element->GetRight()->GetEvaluatedType())
+    else if (leftType != rightType)
     {
         SemanticErrorManager::AddError(new InvalidTypeMatchupForAssignError(element));
     }
@@ -821,26 +963,13 @@ void SemanticChecker::Visit(FuncCallNode* element)
         return;
     }
 
-    const std::string& funcName = element->GetID()->GetID().GetLexeme();
+    NameID funcName = element->GetID()->GetID().GetLexemeID();
 
     // for free functions (memfunc and constructors are handled by dot node)
-    bool found = false;
-    for (SymbolTableEntry* entry : *m_globalTable)
-    {
-        if (entry->GetKind() == SymbolTableEntryKind::FreeFunction 
-            && entry->GetName() == funcName)
-        {
-            FParamListNode* fparams = ((FunctionDefNode*)((FreeFuncTableEntry*)entry)->
-                GetNode())->GetParameters();
-            if (HasMatchingParameters(fparams, element->GetParameters()))
-            {
-                found = true;
-                break;
-            }
-        }
-    }
+    SymbolTableEntry* entry = m_globalTable->FindOverloadInTable(funcName, 
+        GetArgumentListID(element->GetParameters()));
 
-    if (!found)
+    if (entry == nullptr || entry->GetKind() != SymbolTableEntryKind::FreeFunction)
     {
         SemanticErrorManager::AddError(
             new IncorrectParametersProvidedToFuncCallError(element));
@@ -875,6 +1004,14 @@ void SemanticChecker::Visit(FunctionDefNode* element)
     // check if a return statement is provided
     CheckReturnStatement(element);
 
+    if (!m_isWorker)
+    {
+        CheckForOverloadedFunc(element);
+    }
+}
+
+void SemanticChecker::CheckForOverloadedFunc(FunctionDefNode* element)
+{
     // check if function is overloaded
     const std::string& funcName = element->GetID()->GetID().GetLexeme();
     if (HasFoundOverLoadedFunc(m_overloadedFreeFuncFound, funcName))
@@ -887,7 +1024,7 @@ void SemanticChecker::Visit(FunctionDefNode* element)
     {
         if (entry->GetKind() == SymbolTableEntryKind::FreeFunction)
         {
-            if (entry->GetName() == funcName)
+            if (entry->GetNameID() == element->GetID()->GetID().GetLexemeID())
             {
                 if (foundEntry)
                 {
@@ -935,6 +1072,8 @@ void SemanticChecker::Visit(ProgramNode* element)
     }
 }
 
+bool SemanticChecker::ShouldStopVisiting() { return ErrorLimit::IsReached(); }
+
 void SemanticChecker::Visit(MemFuncDeclNode* element)
 {
     // check for overriden functions
@@ -950,7 +1089,7 @@ void SemanticChecker::Visit(MemFuncDeclNode* element)
         {
             IDNode* id = (IDNode*)baseNode;
             SymbolTableEntry* parentClassEntry = m_globalTable->FindEntryInTable(
-                id->GetID().GetLexeme());
+                id->GetID().GetLexemeID());
 
             if (parentClassEntry != nullptr)
             {
@@ -962,8 +1101,8 @@ void SemanticChecker::Visit(MemFuncDeclNode* element)
                         MemFuncTableEntry* memFuncEntry = (MemFuncTableEntry*)parentEntry;
                         MemFuncDeclNode* memFuncNode = memFuncEntry->GetDeclNode();
                         if (memFuncNode->GetID()->GetID().GetLexeme() 
-                            == funcName && memFuncEntry->GetParamTypes() 
-                            == currElementEntry->GetParamTypes())
+                            == funcName && memFuncEntry->GetParamListID() 
+                            == currElementEntry->GetParamListID())
                         {
                             SemanticErrorManager::AddWarning(
                                 new OverridenFuncWarn(currElementEntry->GetClassID(), 
@@ -989,6 +1128,14 @@ void SemanticChecker::Visit(MemFuncDefNode* element)
     // check if a return statement is provided
     CheckReturnStatement(element);
 
+    if (!m_isWorker)
+    {
+        CheckForOverloadedFunc(element);
+    }
+}
+
+void SemanticChecker::CheckForOverloadedFunc(MemFuncDefNode* element)
+{
     //check for overloaded function
     const std::string& funcName = element->GetID()->GetID().GetLexeme();
     const std::string& classID = element->GetClassID()->GetID().GetLexeme();
@@ -1027,6 +1174,14 @@ void SemanticChecker::Visit(MemFuncDefNode* element)
 }
 
 void SemanticChecker::Visit(ConstructorDefNode* element)
+{
+    if (!m_isWorker)
+    {
+        CheckForOverloadedFunc(element);
+    }
+}
+
+void SemanticChecker::CheckForOverloadedFunc(ConstructorDefNode* element)
 {
     const std::string& classID = element->GetID()->GetID().GetLexeme();
     std::string idStr = classID + "::" + "constructor";
@@ -1090,87 +1245,188 @@ void SemanticChecker::Visit(InheritanceListNode* element)
     }
 }
 
-void SemanticChecker::Visit(ClassDefNode* element)
+void SemanticChecker::Visit(ClassDefListNode* element)
 {
-    std::list<ClassDefNode*> visited;
-    std::list<ClassDefNode*> stack;
+    // every class is a vertex of a single graph whose edges go to the inherited classes 
+    // and to the classes of the members contained by value, a class is part of a 
+    // circular dependency if it is in a strongly connected component with a cycle
+    std::vector<ClassDefNode*> classes;
+    std::unordered_map<ASTNode*, size_t> classIndices;
+    for (ASTNode* node : element->GetChildren())
+    {
+        classIndices[node] = classes.size();
+        classes.push_back((ClassDefNode*)node);
+    }
 
-    const Token& className = element->GetID()->GetID();
-    
+    std::vector<std::vector<ClassDependency>> dependencies(classes.size());
+    std::vector<std::vector<size_t>> successors(classes.size());
+    for (size_t i = 0; i < classes.size(); i++)
     {
-        InheritanceListNode* inheritanceList = element->GetInheritanceList();
-        for (ASTNode* baseNode : inheritanceList->GetChildren())
+        for (ASTNode* baseNode : classes[i]->GetInheritanceList()->GetChildren())
         {
-            IDNode* id = (IDNode*) baseNode;
-            SymbolTableEntry* entry = m_globalTable->FindEntryInTable(id->GetID().GetLexeme());
-            ASSERT(entry != nullptr);
-            
-            visited.push_front((ClassDefNode*)entry->GetNode());
-            stack.push_front((ClassDefNode*)entry->GetNode());
+            SymbolTableEntry* entry = m_globalTable->FindEntryInTable(
+                ((IDNode*)baseNode)->GetID().GetLexemeID());
+            if (entry != nullptr && entry->GetKind() == SymbolTableEntryKind::Class)
+            {
+                dependencies[i].push_back({ classIndices[entry->GetNode()], nullptr });
+            }
         }
-    }
 
-    while (stack.size() > 0)
-    {
-        ClassDefNode* currClass = stack.front();
-        stack.pop_front();
+        for (SymbolTableEntry* member : *classes[i]->GetSymbolTable())
+        {
+            if (member->GetKind() != SymbolTableEntryKind::MemVar)
+            {
+                continue;
+            }
 
-        if (currClass == element)
+            // arrays of a class contain their elements by value
+            const std::string& memberType = TypeTable::GetTypeStr(
+                TypeTable::GetBaseType(member->GetEvaluatedTypeID()));
+            SymbolTableEntry* entry = m_globalTable->FindEntryInTable(memberType);
+            if (entry != nullptr && entry->GetKind() == SymbolTableEntryKind::Class)
+            {
+                dependencies[i].push_back({ classIndices[entry->GetNode()], member });
+            }
+        }
+
+        for (const ClassDependency& dependency : dependencies[i])
         {
-            SemanticErrorManager::AddError(new CircularInheritanceDependencyError(className));
-            break;
+            successors[i].push_back(dependency.m_class);
         }
+    }
 
+    std::vector<size_t> components = FindStronglyConnectedComponents(successors);
+    std::vector<bool> isCyclic = FindCyclicComponents(successors, components);
+
+    // the inheritance cycles are searched again without the member edges, 
+    // only inside of the components that have a cycle
+    std::vector<std::vector<size_t>> inheritanceSuccessors(classes.size());
+    for (size_t i = 0; i < classes.size(); i++)
+    {
+        for (const ClassDependency& dependency : dependencies[i])
         {
-            SymbolTable* currClassTable = currClass->GetSymbolTable();
-            bool found = false;
-            Token t;
-            for (SymbolTableEntry* entry : *currClassTable)
+            if (dependency.m_member == nullptr && isCyclic[components[i]] 
+                && components[i] == components[dependency.m_class])
             {
-                if (entry->GetKind() == SymbolTableEntryKind::MemVar 
-                    && entry->GetEvaluatedType() == className.GetLexeme())
-                {
-                    found = true;
-                    t = ((VarDeclNode*)entry->GetNode())->GetID()->GetID();
-                    break;
-                }
+                inheritanceSuccessors[i].push_back(dependency.m_class);
             }
+        }
+    }
+
+    std::vector<size_t> inheritanceComponents 
+        = FindStronglyConnectedComponents(inheritanceSuccessors);
+    std::vector<bool> isInheritanceCyclic = FindCyclicComponents(inheritanceSuccessors, 
+        inheritanceComponents);
+
+    for (size_t i = 0; i < classes.size(); i++)
+    {
+        if (isInheritanceCyclic[inheritanceComponents[i]])
+        {
+            SemanticErrorManager::AddError(new CircularInheritanceDependencyError(
+                classes[i]->GetID()->GetID()));
+        }
 
-            if (found)
+        for (const ClassDependency& dependency : dependencies[i])
+        {
+            if (dependency.m_member != nullptr && isCyclic[components[i]] 
+                && components[i] == components[dependency.m_class])
             {
-                SemanticErrorManager::AddError(
-                    new CircularClassMemberDependencyError(className.GetLexeme(), 
-                    currClass->GetID()->GetID().GetLexeme(), t));
-            break;
+                SemanticErrorManager::AddError(new CircularClassMemberDependencyError(
+                    classes[dependency.m_class]->GetID()->GetID().GetLexeme(), 
+                    classes[i]->GetID()->GetID().GetLexeme(), 
+                    ((VarDeclNode*)dependency.m_member->GetNode())->GetID()->GetID()));
             }
         }
+    }
+}
 
-        // push on stack inherited classes
-        InheritanceListNode* inheritanceList = currClass->GetInheritanceList();
-        for (ASTNode* baseNode : inheritanceList->GetChildren())
-        {
-            IDNode* id = (IDNode*) baseNode;
-            SymbolTableEntry* entry = m_globalTable->FindEntryInTable(id->GetID().GetLexeme());
-            ASSERT(entry != nullptr);
-            
-            bool found = false;
+void SemanticChecker::CheckForOverloadedFunc(ASTNode* funcDef)
+{
+    if (dynamic_cast<ConstructorDefNode*>(funcDef) != nullptr)
+    {
+        CheckForOverloadedFunc((ConstructorDefNode*)funcDef);
+    }
+    else if (dynamic_cast<MemFuncDefNode*>(funcDef) != nullptr)
+    {
+        CheckForOverloadedFunc((MemFuncDefNode*)funcDef);
+    }
+    else
+    {
+        ASSERT(dynamic_cast<FunctionDefNode*>(funcDef) != nullptr);
+        CheckForOverloadedFunc((FunctionDefNode*)funcDef);
+    }
+}
 
-            ClassDefNode* classDef = (ClassDefNode*)entry->GetNode();
-            for (ClassDefNode* def : visited)
+void SemanticChecker::CheckFunctionsInParallel(FunctionDefListNode* functions)
+{
+    std::vector<ASTNode*> funcDefs(functions->GetChildren().begin(), 
+        functions->GetChildren().end());
+    std::vector<SemanticMessageBuffer> buffers(funcDefs.size());
+    std::atomic<size_t> nextFuncDef(0);
+    DiagnosticsContext& diagnostics = DiagnosticsContext::GetCurrent();
+    size_t numRemainingErrors = ErrorLimit::GetNumRemainingErrors();
+
+    // the symbol tables are complete so the bodies only read shared state
+    auto checkFunctions = [&]()
+    {
+        SemanticChecker worker(m_globalTable);
+        worker.m_isWorker = true;
+
+        size_t i;
+        while ((i = nextFuncDef++) < funcDefs.size())
+        {
+            // like the sequential checker, a function is not checked once the functions 
+            // before it reach the error limit. the functions still being checked by other 
+            // threads may only add errors so the function may be checked for nothing
+            if (numRemainingErrors != ErrorLimit::NoLimit)
             {
-                if (def == classDef)
+                size_t numErrorsBefore = 0;
+                for (size_t j = 0; j < i && numErrorsBefore < numRemainingErrors; j++)
                 {
-                    found = true;
-                    break;
+                    numErrorsBefore += buffers[j].GetNumErrors();
+                }
+                if (numErrorsBefore >= numRemainingErrors)
+                {
+                    continue;
                 }
             }
 
-            if (!found)
-            {
-                visited.push_front(classDef);
-                stack.push_front(classDef);
-            }
+            SemanticErrorManager::SetThreadBuffer(&buffers[i]);
+            worker.m_functionWithCorrectReturnStat.clear();
+            funcDefs[i]->AcceptVisit(&worker);
+        }
+        SemanticErrorManager::SetThreadBuffer(nullptr);
+    };
+
+    // the hardware threads are shared with the other files compiled at the same time and 
+    // the calling thread is one of the threads checking the functions
+    size_t numThreads = WorkerThreads::GetNumThreads(funcDefs.size());
+    std::vector<std::thread> threads;
+    for (size_t i = 1; i < numThreads; i++)
+    {
+        // the worker threads report to the diagnostics of the compilation
+        threads.emplace_back([&]()
+        {
+            DiagnosticsContext::SetCurrent(&diagnostics);
+            checkFunctions();
+        });
+    }
+    checkFunctions();
+
+    for (std::thread& thread : threads)
+    {
+        thread.join();
+    }
+
+    // the messages are added as if the functions had been visited sequentially
+    for (size_t i = 0; i < funcDefs.size(); i++)
+    {
+        if (ShouldStopVisiting())
+        {
+            break;
         }
+        SemanticErrorManager::AddBufferedMessages(buffers[i]);
+        CheckForOverloadedFunc(funcDefs[i]);
     }
 }
 
@@ -1208,7 +1464,7 @@ void SemanticChecker::TestDotRemainder(SymbolTable* contextTable,
     {
         VariableNode* var = (VariableNode*)left;
         SymbolTableEntry* varEntry = contextTable->FindEntryInScope(var->
-            GetVariable()->GetID().GetLexeme());
+            GetVariable()->GetID().GetLexemeID());
 
         if (varEntry == nullptr || (varEntry->GetKind() != SymbolTableEntryKind::MemVar 
             && varEntry->GetKind() != SymbolTableEntryKind::LocalVariable
@@ -1276,7 +1532,7 @@ void SemanticChecker::TestDotRemainder(SymbolTable* contextTable,
         if (contextTable->GetParentEntry()->GetKind() != SymbolTableEntryKind::Class)
         {
             SymbolTableEntry* funcEntry = contextTable->FindEntryInScope(funcCall->
-                GetID()->GetID().GetLexeme());
+                GetID()->GetID().GetLexemeID());
 
             if (funcEntry == nullptr 
                 || funcEntry->GetKind() != SymbolTableEntryKind::FreeFunction)
@@ -1294,7 +1550,7 @@ void SemanticChecker::TestDotRemainder(SymbolTable* contextTable,
             for (SymbolTableEntry* entry : *contextTable)
             {
                 if ((entry->GetKind() == SymbolTableEntryKind::MemFuncDecl 
-                    && entry->GetName() == funcName) 
+                    && entry->GetNameID() == funcCall->GetID()->GetID().GetLexemeID()) 
                     || (entry->GetKind() == SymbolTableEntryKind::ConstructorDecl 
                     && contextTable->GetName() == funcName))
                 {
@@ -1357,4 +1613,17 @@ void SemanticChecker::TestDotRemainder(SymbolTable* contextTable,
     {
         DEBUG_BREAK(); // error here
     }
-}
\ No newline at end of file
+}
+
+// EvaluatedTypeCacher //////////////////////////////////////////
+void EvaluatedTypeCacher::Visit(IDNode* element) { element->CacheEvaluatedType(); }
+void EvaluatedTypeCacher::Visit(LiteralNode* element) { element->CacheEvaluatedType(); }
+void EvaluatedTypeCacher::Visit(DotNode* element) { element->CacheEvaluatedType(); }
+void EvaluatedTypeCacher::Visit(ExprNode* element) { element->CacheEvaluatedType(); }
+void EvaluatedTypeCacher::Visit(ModifiedExpr* element) { element->CacheEvaluatedType(); }
+void EvaluatedTypeCacher::Visit(BaseBinaryOperator* element) { element->CacheEvaluatedType(); }
+void EvaluatedTypeCacher::Visit(VarDeclNode* element) { element->CacheEvaluatedType(); }
+void EvaluatedTypeCacher::Visit(FParamNode* element) { element->CacheEvaluatedType(); }
+void EvaluatedTypeCacher::Visit(FuncCallNode* element) { element->CacheEvaluatedType(); }
+void EvaluatedTypeCacher::Visit(VariableNode* element) { element->CacheEvaluatedType(); }
+void EvaluatedTypeCacher::Visit(MemVarNode* element) { element->CacheEvaluatedType(); }
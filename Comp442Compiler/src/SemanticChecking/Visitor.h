@@ -1,5 +1,8 @@
 #pragma once
 #include <list>
+#include <deque>
+#include <vector>
+#include <unordered_map>
 
 #include "SymbolTable.h"
 #include "SemanticErrors.h"
@@ -30,12 +33,16 @@ class MemVarNode;
 class MemFuncDeclNode;
 class MemFuncDefNode;
 class ConstructorDeclNode;
+class ClassDefListNode;
+class FunctionDefListNode;
 class ProgramNode;
 
 
 class Visitor
 {
 public:
+    virtual ~Visitor() = default;
+
     virtual void Visit(IVisitableElement* element) { }
     virtual void Visit(IDNode* element) { }
     virtual void Visit(LiteralNode* element) { }
@@ -64,7 +71,11 @@ public:
     virtual void Visit(ConstructorDefNode* element) { }
     virtual void Visit(InheritanceListNode* element) { }
     virtual void Visit(ClassDefNode* element) { }
+    virtual void Visit(ClassDefListNode* element) { }
     virtual void Visit(ProgramNode* element) { }
+
+    // returns true if the remaining top level classes and functions do not need to be visited
+    virtual bool ShouldStopVisiting() { return false; }
 };
 
 
@@ -91,6 +102,7 @@ public:
     virtual void Visit(InheritanceListNode* element) override;
     virtual void Visit(ClassDefNode* element) override;
     virtual void Visit(ProgramNode* element) override;
+    virtual bool ShouldStopVisiting() override;
     
     SymbolTable* GetGlobalSymbolTable();
 
@@ -100,8 +112,30 @@ private:
     bool TryMatchMemFuncDeclAndDef(ConstructorDefEntry* def);
     void CheckForDeclWithoutDef(ClassTableEntry* classEntry);
 
+    void PushGlobalEntry(SymbolTableEntry* entry);
+
+    // returns the classes and free functions in the order they are added to the global table
+    std::vector<SymbolTableEntry*> GetGlobalEntries() const;
+
+    // returns nullptr if no class with the provided name was visited
+    ClassTableEntry* FindClassEntry(const std::string& className);
+
     SymbolTable* m_globalScopeTable;
+
+    // entries waiting to be added to the table of the node being visited
     std::list<SymbolTableEntry*> m_workingList;
+
+    // classes and free functions waiting to be added to the global table, 
+    // reversing them only flips the order in which they are read
+    std::deque<SymbolTableEntry*> m_globalEntries;
+    bool m_isGlobalEntriesReversed;
+
+    // definitions without a declaration keep the table of their node alive until the 
+    // assembler is deleted, the matched ones give their table to their declaration
+    std::list<SymbolTableEntry*> m_unmatchedDefinitions;
+
+    std::unordered_map<std::string, ClassTableEntry*> m_classEntries;
+    bool m_isClassIndexOutdated;
 };
 
 class SemanticChecker : public Visitor
@@ -109,6 +143,15 @@ class SemanticChecker : public Visitor
 public:
     SemanticChecker(SymbolTable* globalTable);
 
+    // when enabled, the bodies of the functions are checked on several threads and their 
+    // errors are added in the order of the program once every function is checked
+    static void SetParallel(bool isParallel);
+    static bool IsParallel();
+
+    // checks the whole program, must be used instead of visiting the program directly 
+    // for the functions to be checked in parallel
+    void CheckProgram(ProgramNode* program);
+
     virtual void Visit(IDNode* element) override;
     virtual void Visit(DimensionNode* element) override;
     virtual void Visit(DotNode* element) override;
@@ -124,21 +167,31 @@ public:
     virtual void Visit(MemFuncDefNode* element) override;
     virtual void Visit(ConstructorDefNode* element) override;
     virtual void Visit(InheritanceListNode* element) override;
-    virtual void Visit(ClassDefNode* element) override;
+    virtual void Visit(ClassDefListNode* element) override;
     virtual void Visit(ProgramNode* element) override;
+    virtual bool ShouldStopVisiting() override;
     
 
 private:
     bool HasFoundOverLoadedFunc(const std::list<std::string>& funcList, 
         const std::string& name);
 
+    // the overloads are checked by name across the program so workers leave them 
+    // to the checker merging their results
+    void CheckForOverloadedFunc(FunctionDefNode* element);
+    void CheckForOverloadedFunc(MemFuncDefNode* element);
+    void CheckForOverloadedFunc(ConstructorDefNode* element);
+    void CheckForOverloadedFunc(ASTNode* funcDef);
+
+    void CheckFunctionsInParallel(FunctionDefListNode* functions);
+
     // recursively go down the dot chain to try and find the type of the dot expression
     void TestDotRemainder(SymbolTable* contextTable, ASTNode* dotRemainder);
 
     template<typename FuncNode>
     void CheckReturnStatement(FuncNode* func)
     {
-        if (func->GetEvaluatedType() != "void")
+        if (func->GetEvaluatedTypeID() != TypeTable::GetVoidType())
         {
             SymbolTableEntry* entry = func->GetSymbolTable()->GetParentEntry();
             bool found = false;
@@ -164,4 +217,25 @@ private:
     std::list<std::string> m_overloadedMemFuncFound;
     std::list<std::string> m_overloadedConstructorFound;
     std::list<SymbolTableEntry*> m_functionWithCorrectReturnStat;
-};
\ No newline at end of file
+    bool m_isWorker;
+
+    static bool s_isParallel;
+};
+
+// caches the evaluated type of every expression node once semantic checking is done 
+// so later phases do not have to recompute them
+class EvaluatedTypeCacher : public Visitor
+{
+public:
+    virtual void Visit(IDNode* element) override;
+    virtual void Visit(LiteralNode* element) override;
+    virtual void Visit(DotNode* element) override;
+    virtual void Visit(ExprNode* element) override;
+    virtual void Visit(ModifiedExpr* element) override;
+    virtual void Visit(BaseBinaryOperator* element) override;
+    virtual void Visit(VarDeclNode* element) override;
+    virtual void Visit(FParamNode* element) override;
+    virtual void Visit(FuncCallNode* element) override;
+    virtual void Visit(VariableNode* element) override;
+    virtual void Visit(MemVarNode* element) override;
+};